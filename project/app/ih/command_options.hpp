@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_APP_IH_COMMAND_OPTIONS_HPP_
 #define SIMULATOR_APP_IH_COMMAND_OPTIONS_HPP_
 
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -24,12 +25,20 @@ class CommandOptions {
   auto get_config_file_path() const noexcept
       -> const std::optional<std::string>&;
 
+  auto get_compiled_datasource_id() const noexcept
+      -> const std::optional<std::uint64_t>&;
+
+  auto get_replay_file_path() const noexcept
+      -> const std::optional<std::string>&;
+
   static auto get_help_message() -> std::string;
 
  private:
   std::optional<std::string> instance_prefix_;
   std::optional<std::string> instance_id_;
   std::optional<std::string> config_file_path_;
+  std::optional<std::uint64_t> compiled_datasource_id_;
+  std::optional<std::string> replay_file_path_;
   bool version_requested_ = false;
   bool help_requested_ = false;
 };
@@ -2,6 +2,8 @@
 #define SIMULATOR_APP_IH_COMPONENTS_FIX_ACCEPTOR_HPP_
 
 #include <filesystem>
+#include <utility>
+#include <variant>
 
 #include "acceptor/lifetime.hpp"
 #include "acceptor/transport.hpp"
@@ -53,6 +55,13 @@ class FixAcceptor : public middleware::TradingReplyReceiver {
     fix::send_reply(confirmation, acceptor_);
   }
 
+  auto process(protocol::OrderReplyBatch replies) -> void override {
+    for (auto& reply : replies) {
+      std::visit([this](auto& message) { process(std::move(message)); },
+                 reply);
+    }
+  }
+
   auto process(protocol::MarketDataReject reject) -> void override {
     fix::send_reply(reject, acceptor_);
   }
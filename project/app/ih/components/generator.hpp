@@ -58,6 +58,10 @@ class Generator : public middleware::TradingReplyReceiver,
     generator::accept_reply(confirmation, generator_);
   }
 
+  auto process(protocol::OrderReplyBatch replies) -> void override {
+    generator::accept_replies(replies, generator_);
+  }
+
   auto process(protocol::MarketDataReject reject) -> void override {
     // The generator does not send MarketDataRequest messages.
     // Thus, it is not expected to receive MarketDataReject messages.
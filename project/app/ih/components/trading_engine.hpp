@@ -45,11 +45,33 @@ class TradingEngine : public middleware::TradingAdminRequestReceiver,
     trading_system::process(std::move(request), trading_system_);
   }
 
+  auto process(protocol::OrderRequestBatch batch) -> void override {
+    trading_system::process(std::move(batch), trading_system_);
+  }
+
   auto process(const protocol::InstrumentStateRequest& request,
                protocol::InstrumentState& reply) -> void override {
     trading_system::process(request, reply, trading_system_);
   }
 
+  auto process(const protocol::InstrumentHandleRequest& request,
+               protocol::InstrumentHandleReply& reply) -> void override {
+    trading_system::process(request, reply, trading_system_);
+  }
+
+  auto process(protocol::ResolvedOrderRequests requests) -> void override {
+    trading_system::process(std::move(requests), trading_system_);
+  }
+
+  auto process(protocol::ResolvedOrderRequest request) -> void override {
+    trading_system::process(std::move(request), trading_system_);
+  }
+
+  auto process(const protocol::EngineLoadRequest& request,
+               protocol::EngineLoadReply& reply) -> void override {
+    trading_system::process(request, reply, trading_system_);
+  }
+
   auto process(const protocol::HaltPhaseRequest& request,
                protocol::HaltPhaseReply& reply) -> void override {
     trading_system::process(request, reply, trading_system_);
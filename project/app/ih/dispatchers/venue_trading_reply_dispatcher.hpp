@@ -1,7 +1,10 @@
 #ifndef SIMULATOR_APP_IH_DISPATCHERS_VENUE_TRADING_REPLY_DISPATCHER_HPP_
 #define SIMULATOR_APP_IH_DISPATCHERS_VENUE_TRADING_REPLY_DISPATCHER_HPP_
 
+#include <algorithm>
 #include <memory>
+#include <utility>
+#include <variant>
 
 #include "core/tools/overload.hpp"
 #include "ih/components/fix_acceptor.hpp"
@@ -53,6 +56,28 @@ struct VenueTradingReplyDispatcher : public middleware::TradingReplyReceiver {
     dispatch_message(std::move(confirmation));
   }
 
+  auto process(protocol::OrderReplyBatch replies) -> void override {
+    const bool to_generator =
+        std::all_of(replies.begin(), replies.end(), [](const auto& reply) {
+          return std::visit(
+              [](const auto& message) {
+                return std::holds_alternative<protocol::generator::Session>(
+                    message.session.value);
+              },
+              reply);
+        });
+    if (to_generator) {
+      generator_->process(std::move(replies));
+      return;
+    }
+
+    for (auto& reply : replies) {
+      std::visit(
+          [this](auto& message) { dispatch_message(std::move(message)); },
+          reply);
+    }
+  }
+
   auto process(protocol::MarketDataReject reject) -> void override {
     dispatch_message(std::move(reject));
   }
@@ -0,0 +1,14 @@
+#ifndef SIMULATOR_APP_IH_REPLAY_COMPILATION_HPP_
+#define SIMULATOR_APP_IH_REPLAY_COMPILATION_HPP_
+
+#include "ih/command_options.hpp"
+
+namespace simulator {
+
+// Compiles a historical datasource into a replay file, both are specified
+// by the command options. Configuration and logger are expected to be loaded.
+auto compile_replay(const CommandOptions& options) -> void;
+
+}  // namespace simulator
+
+#endif  // SIMULATOR_APP_IH_REPLAY_COMPILATION_HPP_
@@ -3,9 +3,12 @@
 #include <fmt/format.h>
 
 #include <cassert>
+#include <charconv>
+#include <cstdint>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <system_error>
 
 namespace simulator {
 namespace {
@@ -40,6 +43,15 @@ constexpr Option ConfigurationPathOption{
     .short_notation = "-f",
     .description = "specify path to XML configuration file (required)"};
 
+constexpr Option CompileReplayOption{
+    .wide_notation = "--compile-replay",
+    .description = "compile historical datasource with the given identifier "
+                   "into a replay file and exit"};
+
+constexpr Option ReplayFileOption{
+    .wide_notation = "--replay-file",
+    .description = "specify path to the compiled replay file"};
+
 auto get_option_value(const char** option_iter, const char** end)
     -> std::string_view {
   assert(option_iter < end);
@@ -53,6 +65,23 @@ auto get_option_value(const char** option_iter, const char** end)
       fmt::format("'{}' option is given without a value", *option_iter));
 }
 
+auto get_datasource_id_value(const char** option_iter, const char** end)
+    -> std::uint64_t {
+  const std::string_view value = get_option_value(option_iter, end);
+
+  std::uint64_t datasource_id = 0;
+  const auto [last, error] =
+      std::from_chars(value.data(), value.data() + value.size(), datasource_id);
+  if (error != std::errc{} || last != value.data() + value.size()) {
+    throw std::runtime_error(
+        fmt::format("'{}' option is given with an invalid datasource "
+                    "identifier '{}'",
+                    *option_iter,
+                    value));
+  }
+  return datasource_id;
+}
+
 auto format_option_identifier(Option option) noexcept -> std::string {
   assert(option.wide_notation.has_value() || option.short_notation.has_value());
 
@@ -93,6 +122,12 @@ auto CommandOptions::parse_from_cli_arguments(int argc, const char** argv)
     } else if (*current_option == ConfigurationPathOption) {
       config_file_path_ = get_option_value(current_option, end);
       std::advance(current_option, 2);
+    } else if (*current_option == CompileReplayOption) {
+      compiled_datasource_id_ = get_datasource_id_value(current_option, end);
+      std::advance(current_option, 2);
+    } else if (*current_option == ReplayFileOption) {
+      replay_file_path_ = get_option_value(current_option, end);
+      std::advance(current_option, 2);
     } else {
       // skip uninteresting option
       std::advance(current_option, 1);
@@ -123,6 +158,16 @@ auto CommandOptions::get_config_file_path() const noexcept
   return config_file_path_;
 }
 
+auto CommandOptions::get_compiled_datasource_id() const noexcept
+    -> const std::optional<std::uint64_t>& {
+  return compiled_datasource_id_;
+}
+
+auto CommandOptions::get_replay_file_path() const noexcept
+    -> const std::optional<std::string>& {
+  return replay_file_path_;
+}
+
 auto CommandOptions::get_help_message() -> std::string {
   return fmt::format(
       "Usage: market-simulator [OPTION] [VALUE] ...\n"
@@ -131,6 +176,8 @@ auto CommandOptions::get_help_message() -> std::string {
       "  {} - {}\n"
       "  {} [VALUE] - {}\n"
       "  {} [VALUE] - {}\n"
+      "  {} [VALUE] - {}\n"
+      "  {} [VALUE] - {}\n"
       "  {} [VALUE] - {}",
       format_option_identifier(HelpOption),
       format_option_description(HelpOption),
@@ -141,7 +188,11 @@ auto CommandOptions::get_help_message() -> std::string {
       format_option_identifier(InstanceIdOption),
       format_option_description(InstanceIdOption),
       format_option_identifier(ConfigurationPathOption),
-      format_option_description(ConfigurationPathOption));
+      format_option_description(ConfigurationPathOption),
+      format_option_identifier(CompileReplayOption),
+      format_option_description(CompileReplayOption),
+      format_option_identifier(ReplayFileOption),
+      format_option_description(ReplayFileOption));
 }
 
 }  // namespace simulator
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "ih/command_options.hpp"
 #include "ih/loading.hpp"
 #include "ih/loop.hpp"
+#include "ih/replay_compilation.hpp"
 
 namespace simulator {
 namespace {
@@ -76,6 +77,21 @@ auto run_application(const simulator::CommandOptions& options) noexcept
   std::exit(EXIT_FAILURE);
 }
 
+auto run_replay_compilation(const simulator::CommandOptions& options) noexcept
+    -> void try {
+  load_configuration(options);
+  load_logger(options, Simulator::Cfg::log());
+
+  compile_replay(options);
+
+} catch (const std::exception& exception) {
+  fmt::println(stderr, "failed to compile replay file: {}", exception.what());
+  std::exit(EXIT_FAILURE);
+} catch (...) {
+  fmt::println(stderr, "failed to compile replay file: unknown error occurred");
+  std::exit(EXIT_FAILURE);
+}
+
 }  // namespace
 }  // namespace simulator
 
@@ -93,6 +109,11 @@ auto main(int argc, const char** argv) -> int {
     std::exit(EXIT_SUCCESS);
   }
 
+  if (options.get_compiled_datasource_id().has_value()) {
+    simulator::run_replay_compilation(options);
+    std::exit(EXIT_SUCCESS);
+  }
+
   simulator::run_application(options);
 
   return EXIT_SUCCESS;
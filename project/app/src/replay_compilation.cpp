@@ -0,0 +1,43 @@
+#include "ih/replay_compilation.hpp"
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "cfg/api/cfg.hpp"
+#include "data_layer/api/data_access_layer.hpp"
+#include "generator/generator.hpp"
+#include "log/logging.hpp"
+
+namespace cfg = Simulator::Cfg;
+namespace database = Simulator::DataLayer::Database;
+
+namespace simulator {
+
+auto compile_replay(const CommandOptions& options) -> void {
+  const auto& datasource_id = options.get_compiled_datasource_id();
+  const auto& replay_file_path = options.get_replay_file_path();
+
+  if (!datasource_id.has_value()) {
+    throw std::runtime_error("datasource to be compiled is not specified");
+  }
+  if (!replay_file_path.has_value()) {
+    throw std::runtime_error("replay file path is not specified");
+  }
+
+  const std::size_t records = generator::compile_historical_replay(
+      database::setup(cfg::db()), *datasource_id, *replay_file_path);
+
+  log::info("datasource {} has been compiled into `{}', {} records written",
+            *datasource_id,
+            *replay_file_path,
+            records);
+  fmt::println(stdout,
+               "compiled {} records of datasource {} into '{}'",
+               records,
+               *datasource_id,
+               *replay_file_path);
+}
+
+}  // namespace simulator
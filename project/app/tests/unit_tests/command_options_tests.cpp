@@ -91,6 +91,29 @@ TEST_F(CommandOptionsParser, ReportsConfigurationPathOptionWithoutValue) {
                std::runtime_error);
 }
 
+TEST_F(CommandOptionsParser, ParsesCompileReplayOption) {
+  std::array<const char*, 2> args = {"--compile-replay", "42"};
+
+  options.parse_from_cli_arguments(args.size(), args.data());
+
+  ASSERT_THAT(options.get_compiled_datasource_id(), Optional(Eq(42)));
+}
+
+TEST_F(CommandOptionsParser, ReportsCompileReplayOptionWithInvalidValue) {
+  std::array<const char*, 2> args = {"--compile-replay", "42a"};
+
+  ASSERT_THROW(options.parse_from_cli_arguments(args.size(), args.data()),
+               std::runtime_error);
+}
+
+TEST_F(CommandOptionsParser, ParsesReplayFileOption) {
+  std::array<const char*, 2> args = {"--replay-file", "/replay/path"};
+
+  options.parse_from_cli_arguments(args.size(), args.data());
+
+  ASSERT_THAT(options.get_replay_file_path(), Optional(Eq("/replay/path")));
+}
+
 TEST_F(CommandOptionsParser, IgnoresUnknownOption) {
   std::array<const char*, 1> args = {"--unknown"};
 
@@ -105,7 +128,10 @@ TEST_F(CommandOptionsParser, CreatesHelpMessage) {
       "  -v|--version - print version and exit\n"
       "  --pf [VALUE] - specify instance prefix (required)\n"
       "  --id [VALUE] - specify instance identifier (required)\n"
-      "  -f [VALUE] - specify path to XML configuration file (required)";
+      "  -f [VALUE] - specify path to XML configuration file (required)\n"
+      "  --compile-replay [VALUE] - compile historical datasource with the "
+      "given identifier into a replay file and exit\n"
+      "  --replay-file [VALUE] - specify path to the compiled replay file";
 
   ASSERT_THAT(CommandOptions::get_help_message(), Eq(help_message));
 }
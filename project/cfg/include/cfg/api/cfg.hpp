@@ -2,6 +2,8 @@
 #define SIMULATOR_CFG_API_CFG_HPP_
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstdint>
+#include <optional>
 #include <string>
 
 namespace Simulator::Cfg {
@@ -33,6 +35,13 @@ struct LogConfiguration {
 
 struct GeneratorConfiguration {
   bool enableTracing = false;
+  int tracingSampleRate = 1;
+  std::optional<std::uint64_t> randomSeed;
+  int batchInterval = 0;
+  double replaySpeed = 1.;
+  // The datasource reader default is used when the size is not configured.
+  std::optional<int> historicalFetchSize;
+  int historicalPartitions = 1;
 };
 
 struct HttpConfiguration {
@@ -42,6 +51,13 @@ struct HttpConfiguration {
   bool check_api_version = true;
 };
 
+struct PersistenceConfiguration {
+  bool compact_snapshot = false;
+  int snapshot_interval = 0;
+  bool journal = false;
+  int journal_checkpoint_records = 100000;
+};
+
 auto init(const std::string& path) -> void;
 
 auto init() -> void;
@@ -58,6 +74,8 @@ auto generator() -> const GeneratorConfiguration&;
 
 auto http() -> const HttpConfiguration&;
 
+auto persistence() -> const PersistenceConfiguration&;
+
 }  // namespace Simulator::Cfg
 
 #endif  // SIMULATOR_CFG_API_CFG_HPP_
@@ -13,6 +13,7 @@
 #include <string_view>
 
 #include "api/cfg.hpp"
+#include "src/value_parsing.hpp"
 
 namespace Simulator::Cfg {
 namespace {
@@ -104,6 +105,10 @@ auto http() -> const HttpConfiguration& {
   return ConfigurationImpl::instance().http_;
 }
 
+auto persistence() -> const PersistenceConfiguration& {
+  return ConfigurationImpl::instance().persistence_;
+}
+
 auto ConfigurationImpl::instance(bool mock, const std::string& path)
     -> ConfigurationImpl& {
   std::call_once(config_init_flag, [mock, &path]() -> void {
@@ -153,6 +158,9 @@ ConfigurationImpl::ConfigurationImpl(std::string const& path) {
 
   auto* http = root->FirstChildElement("http");
   init_http_configuration(http);
+
+  auto* persistence = root->FirstChildElement("persistence");
+  init_persistence_configuration(persistence);
 }
 
 auto ConfigurationImpl::init_db_configuration(
@@ -211,6 +219,38 @@ auto ConfigurationImpl::init_generator_configuration(
   }
 
   set_config(element, generator_.enableTracing, "enableTracing", false);
+  set_config(
+      element, generator_.tracingSampleRate, "tracingSampleRate", false);
+  if (generator_.tracingSampleRate <= 0) {
+    throw std::runtime_error(
+        "tracingSampleRate must be integer value greater than 0");
+  }
+  set_config(element, generator_.batchInterval, "batchInterval", false);
+
+  std::string random_seed;
+  if (set_config(element, random_seed, "randomSeed", false) &&
+      !random_seed.empty()) {
+    generator_.randomSeed = parse_random_seed(random_seed);
+  }
+
+  std::string replay_speed;
+  if (set_config(element, replay_speed, "replaySpeed", false)) {
+    generator_.replaySpeed = parse_replay_speed(replay_speed);
+  }
+
+  std::string historical_fetch_size;
+  if (set_config(
+          element, historical_fetch_size, "historicalFetchSize", false)) {
+    generator_.historicalFetchSize = std::stoi(historical_fetch_size);
+  }
+  set_config(
+      element, generator_.historicalPartitions, "historicalPartitions", false);
+  if (generator_.historicalFetchSize.value_or(1) <= 0 ||
+      generator_.historicalPartitions <= 0) {
+    throw std::runtime_error(
+        "historicalFetchSize and historicalPartitions must be integer value "
+        "greater than 0");
+  }
 }
 
 auto ConfigurationImpl::init_http_configuration(
@@ -239,6 +279,22 @@ auto ConfigurationImpl::init_http_configuration(
   set_config(element, http_.check_api_version, "checkApiVersion", false);
 }
 
+auto ConfigurationImpl::init_persistence_configuration(
+    const tinyxml2::XMLElement* element) -> void {
+  if (element == nullptr) {
+    return;
+  }
+
+  set_config(element, persistence_.compact_snapshot, "compactSnapshot", false);
+  set_config(
+      element, persistence_.snapshot_interval, "snapshotInterval", false);
+  set_config(element, persistence_.journal, "journal", false);
+  set_config(element,
+             persistence_.journal_checkpoint_records,
+             "journalCheckpointRecords",
+             false);
+}
+
 std::unique_ptr<ConfigurationImpl> ConfigurationImpl::configuration_instance{
     nullptr};
 
@@ -33,6 +33,8 @@ class ConfigurationImpl {
 
   HttpConfiguration http_;
 
+  PersistenceConfiguration persistence_;
+
  private:
   auto init_db_configuration(const tinyxml2::XMLElement* element) -> void;
 
@@ -47,6 +49,9 @@ class ConfigurationImpl {
 
   auto init_http_configuration(const tinyxml2::XMLElement* element) -> void;
 
+  auto init_persistence_configuration(const tinyxml2::XMLElement* element)
+      -> void;
+
   static std::unique_ptr<ConfigurationImpl> configuration_instance;
   static std::once_flag config_init_flag;
 };
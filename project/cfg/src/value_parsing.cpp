@@ -0,0 +1,47 @@
+#include "src/value_parsing.hpp"
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+namespace Simulator::Cfg {
+
+auto parse_random_seed(std::string_view value) -> std::uint64_t {
+  std::uint64_t seed{0};
+  const auto* const end = value.data() + value.size();
+  // std::from_chars rejects a sign for unsigned types,
+  // thus negative seeds are not wrapped around.
+  const auto [parsed_end, error] =
+      std::from_chars(value.data(), end, seed);
+  if (value.empty() || error != std::errc{} || parsed_end != end) {
+    throw std::runtime_error(fmt::format(
+        "randomSeed must be a non-negative integer value, `{}' is given",
+        value));
+  }
+  return seed;
+}
+
+auto parse_replay_speed(std::string_view value) -> double {
+  if (value == "max") {
+    return 0.;
+  }
+
+  double speed{0.};
+  const auto* const end = value.data() + value.size();
+  const auto [parsed_end, error] =
+      std::from_chars(value.data(), end, speed);
+  if (value.empty() || error != std::errc{} || parsed_end != end ||
+      !std::isfinite(speed) || speed <= 0.) {
+    throw std::runtime_error(fmt::format(
+        "replaySpeed must be `max' or a positive number, `{}' is given",
+        value));
+  }
+  return speed;
+}
+
+}  // namespace Simulator::Cfg
@@ -0,0 +1,20 @@
+#ifndef SIMULATOR_CFG_SRC_VALUE_PARSING_HPP_
+#define SIMULATOR_CFG_SRC_VALUE_PARSING_HPP_
+
+#include <cstdint>
+#include <string_view>
+
+namespace Simulator::Cfg {
+
+// Parses a non-negative integer seed, which must make up the whole value.
+// Throws std::runtime_error when the value is not a valid seed.
+auto parse_random_seed(std::string_view value) -> std::uint64_t;
+
+// Parses a replay speed, which is either `max` or a positive finite number
+// making up the whole value. The `max` speed is represented by 0.
+// Throws std::runtime_error when the value is not a valid speed.
+auto parse_replay_speed(std::string_view value) -> double;
+
+}  // namespace Simulator::Cfg
+
+#endif  // SIMULATOR_CFG_SRC_VALUE_PARSING_HPP_
@@ -0,0 +1,6 @@
+#include <gtest/gtest.h>
+
+auto main(int argc, char **argv) -> int {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "src/value_parsing.hpp"
+
+namespace Simulator::Cfg {
+namespace {
+
+TEST(CfgValueParsing, ParsesRandomSeed) {
+  ASSERT_EQ(parse_random_seed("0"), 0);
+  ASSERT_EQ(parse_random_seed("42"), 42);
+  ASSERT_EQ(parse_random_seed("18446744073709551615"),
+            18446744073709551615ULL);
+}
+
+TEST(CfgValueParsing, RejectsNegativeRandomSeed) {
+  ASSERT_THROW(parse_random_seed("-1"), std::runtime_error);
+}
+
+TEST(CfgValueParsing, RejectsMalformedRandomSeed) {
+  ASSERT_THROW(parse_random_seed(""), std::runtime_error);
+  ASSERT_THROW(parse_random_seed("42x"), std::runtime_error);
+  ASSERT_THROW(parse_random_seed(" 42"), std::runtime_error);
+  ASSERT_THROW(parse_random_seed("18446744073709551616"), std::runtime_error);
+}
+
+TEST(CfgValueParsing, ParsesReplaySpeed) {
+  ASSERT_DOUBLE_EQ(parse_replay_speed("1"), 1.);
+  ASSERT_DOUBLE_EQ(parse_replay_speed("1.5"), 1.5);
+  ASSERT_DOUBLE_EQ(parse_replay_speed("60"), 60.);
+}
+
+TEST(CfgValueParsing, ParsesMaxReplaySpeed) {
+  ASSERT_DOUBLE_EQ(parse_replay_speed("max"), 0.);
+}
+
+TEST(CfgValueParsing, RejectsNonPositiveReplaySpeed) {
+  ASSERT_THROW(parse_replay_speed("0"), std::runtime_error);
+  ASSERT_THROW(parse_replay_speed("-1"), std::runtime_error);
+}
+
+TEST(CfgValueParsing, RejectsMalformedReplaySpeed) {
+  ASSERT_THROW(parse_replay_speed(""), std::runtime_error);
+  ASSERT_THROW(parse_replay_speed("1.5x"), std::runtime_error);
+  ASSERT_THROW(parse_replay_speed("MAX"), std::runtime_error);
+  ASSERT_THROW(parse_replay_speed("inf"), std::runtime_error);
+  ASSERT_THROW(parse_replay_speed("nan"), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace Simulator::Cfg
@@ -124,10 +124,28 @@ template <typename Duration>
   return core::local_time<Duration>(time.time_since_epoch());
 }
 
+// A source of the current system time, which replaces the system clock
+// for the whole process, e.g. with a simulated clock of a historical replay.
+class SystemTimeSource {
+ public:
+  SystemTimeSource() = default;
+  SystemTimeSource(const SystemTimeSource&) = default;
+  SystemTimeSource(SystemTimeSource&&) noexcept = default;
+  virtual ~SystemTimeSource() = default;
+
+  auto operator=(const SystemTimeSource&) -> SystemTimeSource& = default;
+  auto operator=(SystemTimeSource&&) noexcept -> SystemTimeSource& = default;
+
+  [[nodiscard]]
+  virtual auto system_time() const noexcept -> core::sys_us = 0;
+};
+
+// Makes the current system time be read from the given source, which has to
+// stay alive until it is reset. A null source restores the system clock.
+auto use_system_time_source(const SystemTimeSource* source) noexcept -> void;
+
 [[nodiscard]]
-inline auto get_current_system_time() noexcept -> core::sys_us {
-  return core::to_time(std::chrono::system_clock::now());
-}
+auto get_current_system_time() noexcept -> core::sys_us;
 
 [[nodiscard]]
 inline auto get_current_system_date() noexcept -> core::sys_days {
@@ -4,11 +4,15 @@
 #include <date/tz.h>
 #include <fmt/format.h>
 
+#include <atomic>
+#include <chrono>
 #include <stdexcept>
 
 namespace simulator::core {
 namespace {
 
+std::atomic<const SystemTimeSource*> system_time_source{nullptr};
+
 auto erase_time_info(TzClock::time_point time) {
   return date::local_time(time.time_since_epoch());
 }
@@ -72,7 +76,7 @@ auto operator==(const TzClock& lhs, const TzClock& rhs) noexcept -> bool {
 TzClock::~TzClock() noexcept = default;
 
 auto TzClock::now(const TzClock& clock) -> time_point {
-  return to_timezone(std::chrono::system_clock::now(), clock);
+  return to_timezone(get_current_system_time(), clock);
 }
 
 auto TzClock::to_timezone(std::chrono::system_clock::time_point time,
@@ -97,4 +101,15 @@ auto TzClock::from_timezone(time_point time, const TzClock& clock)
   return ztime.get_sys_time();
 }
 
-}  // namespace simulator::core
\ No newline at end of file
+auto use_system_time_source(const SystemTimeSource* source) noexcept -> void {
+  system_time_source.store(source, std::memory_order_release);
+}
+
+auto get_current_system_time() noexcept -> core::sys_us {
+  const SystemTimeSource* source =
+      system_time_source.load(std::memory_order_acquire);
+  return source != nullptr ? source->system_time()
+                           : core::to_time(std::chrono::system_clock::now());
+}
+
+}  // namespace simulator::core
@@ -98,5 +98,31 @@ TEST(TimeTest, TzTimeCorrectlyFormatted) {
             "2024-09-18 17:32:55.000000000");
 }
 
+struct FixedTimeSource : SystemTimeSource {
+  [[nodiscard]]
+  auto system_time() const noexcept -> sys_us override {
+    return sys_us{1726673575s};
+  }
+};
+
+TEST(TimeTest, CurrentSystemTimeIsReadFromTimeSource) {
+  const FixedTimeSource source;
+
+  use_system_time_source(&source);
+  const auto current_time = get_current_system_time();
+  const auto current_tz_time = TzClock::now(TzClock{"Europe/Warsaw"});
+  use_system_time_source(nullptr);
+
+  ASSERT_EQ(current_time, source.system_time());
+  ASSERT_EQ(fmt::to_string(current_tz_time), "2024-09-18 17:32:55.000000000");
+}
+
+TEST(TimeTest, CurrentSystemTimeIsReadFromSystemClockWithoutTimeSource) {
+  const auto before = to_time(std::chrono::system_clock::now());
+  const auto current_time = get_current_system_time();
+
+  ASSERT_LE(before, current_time);
+}
+
 }  // namespace
 }  // namespace simulator::core
\ No newline at end of file
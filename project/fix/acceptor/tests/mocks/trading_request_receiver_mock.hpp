@@ -14,7 +14,12 @@ struct TradingRequestReceiverMock : public middleware::TradingRequestReceiver {
   MOCK_METHOD(void, process, (protocol::OrderCancellationRequest));
   MOCK_METHOD(void, process, (protocol::MarketDataRequest));
   MOCK_METHOD(void, process, (protocol::SecurityStatusRequest));
+  MOCK_METHOD(void, process, (protocol::OrderRequestBatch));
   MOCK_METHOD(void, process, (const protocol::InstrumentStateRequest&, protocol::InstrumentState&));
+  MOCK_METHOD(void, process, (const protocol::InstrumentHandleRequest&, protocol::InstrumentHandleReply&));
+  MOCK_METHOD(void, process, (protocol::ResolvedOrderRequests));
+  MOCK_METHOD(void, process, (protocol::ResolvedOrderRequest));
+  MOCK_METHOD(void, process, (const protocol::EngineLoadRequest&, protocol::EngineLoadReply&));
   // clang-format on
 };
 
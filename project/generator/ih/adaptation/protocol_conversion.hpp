@@ -4,6 +4,7 @@
 #include "core/domain/instrument_descriptor.hpp"
 #include "data_layer/api/models/listing.hpp"
 #include "ih/adaptation/generated_message.hpp"
+#include "ih/adaptation/request_prototypes.hpp"
 #include "protocol/app/execution_report.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
@@ -19,18 +20,15 @@ namespace Simulator::Generator {
     const DataLayer::Listing& listing) -> simulator::InstrumentDescriptor;
 
 [[nodiscard]] auto convert_to_order_placement_request(
-    const GeneratedMessage& message,
-    const simulator::InstrumentDescriptor& instrument)
+    const GeneratedMessage& message, const RequestPrototypes& prototypes)
     -> simulator::protocol::OrderPlacementRequest;
 
 [[nodiscard]] auto convert_to_order_modification_request(
-    const GeneratedMessage& message,
-    const simulator::InstrumentDescriptor& instrument)
+    const GeneratedMessage& message, const RequestPrototypes& prototypes)
     -> simulator::protocol::OrderModificationRequest;
 
 [[nodiscard]] auto convert_to_order_cancellation_request(
-    const GeneratedMessage& message,
-    const simulator::InstrumentDescriptor& instrument)
+    const GeneratedMessage& message, const RequestPrototypes& prototypes)
     -> simulator::protocol::OrderCancellationRequest;
 
 [[nodiscard]]
@@ -0,0 +1,89 @@
+#ifndef SIMULATOR_GENERATOR_IH_ADAPTATION_REQUEST_PROTOTYPES_HPP_
+#define SIMULATOR_GENERATOR_IH_ADAPTATION_REQUEST_PROTOTYPES_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "core/domain/attributes.hpp"
+#include "core/domain/instrument_descriptor.hpp"
+#include "core/domain/party.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
+#include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_modification_request.hpp"
+#include "protocol/app/order_placement_request.hpp"
+
+namespace Simulator::Generator {
+
+// Immutable requests of an instrument, which are built once with
+// a generator session and the instrument descriptor. A request of
+// a generated message is made by copying a prototype, after which only
+// the order attributes of the message have to be filled.
+// The instrument descriptor is shared by the prototypes and everything
+// else which refers to the instrument, and parties of orders are
+// converted once per counterparty.
+class RequestPrototypes {
+ public:
+  explicit RequestPrototypes(
+      std::shared_ptr<const simulator::InstrumentDescriptor> instrument);
+
+  explicit RequestPrototypes(simulator::InstrumentDescriptor instrument);
+
+  [[nodiscard]]
+  auto instrument() const noexcept -> const simulator::InstrumentDescriptor& {
+    return *instrument_;
+  }
+
+  [[nodiscard]]
+  auto shared_instrument() const noexcept
+      -> const std::shared_ptr<const simulator::InstrumentDescriptor>& {
+    return instrument_;
+  }
+
+  [[nodiscard]]
+  auto placement() const noexcept
+      -> const simulator::protocol::OrderPlacementRequest& {
+    return placement_;
+  }
+
+  [[nodiscard]]
+  auto modification() const noexcept
+      -> const simulator::protocol::OrderModificationRequest& {
+    return modification_;
+  }
+
+  [[nodiscard]]
+  auto cancellation() const noexcept
+      -> const simulator::protocol::OrderCancellationRequest& {
+    return cancellation_;
+  }
+
+  // Returns the parties of an order of the counterparty, the parties are
+  // converted on the first request for the counterparty and kept after.
+  [[nodiscard]]
+  auto order_parties(const simulator::PartyId& party_id) const
+      -> const std::vector<simulator::Party>&;
+
+ private:
+  std::shared_ptr<const simulator::InstrumentDescriptor> instrument_;
+  simulator::protocol::OrderPlacementRequest placement_;
+  simulator::protocol::OrderModificationRequest modification_;
+  simulator::protocol::OrderCancellationRequest cancellation_;
+
+  mutable std::map<simulator::PartyId, std::vector<simulator::Party>>
+      order_parties_;
+  mutable std::mutex order_parties_lock_;
+};
+
+// Resolves the instrument of the prototypes in the trading system, returns
+// none if the instrument can not be resolved, in which case the requests
+// have to be sent with the instrument descriptor.
+[[nodiscard]]
+auto resolve_instrument_handle(const RequestPrototypes& prototypes) noexcept
+    -> std::optional<simulator::protocol::InstrumentHandle>;
+
+}  // namespace Simulator::Generator
+
+#endif  // SIMULATOR_GENERATOR_IH_ADAPTATION_REQUEST_PROTOTYPES_HPP_
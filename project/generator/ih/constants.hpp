@@ -1,6 +1,9 @@
 #ifndef SIMULATOR_GENERATOR_IH_CONSTANTS_HPP_
 #define SIMULATOR_GENERATOR_IH_CONSTANTS_HPP_
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 
 #include "core/domain/attributes.hpp"
@@ -29,6 +32,16 @@ constexpr bool DefaultListingRandomOrdersEnabled = true;
 constexpr std::uint32_t DefaultListingTickRange = 10;
 constexpr double DefaultListingPriceTickSize = 0.;
 
+// A trading engine is saturated when it has more commands waiting or its
+// oldest waiting command has been waiting longer, than the limits below.
+constexpr std::uint64_t EngineSaturationQueueDepth = 1024;
+constexpr std::chrono::microseconds EngineSaturationRequestAge { 50'000 };
+// The maximal factor a generation interval is stretched by under saturation.
+constexpr std::uint32_t MaxGenerationSlowdown = 64;
+// The load of a trading engine is queried at most once per the interval,
+// generations in between reuse the decision made on the last query.
+constexpr std::chrono::microseconds EngineLoadProbeInterval { 10'000 };
+
 namespace Historical {
 namespace Column {
 
@@ -55,6 +68,19 @@ constexpr std::string_view DefaultCounterpartyPattern{"CP{}"};
 
 constexpr std::uint32_t AllDepthLevels{0};
 
+// The maximal number of parsed rows a streaming reader keeps ahead of replay.
+constexpr std::size_t ReadAheadRecordsCount{4096};
+
+// The number of rows fetched from a database datasource per round trip.
+constexpr std::uint32_t DatabaseFetchRowsCount{10000};
+
+// The percentage of table pages sampled to split a database datasource
+// into partitions.
+constexpr double DatabasePartitionSamplePercent{1.0};
+
+// The interval at which records held back by saturated engines are retried.
+constexpr std::chrono::microseconds HeldRecordsRetryInterval{10'000};
+
 } // namespace Historical
 
 } // namespace Simulator::Generator::Constant
@@ -3,9 +3,11 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 
 #include "data_layer/api/models/venue.hpp"
@@ -63,13 +65,21 @@ class IdentifierGenerator
 {
 public:
 
+    // Starts identifiers from the current time
     IdentifierGenerator();
 
+    // Makes a separate stream of identifiers, which include the stream id
+    // (e.g. an instrument identifier) to be unique across streams.
+    // Identifiers start from a value derived from the seed, so that a seeded
+    // generation produces the same identifiers of a stream on each run.
+    IdentifierGenerator(std::uint64_t _seed, std::uint64_t _streamId) noexcept;
+
     std::string generateIdentifier() noexcept;
 
 private:
 
     std::atomic<std::size_t> m_nextIdentifier;
+    std::optional<std::uint64_t> m_streamId;
 };
 
 
@@ -6,6 +6,7 @@
 #include "core/domain/instrument_descriptor.hpp"
 #include "data_layer/api/models/listing.hpp"
 #include "data_layer/api/models/venue.hpp"
+#include "ih/adaptation/request_prototypes.hpp"
 #include "ih/registry/generated_orders_registry.hpp"
 
 namespace Simulator::Generator {
@@ -27,6 +28,11 @@ public:
 
     virtual simulator::InstrumentDescriptor const& getInstrumentDescriptor()
         const noexcept = 0;
+
+    // Requests of the instrument, into which generated messages are converted
+    [[nodiscard]]
+    virtual RequestPrototypes const & getRequestPrototypes()
+        const noexcept = 0;
 };
 
 
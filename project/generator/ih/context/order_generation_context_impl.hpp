@@ -2,9 +2,13 @@
 #define SIMULATOR_GENERATOR_SRC_CONTEXT_ORDER_GENERATION_CONTEXT_IMPL_HPP_
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 
+#include "ih/adaptation/request_prototypes.hpp"
 #include "ih/context/component_context.hpp"
+#include "ih/context/generation_manager.hpp"
 #include "ih/context/instrument_context.hpp"
 #include "ih/context/order_generation_context.hpp"
 #include "ih/context/order_market_data_provider.hpp"
@@ -25,13 +29,17 @@ public:
         ,   simulator::InstrumentDescriptor descriptor
         ,   std::shared_ptr<ComponentContext> _pGlobalContext
         ,   std::unique_ptr<GeneratedOrdersRegistry> _pGeneratedOrdersRegistry
+        ,   std::optional<std::uint64_t> _randomSeed = std::nullopt
     ) noexcept;
 
+    // With a random seed, the context generates identifiers from its own
+    // stream of the seed, otherwise identifiers of the global context are used.
     [[nodiscard]]
     static std::shared_ptr<OrderInstrumentContext> create(
             DataLayer::Listing const & _instrument
         ,   simulator::InstrumentDescriptor const & descriptor
         ,   std::shared_ptr<ComponentContext> _pGlobalContext
+        ,   std::optional<std::uint64_t> _randomSeed = std::nullopt
     );
 
 
@@ -47,6 +55,9 @@ public:
     simulator::InstrumentDescriptor const &
     getInstrumentDescriptor() const noexcept override;
 
+    [[nodiscard]]
+    RequestPrototypes const & getRequestPrototypes() const noexcept override;
+
     [[nodiscard]]
     std::size_t nextMessageNumber() noexcept override;
 
@@ -56,11 +67,14 @@ private:
 
     DataLayer::Listing m_instrument;
 
-    simulator::InstrumentDescriptor m_instrumentDescriptor;
+    // Keeps the instrument descriptor as well
+    RequestPrototypes m_requestPrototypes;
 
     std::shared_ptr<ComponentContext> m_pGlobalContext;
 
     std::unique_ptr<GeneratedOrdersRegistry> m_pInstrumentOrdersRegistry;
+
+    std::optional<IdentifierGenerator> m_idGenerator;
 };
 
 
@@ -95,6 +109,9 @@ public:
     simulator::InstrumentDescriptor const &
     getInstrumentDescriptor() const noexcept override;
 
+    [[nodiscard]]
+    RequestPrototypes const & getRequestPrototypes() const noexcept override;
+
     [[nodiscard]]
     std::size_t nextMessageNumber() noexcept override;
 
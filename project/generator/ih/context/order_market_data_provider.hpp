@@ -1,7 +1,11 @@
 #ifndef SIMULATOR_GENERATOR_IH_CONTEXT_ORDER_MARKET_DATA_PROVIDER_HPP_
 #define SIMULATOR_GENERATOR_IH_CONTEXT_ORDER_MARKET_DATA_PROVIDER_HPP_
 
+#include <cstdint>
+#include <optional>
+
 #include "core/domain/instrument_descriptor.hpp"
+#include "middleware/mirror/market_state_mirror.hpp"
 
 namespace Simulator::Generator {
 
@@ -17,10 +21,15 @@ class OrderMarketDataProvider {
   explicit OrderMarketDataProvider(
       simulator::InstrumentDescriptor order_instrument);
 
+  // Reads the state mirrored by the trading engine without blocking,
+  // requests the state from the engine until the mirror is published.
   [[nodiscard]] auto getMarketState() const -> MarketState;
 
  private:
+  [[nodiscard]] auto requestMarketState() const -> MarketState;
+
   simulator::InstrumentDescriptor instrument_descriptor_;
+  const simulator::middleware::MarketStateMirror* mirror_{nullptr};
 };
 
 }  // namespace Simulator::Generator
@@ -1,6 +1,12 @@
 #ifndef SIMULATOR_GENERATOR_IH_GENERATOR_HPP_
 #define SIMULATOR_GENERATOR_IH_GENERATOR_HPP_
 
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <variant>
+#include <vector>
+
 #include "ih/adaptation/protocol_conversion.hpp"
 #include "ih/generator_impl.hpp"
 #include "log/logging.hpp"
@@ -9,6 +15,7 @@
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
 #include "protocol/app/order_placement_reject.hpp"
+#include "protocol/app/order_reply_batch.hpp"
 
 namespace simulator::generator {
 
@@ -48,8 +55,60 @@ struct Generator::Implementation {
     handle_reply(reply);
   }
 
+  // Replies to consecutive messages of the same instrument
+  // are applied to the instrument's registry at once.
+  auto enrich(const protocol::OrderReplyBatch& replies) -> void {
+    std::vector<Simulator::Generator::GeneratedMessage> messages;
+    messages.reserve(replies.size());
+    std::optional<std::uint64_t> messages_instrument_id;
+
+    const auto flush_messages = [&] {
+      if (messages_instrument_id && !messages.empty()) {
+        generator_->process_replies(*messages_instrument_id, messages);
+      }
+      messages.clear();
+    };
+
+    for (const auto& reply : replies) {
+      std::visit(
+          [&](const auto& message) {
+            if constexpr (requires {
+                            Simulator::Generator::convert_to_generated_message(
+                                message);
+                          }) {
+              const auto instrument_id = requester_instrument_id(message);
+              if (!instrument_id) {
+                return;
+              }
+              if (instrument_id != messages_instrument_id) {
+                flush_messages();
+                messages_instrument_id = instrument_id;
+              }
+              // A reply, which can not be converted, is skipped
+              // without discarding the rest of the batch.
+              try {
+                messages.emplace_back(
+                    Simulator::Generator::convert_to_generated_message(
+                        message));
+              } catch (const std::exception& ex) {
+                log::warn("order generator failed to convert {}: {}",
+                          message,
+                          ex.what());
+              }
+            } else {
+              log::debug("order generator does not handle {}, skipping",
+                         message);
+            }
+          },
+          reply);
+    }
+
+    flush_messages();
+  }
+
  private:
-  auto handle_reply(const auto& reply) -> void {
+  static auto requester_instrument_id(const auto& reply)
+      -> std::optional<std::uint64_t> {
     const std::optional<RequesterInstrumentId> instrument_id =
         reply.instrument.requester_instrument_id;
     if (!instrument_id) {
@@ -57,12 +116,17 @@ struct Generator::Implementation {
           "received reply message without the requester instrument identifier, "
           "can not handle {}",
           reply);
-      return;
+      return std::nullopt;
     }
+    return static_cast<std::uint64_t>(*instrument_id);
+  }
 
-    generator_->process_reply(
-        static_cast<std::uint64_t>(*instrument_id),
-        Simulator::Generator::convert_to_generated_message(reply));
+  auto handle_reply(const auto& reply) -> void {
+    if (const auto instrument_id = requester_instrument_id(reply)) {
+      generator_->process_reply(
+          *instrument_id,
+          Simulator::Generator::convert_to_generated_message(reply));
+    }
   }
 
   using Generator = Simulator::Generator::GeneratorImpl;
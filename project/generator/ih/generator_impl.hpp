@@ -1,7 +1,9 @@
 #ifndef SIMULATOR_GENERATOR_SRC_GENERATOR_IMPL_HPP_
 #define SIMULATOR_GENERATOR_SRC_GENERATOR_IMPL_HPP_
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -11,6 +13,7 @@
 #include "ih/factory/executable_factory.hpp"
 #include "ih/random/instrument_generator.hpp"
 #include "ih/utils/executor.hpp"
+#include "ih/utils/generation_scheduler.hpp"
 
 namespace Simulator::Generator {
 
@@ -43,6 +46,10 @@ class GeneratorImpl final {
     auto process_reply(std::uint64_t instrument_id,
                        const GeneratedMessage& reply) -> void;
 
+    // Applies replies for a single instrument in one registry transaction.
+    auto process_replies(std::uint64_t instrument_id,
+                         std::span<const GeneratedMessage> replies) -> void;
+
    private:
     auto initializeInstruments() -> void;
 
@@ -55,7 +62,6 @@ class GeneratorImpl final {
     auto terminateGenerator() noexcept -> void;
 
 
-    std::vector<std::unique_ptr<Executor>> mListingsRandomGenerators;
     std::vector<std::shared_ptr<OrderInstrumentContext>> mOrderListingsContexts;
     std::unordered_map<std::uint64_t, std::shared_ptr<OrderInstrumentContext>> mContextLookup;
 
@@ -63,6 +69,8 @@ class GeneratorImpl final {
 
     std::shared_ptr<GenerationManager> mGenerationManager;
 
+    std::unique_ptr<GenerationScheduler> mRandomGenerationScheduler;
+
     std::unique_ptr<Executor> mHistoricalReplier;
     std::unique_ptr<InstrumentRandomGeneratorFactory> mRndExecutorFactory;
 
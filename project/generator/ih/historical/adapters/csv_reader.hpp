@@ -3,8 +3,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <memory>
-#include <vector>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
 
 #include <csv.hpp>
 
@@ -12,9 +16,13 @@
 #include "ih/historical/data/record.hpp"
 #include "ih/historical/mapping/params.hpp"
 #include "ih/historical/parsing/params.hpp"
+#include "ih/utils/ring_buffer.hpp"
 
 namespace Simulator::Generator::Historical {
 
+// Reads a CSV datasource lazily: rows are parsed by a background thread
+// into a bounded read-ahead buffer, so the memory consumed by the reader
+// does not depend on the size of the datasource.
 class CsvReader final : public DataAccessAdapter {
   public:
     CsvReader() = delete;
@@ -22,9 +30,24 @@ class CsvReader final : public DataAccessAdapter {
     CsvReader(
         Historical::CsvParsingParams _params,
         MappingParams _mappingParams,
-        csv::CSVReader& _reader
+        std::unique_ptr<csv::CSVReader> _pReader,
+        std::size_t _readAheadCapacity
     );
 
+    CsvReader(
+        Historical::CsvParsingParams _params,
+        MappingParams _mappingParams,
+        std::unique_ptr<csv::CSVReader> _pReader
+    );
+
+    CsvReader(CsvReader const&) = delete;
+    auto operator=(CsvReader const&) -> CsvReader& = delete;
+
+    CsvReader(CsvReader&&) = delete;
+    auto operator=(CsvReader&&) -> CsvReader& = delete;
+
+    ~CsvReader() override;
+
     static auto create(
         Historical::CsvParsingParams _parsingPrams,
         Historical::MappingParams _mappingParams
@@ -35,26 +58,45 @@ class CsvReader final : public DataAccessAdapter {
     ) -> csv::CSVFormat;
 
   private:
+    using SourceRow = std::pair<std::uint64_t, csv::CSVRow>;
+
+    struct ParsedRow {
+        Historical::Record::Builder builder;
+        std::exception_ptr error;
+    };
+
+    // Blocks until the reading thread has read the next row,
+    // has reached the end of the datasource or has failed to read it.
     [[nodiscard]]
     auto hasNextRecord() const noexcept -> bool override;
 
     auto parseNextRecord(Historical::Record::Builder& _builder) -> void override;
 
-    auto make_depth_config(const csv::CSVReader& _reader) const -> Mapping::DepthConfig;
+    auto make_depth_config() const -> Mapping::DepthConfig;
+
+    auto initMappingParams(Mapping::DepthConfig depth_config) -> void;
+
+    auto readNextDataRow() -> std::optional<SourceRow>;
 
-    auto initMappingParams(csv::CSVReader const& _reader, Mapping::DepthConfig depth_config) -> void;
+    auto parseRow(SourceRow const& _row) const -> ParsedRow;
 
-    auto loadCsvData(csv::CSVReader& _reader) -> void;
+    auto readAhead(std::stop_token const& _stopToken) noexcept -> void;
 
-    auto columns_number(const csv::CSVReader& reader) const -> std::uint32_t;
+    auto columns_number() const -> std::uint32_t;
 
     CsvParsingParams mParsingParams;
     MappingParams mMappingParams;
     std::uint32_t depth_{0};
 
-    std::vector<std::pair<std::uint64_t, csv::CSVRow>> mExtractedRows;
+    std::unique_ptr<csv::CSVReader> mReader;
+    std::uint64_t mRowSentinel{0};
+    std::optional<SourceRow> mFirstDataRow;
 
-    std::size_t mNextRowIdx{0};
+    RingBuffer<ParsedRow> mReadAheadBuffer;
+    // Set by the reading thread before the buffer is closed,
+    // reported to the consumer once the buffer is drained.
+    std::exception_ptr mReadError;
+    std::jthread mReadingThread;
 };
 
 } // namespace Simulator::Generator::Historical
@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <vector>
 
 #include "ih/historical/data/record.hpp"
@@ -16,6 +18,13 @@ class Datasource;
 
 namespace Simulator::Generator::Historical {
 
+// Reports that a datasource can not be read any further,
+// records which follow the failure are never delivered.
+class DataSourceReadError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
 class DataAccessAdapter {
   public:
     using RecordVisitor = std::function<void(Historical::Record)>;
@@ -30,9 +39,24 @@ class DataAccessAdapter {
 
     virtual ~DataAccessAdapter() = default;
 
-    void accept(RecordVisitor const& _visitor) noexcept;
+    // Throws DataSourceReadError when the datasource fails to be read.
+    void accept(RecordVisitor const& _visitor);
+
+    // Returns the next successfully parsed record, skipping malformed ones,
+    // or nullopt when the adapter has no more records.
+    // Throws DataSourceReadError when the datasource fails to be read.
+    [[nodiscard]]
+    auto next() -> std::optional<Record>;
+
+    // Returns the next record or nullopt when the adapter has no more records.
+    // Throws when a row can not be parsed or a record can not be constructed.
+    [[nodiscard]]
+    auto parseNext() -> std::optional<Record>;
 
   private:
+    // May block until the adapter knows whether the datasource has
+    // a next record. Returns true when the datasource has failed to be read,
+    // so that the failure is reported by parseNextRecord.
     [[nodiscard]]
     virtual auto hasNextRecord() const noexcept -> bool = 0;
 
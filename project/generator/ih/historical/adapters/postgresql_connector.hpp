@@ -1,20 +1,36 @@
 #ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_ADAPTERS_POSTGRESQL_CONNECTOR_HPP_
 #define SIMULATOR_GENERATOR_IH_HISTORICAL_ADAPTERS_POSTGRESQL_CONNECTOR_HPP_
 
+#include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <memory>
-#include <utility>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <pqxx/connection>
-#include <pqxx/row>
+#include <pqxx/result>
 
 #include "ih/historical/adapters/data_access_adapter.hpp"
+#include "ih/historical/data/record.hpp"
 #include "ih/historical/mapping/params.hpp"
 #include "ih/historical/parsing/params.hpp"
+#include "ih/utils/ring_buffer.hpp"
 
 namespace Simulator::Generator::Historical {
 
+// Streams a PostgreSQL table through server-side cursors: rows are fetched
+// in chunks of a configured size and parsed by background threads into
+// bounded read-ahead buffers, so a replay starts as soon as the first chunk
+// is fetched and the memory consumed does not depend on the table size.
+//
+// A table may be split into several receive time ranges (partitions),
+// each of which is read by a dedicated connection. Records of partitions
+// are returned one partition after another, ordered by receive time.
 class PostgresConnector : public Historical::DataAccessAdapter {
   public:
     PostgresConnector() = delete;
@@ -25,37 +41,106 @@ class PostgresConnector : public Historical::DataAccessAdapter {
         pqxx::connection _connection
     );
 
+    PostgresConnector(PostgresConnector const&) = delete;
+    auto operator=(PostgresConnector const&) -> PostgresConnector& = delete;
+
+    PostgresConnector(PostgresConnector&&) = delete;
+    auto operator=(PostgresConnector&&) -> PostgresConnector& = delete;
+
+    ~PostgresConnector() override;
+
     [[nodiscard]]
     static auto create(
         Historical::DatabaseParsingParams _params,
         Historical::MappingParams _mappingParams
     ) -> std::unique_ptr<PostgresConnector>;
 
+    // Selects receive times splitting the table into the number
+    // of partitions of about the same size. The times are percentiles
+    // of a sample of table pages, so that only the sample is sorted.
+    [[nodiscard]]
+    static auto makePartitionBoundsQuery(
+        std::string_view _table,
+        std::string_view _quotedTimeColumn,
+        std::uint32_t _partitions
+    ) -> std::string;
+
+    // Selects rows of a table, ordered by receive time when the time column
+    // is given, within the receive time range of the quoted bounds.
+    [[nodiscard]]
+    static auto makeCursorQuery(
+        std::string_view _table,
+        std::optional<std::string> const& _quotedTimeColumn,
+        std::optional<std::string> const& _quotedLowerBound,
+        std::optional<std::string> const& _quotedUpperBound
+    ) -> std::string;
+
   private:
+    struct ParsedRow {
+        Historical::Record::Builder builder;
+        std::exception_ptr error;
+    };
+
+    // A range of receive times, [lowerBound, upperBound), an absent bound
+    // leaves the range open from the corresponding side.
+    struct Partition {
+        explicit Partition(std::size_t _readAheadCapacity) :
+            readAheadBuffer{_readAheadCapacity}
+        {}
+
+        std::optional<std::string> lowerBound;
+        std::optional<std::string> upperBound;
+        RingBuffer<ParsedRow> readAheadBuffer;
+        // Set by the reading thread before the buffer is closed,
+        // reported to the consumer once the buffer is drained.
+        std::exception_ptr readError;
+    };
+
+    // Blocks until a reading thread has read the next row, all partitions
+    // have been read to the end or a partition has failed to be read.
     [[nodiscard]]
     auto hasNextRecord() const noexcept -> bool override;
 
     auto parseNextRecord(Record::Builder& _builder) -> void override;
 
+    auto describeTable(pqxx::connection& _databaseConnection) const
+        -> pqxx::result;
 
-    auto loadData(pqxx::connection& _databaseConnection) -> void;
+    auto make_depth_config(std::uint32_t columns_number) const
+        -> Mapping::DepthConfig;
 
-    auto make_depth_config(pqxx::connection& database_connection) const -> Mapping::DepthConfig;
+    auto initMappingParams(
+        pqxx::result const& _description,
+        Mapping::DepthConfig depth_config
+    ) -> void;
 
-    auto initMappingParams(Mapping::DepthConfig depth_config) -> void;
+    auto initPartitions(
+        pqxx::connection& _databaseConnection,
+        pqxx::result const& _description
+    ) -> void;
 
-    auto extractData() -> void;
+    auto parseRow(pqxx::row const& _row) const -> ParsedRow;
 
-    auto columns_number(pqxx::connection& database_connection) const -> std::uint32_t;
+    auto readAhead(
+        std::stop_token const& _stopToken,
+        Partition& _partition,
+        pqxx::connection _connection
+    ) noexcept -> void;
 
     MappingParams mMappingParams;
     DatabaseParsingParams mParsingParams;
     std::uint32_t depth_{0};
 
-    pqxx::result mData;
+    // The receive time column name, partitions are ordered by.
+    std::optional<std::string> mTimeColumn;
+
+    std::vector<std::unique_ptr<Partition>> mPartitions;
+    std::size_t mNextPartitionIdx{0};
+    // Rows are numbered by the consumer, as partitions are read
+    // concurrently and returned one after another.
+    std::uint64_t mRowNumber{0};
 
-    std::vector<std::pair<std::uint64_t, pqxx::row>> mExtractedRows;
-    std::uint64_t mNextRowIdx{0};
+    std::vector<std::jthread> mReadingThreads;
 };
 
 } // namespace Simulator::Generator::Historical
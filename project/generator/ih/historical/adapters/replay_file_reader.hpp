@@ -0,0 +1,87 @@
+#ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_ADAPTERS_REPLAY_FILE_READER_HPP_
+#define SIMULATOR_GENERATOR_IH_HISTORICAL_ADAPTERS_REPLAY_FILE_READER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ih/historical/adapters/data_access_adapter.hpp"
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/replay/replay_file.hpp"
+
+namespace Simulator::Generator::Historical {
+
+// Reads records of a compiled replay file (see ReplayFile), which is
+// memory-mapped on open, thus records are paged in by the OS on demand
+// and no parsing or column mapping is done while replaying.
+// The string table is decoded once on open, so records take their
+// instruments, sources and counterparties from the decoded strings.
+class ReplayFileReader final : public DataAccessAdapter {
+ public:
+  // Throws when the file can not be mapped or is not a valid replay file.
+  explicit ReplayFileReader(const std::string& path);
+
+  ReplayFileReader(const ReplayFileReader&) = delete;
+  auto operator=(const ReplayFileReader&) -> ReplayFileReader& = delete;
+
+  ReplayFileReader(ReplayFileReader&&) = delete;
+  auto operator=(ReplayFileReader&&) -> ReplayFileReader& = delete;
+
+  ~ReplayFileReader() override;
+
+  static auto create(const std::string& path)
+      -> std::unique_ptr<ReplayFileReader>;
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+ private:
+  [[nodiscard]]
+  auto hasNextRecord() const noexcept -> bool override;
+
+  auto parseNextRecord(Record::Builder& builder) -> void override;
+
+  auto validate(const std::string& path) -> void;
+
+  auto decode_strings() -> void;
+
+  template <typename T>
+  [[nodiscard]]
+  auto section(std::size_t offset) const noexcept -> const T*;
+
+  // Returns null for an absent string.
+  [[nodiscard]]
+  auto string(std::uint32_t id) const -> const std::string*;
+
+  [[nodiscard]]
+  auto level(std::size_t position) const -> Level;
+
+  void* mapping_{nullptr};
+  std::size_t mapping_size_{0};
+
+  ReplayFile::Header header_{};
+  ReplayFile::Layout layout_{};
+
+  const std::int64_t* receive_times_{nullptr};
+  const std::int64_t* message_times_{nullptr};
+  const std::uint64_t* source_rows_{nullptr};
+  const std::uint32_t* instruments_{nullptr};
+  const std::uint32_t* sources_{nullptr};
+  const std::uint64_t* levels_begin_{nullptr};
+  const double* bid_prices_{nullptr};
+  const double* bid_quantities_{nullptr};
+  const double* offer_prices_{nullptr};
+  const double* offer_quantities_{nullptr};
+  const std::uint32_t* bid_counterparties_{nullptr};
+  const std::uint32_t* offer_counterparties_{nullptr};
+  const ReplayFile::SourceEntry* source_table_{nullptr};
+  std::vector<std::string> strings_;
+
+  std::size_t next_record_{0};
+};
+
+}  // namespace Simulator::Generator::Historical
+
+#endif  // SIMULATOR_GENERATOR_IH_HISTORICAL_ADAPTERS_REPLAY_FILE_READER_HPP_
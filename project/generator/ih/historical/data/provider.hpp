@@ -2,13 +2,17 @@
 #define SIMULATOR_GENERATOR_SRC_HISTORICAL_PROVIDERS_DATA_PROVIDER_HPP_
 
 #include <chrono>
-#include <deque>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "ih/historical/adapters/data_access_adapter.hpp"
 #include "ih/historical/data/record.hpp"
+#include "ih/historical/data/record_store.hpp"
 #include "ih/historical/data/time.hpp"
+#include "ih/historical/replay/replay_clock.hpp"
 
 namespace Simulator::DataLayer {
 
@@ -50,20 +54,65 @@ class DataProvider {
     [[nodiscard]]
     auto getTimeOffset() const noexcept -> Historical::Duration;
 
+    // Makes time offsets relative to the replay clock instead of
+    // the wall clock.
+    auto useClock(std::shared_ptr<ReplayClock const> _pClock) noexcept -> void;
+
   protected:
     auto setTimeOffset(Historical::Duration _offset) noexcept -> void;
 
+    // Makes an offset which moves a historical time to the current time.
+    [[nodiscard]]
+    auto makeTimeOffset(Historical::Timepoint _historicalTime) const noexcept
+        -> Historical::Duration;
+
   private:
     virtual auto add(Historical::Record _record) -> void = 0;
 
+    // Called once all records of a datasource are added.
+    virtual auto onPrepared() -> void {}
+
     virtual auto pullInto(Action::Builder& _pulledActionBuilder) -> void = 0;
 
 
     std::optional<Historical::Duration> mOptTimeOffset;
+    std::shared_ptr<ReplayClock const> mClock;
+};
+
+class RepeatingProvider final : public Historical::DataProvider {
+  public:
+    RepeatingProvider();
+
+    [[nodiscard]]
+    auto isEmpty() const noexcept -> bool override;
+
+    auto initializeTimeOffset() noexcept -> void override;
+
+  private:
+    void add(Historical::Record _record) override;
+
+    void onPrepared() override;
+
+    void pullInto(Historical::Action::Builder& _pulledActionBuilder) override;
+
+
+    // Records are kept in a columnar store and are never removed,
+    // the cursor wraps around on each replay cycle. Pulled records
+    // are views of the stored ones.
+    std::shared_ptr<Historical::RecordStore> mRecords;
+    std::size_t mNextRecordIdx{0};
 };
 
-class FiniteProvider final : public Historical::DataProvider {
+// Pulls records from an owned data access adapter on demand instead of
+// preparing all datasource records in advance, so that a replay may start
+// before the datasource is read entirely. A failure to read the datasource
+// is thrown when the records are pulled, the provider is empty after it.
+class StreamingProvider final : public Historical::DataProvider {
   public:
+    explicit StreamingProvider(
+        std::unique_ptr<Historical::DataAccessAdapter> _pAdapter
+    );
+
     [[nodiscard]]
     auto isEmpty() const noexcept -> bool override;
 
@@ -76,24 +125,57 @@ class FiniteProvider final : public Historical::DataProvider {
         -> void override;
 
 
-    std::deque<Historical::Record> mRecords;
+    std::unique_ptr<Historical::DataAccessAdapter> mAdapter;
+    std::optional<Historical::Record> mNextRecord;
 };
 
-class RepeatingProvider final : public Historical::DataProvider {
+// Merges records of several datasources by their receive time, so that
+// a replay of multiple datasources keeps the historical order of records.
+// Records are pulled from adapters on demand, datasources are read
+// concurrently by read-ahead threads of their adapters.
+class MergingProvider final : public Historical::DataProvider {
   public:
+    using Adapters =
+        std::vector<std::unique_ptr<Historical::DataAccessAdapter>>;
+
+    explicit MergingProvider(Adapters _adapters);
+
+    MergingProvider(MergingProvider const&) = delete;
+    auto operator=(MergingProvider const&) -> MergingProvider& = delete;
+
+    MergingProvider(MergingProvider&&) = delete;
+    auto operator=(MergingProvider&&) -> MergingProvider& = delete;
+
+    ~MergingProvider() override;
+
     [[nodiscard]]
     auto isEmpty() const noexcept -> bool override;
 
     auto initializeTimeOffset() noexcept -> void override;
 
   private:
-    void add(Historical::Record _record) override;
+    class Source;
 
-    void pullInto(Historical::Action::Builder& _pulledActionBuilder) override;
+    auto add(Historical::Record _record) -> void override;
 
+    auto pullInto(Historical::Action::Builder& _pulledActionBuilder)
+        -> void override;
 
-    std::deque<Historical::Record> mRecords;
-    std::deque<Historical::Record> mProcessedRecords;
+    [[nodiscard]]
+    auto nextRecordTime() const noexcept -> Historical::Timepoint;
+
+    auto popNextRecord() -> Historical::Record;
+
+    [[nodiscard]]
+    auto receivedLater(std::size_t _lhs, std::size_t _rhs) const noexcept
+        -> bool;
+
+
+    std::vector<std::unique_ptr<Source>> mSources;
+    // A min-heap of indices of sources which have records left, ordered by
+    // receive times of their next records. Sources with equal receive times
+    // are ordered by their indices, to keep the merge deterministic.
+    std::vector<std::size_t> mSourcesHeap;
 };
 
 
@@ -113,6 +195,11 @@ class DataProvidersFactory {
     [[nodiscard]]
     virtual auto createProvider(DataLayer::Datasource const& _datasource) const
         -> std::unique_ptr<DataProvider> = 0;
+
+    [[nodiscard]]
+    virtual auto createMergingProvider(
+        std::vector<DataLayer::Datasource> const& _datasources
+    ) const -> std::unique_ptr<DataProvider> = 0;
 };
 
 
@@ -128,6 +215,13 @@ class DataProvidersFactoryImpl final : public DataProvidersFactory {
     auto createProvider(DataLayer::Datasource const& _datasource) const
         -> std::unique_ptr<DataProvider> override;
 
+    // Datasources are opened concurrently, a datasource which can not be
+    // opened is skipped. Throws when none of datasources can be opened.
+    [[nodiscard]]
+    auto createMergingProvider(
+        std::vector<DataLayer::Datasource> const& _datasources
+    ) const -> std::unique_ptr<DataProvider> override;
+
   private:
     std::unique_ptr<DataAccessAdapterFactory> mDataAdapterFactory;
 };
@@ -3,8 +3,10 @@
 
 #include <fmt/format.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -13,6 +15,8 @@
 
 namespace Simulator::Generator::Historical {
 
+class RecordStore;
+
 class Level {
  public:
   class Builder;
@@ -46,6 +50,25 @@ class Level {
   std::optional<double> offer_quantity_;
 };
 
+// Non-owning view of level attributes, which refers either to a level or
+// to a level kept in a RecordStore, so that levels are read without copying
+// their counterparties. Counterparties are null when absent. A view is valid
+// while the level or the store it refers to is alive.
+struct LevelView {
+  LevelView() = default;
+
+  // Implicit, so that a level is accepted wherever its view is read.
+  // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+  LevelView(const Level& level) noexcept;
+
+  std::optional<double> bid_price;
+  std::optional<double> bid_quantity;
+  const std::string* bid_counterparty{nullptr};
+  std::optional<double> offer_price;
+  std::optional<double> offer_quantity;
+  const std::string* offer_counterparty{nullptr};
+};
+
 class Level::Builder {
  public:
   auto with_bid_price(double px) noexcept -> Builder&;
@@ -83,6 +106,8 @@ class Record {
 
   using LevelStealer = std::function<void(std::uint64_t, Level)>;
   using LevelVisitor = std::function<void(std::uint64_t, const Level&)>;
+  using LevelViewVisitor =
+      std::function<void(std::uint64_t, const LevelView&)>;
 
   [[nodiscard]]
   auto instrument() const noexcept -> const std::string&;
@@ -107,16 +132,41 @@ class Record {
 
   auto steal_levels(const LevelStealer& stealer) -> void;
 
+  // Visits owning copies of levels, use visit_level_views
+  // unless a visitor has to keep a level.
   auto visit_levels(const LevelVisitor& visitor) const -> void;
 
+  auto visit_level_views(const LevelViewVisitor& visitor) const -> void;
+
+  // Creates a record which refers to the record stored in a columnar store
+  // instead of owning its levels and strings. Levels of such a record are
+  // viewed in the store, and are only built when visited or stolen
+  // as owning levels.
+  static auto view(std::shared_ptr<const RecordStore> store, std::size_t index)
+      -> Record;
+
  private:
+  // Attributes which are not changed once a record is parsed.
+  // They are shared between copies of a record, so that records replayed
+  // repeatedly are copied without copying their levels and strings.
+  // The content is modified only while it is not shared.
+  struct Content {
+    std::vector<Level> levels;
+
+    std::optional<std::string> source_name;
+    std::optional<std::string> source_conn;
+    std::string instrument;
+  };
+
   Record() = default;
 
-  std::vector<Level> levels_;
+  [[nodiscard]]
+  auto content() const noexcept -> const Content&;
 
-  std::optional<std::string> source_name_;
-  std::optional<std::string> source_conn_;
-  std::string instrument_;
+  std::shared_ptr<Content> content_;
+  // Set instead of the content when the record is a view of a stored record.
+  std::shared_ptr<const RecordStore> store_;
+  std::size_t store_index_{0};
 
   std::optional<Historical::Timepoint> message_time_;
   Historical::Timepoint received_time_;
@@ -151,6 +201,13 @@ class Record::Builder {
  private:
   static auto validate(const Builder& builder) -> void;
 
+  // Copies the content of a base record to be modified by the builder.
+  auto detach() -> void;
+
+  std::shared_ptr<Content> base_content_;
+  std::shared_ptr<const RecordStore> base_store_;
+  std::size_t base_store_index_{0};
+
   std::optional<std::string> instrument_;
   std::optional<std::string> source_name_;
   std::optional<std::string> source_conn_;
@@ -205,6 +262,8 @@ class Action::Builder {
 
 auto operator<<(std::ostream& os, const Level& level) -> std::ostream&;
 
+auto operator<<(std::ostream& os, const LevelView& level) -> std::ostream&;
+
 auto operator<<(std::ostream& os, const Record& record) -> std::ostream&;
 
 auto operator<<(std::ostream& os, const Action& action) -> std::ostream&;
@@ -220,6 +279,15 @@ struct fmt::formatter<Simulator::Generator::Historical::Level>
       -> decltype(context.out());
 };
 
+template <>
+struct fmt::formatter<Simulator::Generator::Historical::LevelView>
+    : fmt::formatter<std::string_view> {
+  using formattable = Simulator::Generator::Historical::LevelView;
+
+  auto format(const formattable& level, format_context& context) const
+      -> decltype(context.out());
+};
+
 template <>
 struct fmt::formatter<Simulator::Generator::Historical::Record>
     : fmt::formatter<std::string_view> {
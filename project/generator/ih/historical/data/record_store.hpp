@@ -0,0 +1,131 @@
+#ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_DATA_RECORD_STORE_HPP_
+#define SIMULATOR_GENERATOR_IH_HISTORICAL_DATA_RECORD_STORE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/data/time.hpp"
+
+namespace Simulator::Generator::Historical {
+
+// Keeps historical records column by column: timepoints, prices and
+// quantities are stored in plain arrays, instruments and counterparties
+// are interned, and datasource name and connection are stored once
+// per datasource.
+//
+// Records are read back as lightweight views (see Record::view),
+// which refer to the store instead of owning record attributes.
+// Levels are read through non-owning level views, an owning Level
+// is built only for callers, which keep a copy of it.
+class RecordStore : public std::enable_shared_from_this<RecordStore> {
+ public:
+  using Index = std::size_t;
+
+  // Counterparties of a viewed level point into the string table
+  // of the store.
+  using LevelView = Historical::LevelView;
+
+  static auto create() -> std::shared_ptr<RecordStore>;
+
+  auto add(const Record& record) -> void;
+
+  auto shrink_to_fit() -> void;
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  [[nodiscard]]
+  auto empty() const noexcept -> bool;
+
+  // Returns a view of the record at the given index.
+  [[nodiscard]]
+  auto record(Index index) const -> Record;
+
+  [[nodiscard]]
+  auto instrument(Index index) const noexcept -> const std::string&;
+
+  [[nodiscard]]
+  auto receive_time(Index index) const noexcept -> Historical::Timepoint;
+
+  [[nodiscard]]
+  auto message_time(Index index) const noexcept
+      -> std::optional<Historical::Timepoint>;
+
+  [[nodiscard]]
+  auto source_name(Index index) const noexcept
+      -> const std::optional<std::string>&;
+
+  [[nodiscard]]
+  auto source_connection(Index index) const noexcept
+      -> const std::optional<std::string>&;
+
+  [[nodiscard]]
+  auto source_row(Index index) const noexcept -> std::uint64_t;
+
+  [[nodiscard]]
+  auto levels_count(Index index) const noexcept -> std::size_t;
+
+  [[nodiscard]]
+  auto level_view(Index index, std::size_t level_idx) const noexcept
+      -> LevelView;
+
+  // Builds the level, copying its counterparties out of the string table.
+  [[nodiscard]]
+  auto level(Index index, std::size_t level_idx) const -> Level;
+
+  [[nodiscard]]
+  auto levels(Index index) const -> std::vector<Level>;
+
+ private:
+  using StringId = std::uint32_t;
+
+  struct Source {
+    std::optional<std::string> name;
+    std::optional<std::string> connection;
+  };
+
+  RecordStore() = default;
+
+  auto add_level(const LevelView& level) -> void;
+
+  auto intern(const std::string& value) -> StringId;
+
+  auto intern(const std::string* value) -> StringId;
+
+  auto intern_source(const Record& record) -> std::uint32_t;
+
+  [[nodiscard]]
+  auto lookup(StringId id) const noexcept -> const std::string*;
+
+  // Per-record columns.
+  std::vector<Historical::Timepoint> receive_times_;
+  std::vector<Historical::Timepoint> message_times_;
+  std::vector<bool> has_message_times_;
+  std::vector<std::uint64_t> source_rows_;
+  std::vector<StringId> instruments_;
+  std::vector<std::uint32_t> sources_;
+  // Levels of a record at index i are [levels_begin_[i], levels_begin_[i+1]).
+  std::vector<std::uint32_t> levels_begin_{0};
+
+  // Per-level columns, an absent price or quantity is stored as NaN.
+  std::vector<double> bid_prices_;
+  std::vector<double> bid_quantities_;
+  std::vector<StringId> bid_counterparties_;
+  std::vector<double> offer_prices_;
+  std::vector<double> offer_quantities_;
+  std::vector<StringId> offer_counterparties_;
+
+  std::vector<Source> source_table_;
+  std::vector<std::string> strings_;
+  std::unordered_map<std::string, StringId> string_ids_;
+};
+
+}  // namespace Simulator::Generator::Historical
+
+#endif  // SIMULATOR_GENERATOR_IH_HISTORICAL_DATA_RECORD_STORE_HPP_
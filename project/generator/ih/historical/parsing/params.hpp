@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_PARSING_PARAMS_HPP_
 #define SIMULATOR_GENERATOR_IH_HISTORICAL_PARSING_PARAMS_HPP_
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -139,9 +140,31 @@ class DatabaseParsingParams {
     table_name_ = std::move(name);
   }
 
+  // The number of rows fetched from the table per round trip.
+  [[nodiscard]]
+  auto fetch_size() const noexcept -> std::uint32_t {
+    return fetch_size_;
+  }
+
+  auto set_fetch_size(std::uint32_t size) noexcept -> void {
+    fetch_size_ = std::max<std::uint32_t>(size, 1);
+  }
+
+  // The number of receive time ranges the table is read by concurrently.
+  [[nodiscard]]
+  auto partitions() const noexcept -> std::uint32_t {
+    return partitions_;
+  }
+
+  auto set_partitions(std::uint32_t partitions) noexcept -> void {
+    partitions_ = std::max<std::uint32_t>(partitions, 1);
+  }
+
  private:
   GeneralDatasourceParams general_params_;
   std::string table_name_;
+  std::uint32_t fetch_size_{Constant::Historical::DatabaseFetchRowsCount};
+  std::uint32_t partitions_{1};
 };
 
 auto make_csv_parsing_params(const DataLayer::Datasource& datasource)
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -10,8 +11,11 @@
 
 #include "ih/context/instrument_context.hpp"
 #include "ih/historical/data/record.hpp"
+#include "ih/historical/record_applier.hpp"
 #include "ih/registry/generated_order_data.hpp"
 #include "ih/registry/generated_orders_registry.hpp"
+#include "ih/utils/engine_pacer.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 
 namespace Simulator::Generator::Historical {
 
@@ -28,6 +32,17 @@ class Processor {
     virtual ~Processor() = default;
 
     virtual auto process(Historical::Action _action) -> void = 0;
+
+    // Applies records held back while trading engines have been saturated,
+    // which engines have caught up since then.
+    virtual auto retryHeldRecords() -> void = 0;
+
+    // Applies all held records regardless of trading engines load,
+    // so that the last books of a finished replay are not lost.
+    virtual auto flushHeldRecords() -> void = 0;
+
+    [[nodiscard]]
+    virtual auto hasHeldRecords() const noexcept -> bool = 0;
 };
 
 class ActionProcessor : public Historical::Processor {
@@ -58,12 +73,56 @@ class ActionProcessor : public Historical::Processor {
         Contexts const& _availableContexts
     );
 
+    ActionProcessor(
+        Contexts const& _availableContexts,
+        EnginePacer::Limits _pacerLimits
+    );
+
 
     auto process(Historical::Action _action) -> void override;
 
+    auto retryHeldRecords() -> void override;
+
+    auto flushHeldRecords() -> void override;
+
+    [[nodiscard]]
+    auto hasHeldRecords() const noexcept -> bool override;
+
   private:
-    auto process(Historical::Record _record) const -> void;
+    // Replay state of an instrument, kept between records
+    struct InstrumentReplay {
+        // Orders placed by the previous record, against which
+        // the next record of the instrument is diffed
+        RecordApplier::Book book;
+        std::optional<simulator::protocol::InstrumentHandle> handle;
+        bool handleRequested{false};
+        EnginePacer enginePacer;
+        // The latest record, which has been held back while
+        // the instrument's engine has been saturated
+        std::optional<Historical::Record> heldRecord;
+    };
+
+    using InstrumentReplays = std::unordered_map<
+        OrderInstrumentContext const*,
+        InstrumentReplay>;
+
+    auto process(Historical::Record _record) -> void;
+
+    static auto apply(Historical::Record _record,
+                      ContextPointer const& _pContext,
+                      InstrumentReplay& _replay) -> void;
+
+    auto applyHeldRecords(bool _whenAdmitted) -> void;
+
+    static auto isEngineSaturated(
+        ContextPointer const& _pContext,
+        InstrumentReplay& _replay) -> bool;
+
+    auto replayOf(ContextPointer const& _pContext) -> InstrumentReplay&;
+
     ContextsRegistry mCtxRegistry;
+    EnginePacer::Limits mPacerLimits;
+    InstrumentReplays mReplays;
 };
 
 } // namespace Simulator::Generator::Historical
@@ -1,14 +1,18 @@
 #ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_RECORD_APPLIER_HPP_
 #define SIMULATOR_GENERATOR_IH_HISTORICAL_RECORD_APPLIER_HPP_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ih/adaptation/generated_message.hpp"
 #include "ih/context/instrument_context.hpp"
 #include "ih/historical/data/record.hpp"
+#include "ih/registry/generated_order_data.hpp"
 #include "ih/registry/generated_orders_registry.hpp"
 
 namespace Simulator::Generator::Historical {
@@ -16,36 +20,63 @@ namespace Simulator::Generator::Historical {
 class RecordApplier {
  public:
   struct Order;
+  struct Book;
   class RecordChecker;
 
   using ContextPointer = std::shared_ptr<OrderInstrumentContext>;
 
   RecordApplier() = delete;
 
+  // Levels, which match orders resting in the registry by side, price
+  // and quantity, do not produce messages.
   static auto apply(Historical::Record record, ContextPointer context) noexcept
       -> std::vector<GeneratedMessage>;
 
+  // Diffs the record against orders of the previous record of the same
+  // instrument kept in the book, so that unchanged levels are not looked up
+  // in the registry. The record is applied to the registry in a single
+  // transaction, which is not published if applying the record fails.
+  static auto apply(Historical::Record record,
+                    ContextPointer context,
+                    Book& book) noexcept -> std::vector<GeneratedMessage>;
+
  private:
-  explicit RecordApplier(ContextPointer context) noexcept;
+  RecordApplier(ContextPointer context,
+                GeneratedOrdersRegistry& registry,
+                Book& book) noexcept;
 
   auto process(Historical::Record record) -> void;
 
-  auto process(const Historical::Level& level, std::uint64_t level_idx) -> bool;
+  auto collect(const Historical::LevelView& level,
+               std::uint64_t level_idx,
+               std::vector<RecordApplier::Order>& orders) -> bool;
 
-  auto place_bid(const Historical::Level& level) -> bool;
+  auto collect_bid(const Historical::LevelView& level,
+                   std::vector<RecordApplier::Order>& orders) -> bool;
 
-  auto place_offer(const Historical::Level& level) -> bool;
+  auto collect_offer(const Historical::LevelView& level,
+                     std::vector<RecordApplier::Order>& orders) -> bool;
 
   auto place(RecordApplier::Order order) -> void;
 
+  [[nodiscard]]
+  auto is_booked(const RecordApplier::Order& order) const -> bool;
+
+  static auto is_unchanged(
+      const RecordApplier::Order& order,
+      const std::optional<GeneratedOrderData>& resting_order) noexcept -> bool;
+
   auto cancel(const GeneratedOrdersRegistry::Predicate& cancel_criteria)
       -> void;
 
+  auto cancel(const std::vector<GeneratedOrderData>& orders) -> void;
+
   auto cancel_bid_part() -> void;
 
   auto cancel_offer_part() -> void;
 
-  auto cancel_other_parties(const Historical::Record& record) -> void;
+  auto cancel_other_parties(const std::vector<RecordApplier::Order>& orders)
+      -> void;
 
   auto next_party_id() -> std::string;
 
@@ -53,6 +84,14 @@ class RecordApplier {
 
   ContextPointer context_;
 
+  GeneratedOrdersRegistry& registry_;
+
+  Book& book_;
+
+  // Set when the book holds orders resting in the registry,
+  // which has not been changed since the book was filled.
+  bool book_trusted_{false};
+
   std::uint64_t party_id_counter_{0};
 };
 
@@ -70,13 +109,25 @@ struct RecordApplier::Order {
   simulator::Side side;
 };
 
+// Orders placed by previous records of an instrument by their parties.
+// The book is trusted while the registry keeps the revision, with which
+// the last record has been applied, as any change made to the registry
+// meanwhile (a fill, for instance) may be not reflected in the book.
+struct RecordApplier::Book {
+  std::unordered_map<std::string, RecordApplier::Order> orders;
+  std::optional<std::uint64_t> registry_revision;
+};
+
 class RecordApplier::RecordChecker {
  public:
-  static auto is_processable(const Historical::Level& level) noexcept -> bool;
+  static auto is_processable(const Historical::LevelView& level) noexcept
+      -> bool;
 
-  static auto has_bid_part(const Historical::Level& level) noexcept -> bool;
+  static auto has_bid_part(const Historical::LevelView& level) noexcept
+      -> bool;
 
-  static auto has_offer_part(const Historical::Level& level) noexcept -> bool;
+  static auto has_offer_part(const Historical::LevelView& level) noexcept
+      -> bool;
 };
 
 }  // namespace Simulator::Generator::Historical
@@ -0,0 +1,68 @@
+#ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_REPLAY_REPLAY_CLOCK_HPP_
+#define SIMULATOR_GENERATOR_IH_HISTORICAL_REPLAY_REPLAY_CLOCK_HPP_
+
+#include <chrono>
+#include <mutex>
+
+#include "core/tools/time.hpp"
+#include "ih/historical/data/time.hpp"
+
+namespace Simulator::Generator::Historical {
+
+// A simulated clock of a historical replay. Replay time runs `speed` times
+// faster than the wall clock, so that historical records are replayed with
+// their intervals divided by the speed. In the max speed mode replay time
+// does not run by itself, but jumps to the time of each replayed action,
+// so that actions are replayed back-to-back without any waiting.
+//
+// Once installed as the system time source, the clock is read by trading
+// engines as well, so that order timestamps and Tick events follow
+// replay time. Thus the clock may be read from any thread.
+class ReplayClock : public simulator::core::SystemTimeSource {
+  public:
+    using WallClock = std::chrono::system_clock;
+
+    // A speed which enables the max speed mode.
+    static constexpr double MaxSpeed{0.};
+
+    // Replay time starts at the current wall clock time.
+    explicit ReplayClock(double _speed);
+
+    ReplayClock();
+
+    [[nodiscard]]
+    auto system_time() const noexcept -> simulator::core::sys_us override;
+
+    [[nodiscard]]
+    auto speed() const noexcept -> double;
+
+    [[nodiscard]]
+    auto isMaxSpeed() const noexcept -> bool;
+
+    [[nodiscard]]
+    auto now() const noexcept -> Historical::Timepoint;
+
+    // Returns a wall clock duration to wait until the given replay time comes.
+    [[nodiscard]]
+    auto timeUntil(Historical::Timepoint _replayTime) const noexcept
+        -> std::chrono::microseconds;
+
+    // Moves replay time forward to the given time, when the given time is
+    // later than the current replay time.
+    auto advanceTo(Historical::Timepoint _replayTime) noexcept -> void;
+
+  private:
+    [[nodiscard]]
+    auto elapsedReplayTime(WallClock::time_point _wallAnchor) const noexcept
+        -> WallClock::duration;
+
+    double mSpeed{1.};
+
+    mutable std::mutex mAnchorsLock;
+    WallClock::time_point mWallAnchor;
+    Historical::Timepoint mReplayAnchor;
+};
+
+} // namespace Simulator::Generator::Historical
+
+#endif // SIMULATOR_GENERATOR_IH_HISTORICAL_REPLAY_REPLAY_CLOCK_HPP_
@@ -0,0 +1,100 @@
+#ifndef SIMULATOR_GENERATOR_IH_HISTORICAL_REPLAY_REPLAY_FILE_HPP_
+#define SIMULATOR_GENERATOR_IH_HISTORICAL_REPLAY_REPLAY_FILE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace Simulator::Generator::Historical {
+
+class DataAccessAdapter;
+class RecordStore;
+
+// A replay file keeps pre-compiled records of a historical datasource
+// in a versioned column-oriented binary layout, which is memory-mapped
+// and read without any parsing or column mapping.
+//
+// The file starts with a Header, which is followed by sections aligned
+// by 8 bytes, in the order of the Layout members. All values are stored
+// in the native byte order of the machine which compiled the file.
+namespace ReplayFile {
+
+constexpr std::array<char, 8> Magic{'Q', 'S', 'R', 'E', 'P', 'L', 'A', 'Y'};
+
+constexpr std::uint32_t Version{1};
+
+constexpr std::uint32_t NoString = std::numeric_limits<std::uint32_t>::max();
+
+constexpr std::int64_t NoTime = std::numeric_limits<std::int64_t>::min();
+
+struct Header {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  // Reserved for format extensions, written as zero.
+  std::uint32_t flags;
+  std::uint64_t records_count;
+  std::uint64_t levels_count;
+  std::uint64_t sources_count;
+  std::uint64_t strings_count;
+  std::uint64_t strings_size;
+};
+
+static_assert(sizeof(Header) == 56);
+
+struct SourceEntry {
+  std::uint32_t name;
+  std::uint32_t connection;
+};
+
+// Byte offsets of the file sections, computed from the header counts.
+struct Layout {
+  // Per-record columns: timepoints are stored as nanoseconds since epoch,
+  // strings as indices in the string table.
+  std::size_t receive_times;  // int64_t[records]
+  std::size_t message_times;  // int64_t[records], NoTime when absent
+  std::size_t source_rows;    // uint64_t[records]
+  std::size_t instruments;    // uint32_t[records]
+  std::size_t sources;        // uint32_t[records], index in the source table
+  std::size_t levels_begin;   // uint64_t[records + 1]
+
+  // Per-level columns, an absent price or quantity is stored as NaN.
+  std::size_t bid_prices;            // double[levels]
+  std::size_t bid_quantities;        // double[levels]
+  std::size_t offer_prices;          // double[levels]
+  std::size_t offer_quantities;      // double[levels]
+  std::size_t bid_counterparties;    // uint32_t[levels]
+  std::size_t offer_counterparties;  // uint32_t[levels]
+
+  std::size_t source_table;    // SourceEntry[sources]
+  std::size_t string_offsets;  // uint64_t[strings + 1]
+  std::size_t string_data;     // char[strings_size]
+
+  std::size_t file_size;
+};
+
+[[nodiscard]]
+auto make_layout(const Header& header) noexcept -> Layout;
+
+// Tells whether a file at the given path starts with the replay file magic.
+[[nodiscard]]
+auto is_replay_file(const std::string& path) noexcept -> bool;
+
+// Writes the store into a replay file, which replaces the given file
+// only when it is completely written and synchronized to the storage.
+auto write(const RecordStore& store, const std::string& path) -> void;
+
+// Reads all records of the adapter and writes them into a replay file,
+// returns the number of compiled records. Unlike replaying a datasource,
+// compilation fails on the first row, which can not be parsed or mapped.
+// Records are not kept in memory: their columns are spilled to temporary
+// files next to the replay file, which are joined once all are read.
+auto compile(DataAccessAdapter& adapter, const std::string& path)
+    -> std::size_t;
+
+}  // namespace ReplayFile
+
+}  // namespace Simulator::Generator::Historical
+
+#endif  // SIMULATOR_GENERATOR_IH_HISTORICAL_REPLAY_REPLAY_FILE_HPP_
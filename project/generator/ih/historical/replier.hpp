@@ -10,6 +10,7 @@
 #include "ih/context/instrument_context.hpp"
 #include "ih/historical/data/provider.hpp"
 #include "ih/historical/processor.hpp"
+#include "ih/historical/replay/replay_clock.hpp"
 #include "ih/historical/scheduler.hpp"
 #include "ih/utils/executable.hpp"
 
@@ -23,11 +24,23 @@ class Replier : public Generator::Executable {
 
     Replier() = delete;
 
+    // A replay speed is a multiplier of historical time,
+    // ReplayClock::MaxSpeed replays actions back-to-back.
     Replier(
         Datasources const& _datasources,
-        InstrumentsContexts const& _instrumentsContexts
+        InstrumentsContexts const& _instrumentsContexts,
+        double _replaySpeed
     );
 
+    Replier(Replier const&) = delete;
+    auto operator=(Replier const&) -> Replier& = delete;
+
+    Replier(Replier&&) = delete;
+    auto operator=(Replier&&) -> Replier& = delete;
+
+    // Restores the system clock, if the replay clock has replaced it.
+    ~Replier() override;
+
     [[nodiscard]]
     auto finished() const noexcept -> bool override;
 
@@ -42,8 +55,10 @@ class Replier : public Generator::Executable {
     static auto createProvider(Datasources const& _datasources)
         -> std::unique_ptr<DataProvider>;
 
+    std::shared_ptr<ReplayClock> m_pClock;
     std::unique_ptr<Processor> m_pHistoricalProcessor;
     std::unique_ptr<Scheduler> m_pActionsScheduler;
+    bool m_clockInstalled{false};
 };
 
 } // namespace Simulator::Generator::Historical
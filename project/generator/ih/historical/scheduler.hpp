@@ -9,6 +9,7 @@
 
 #include "ih/historical/data/provider.hpp"
 #include "ih/historical/data/record.hpp"
+#include "ih/historical/replay/replay_clock.hpp"
 
 namespace Simulator::Generator::Historical {
 
@@ -42,8 +43,14 @@ class ActionsScheduler final : public Scheduler {
   public:
     ActionsScheduler() = delete;
 
+    // Replays actions in real time.
     explicit ActionsScheduler(std::unique_ptr<DataProvider> _provider);
 
+    ActionsScheduler(
+        std::unique_ptr<DataProvider> _provider,
+        std::shared_ptr<ReplayClock> _pClock
+    );
+
     [[nodiscard]]
     auto finished() const noexcept -> bool override;
 
@@ -70,6 +77,7 @@ class ActionsScheduler final : public Scheduler {
 
     std::deque<Historical::Action> mPendingActions;
     std::unique_ptr<Historical::DataProvider> mDataProvider;
+    std::shared_ptr<Historical::ReplayClock> mClock;
 };
 
 } // namespace Simulator::Generator::Historical
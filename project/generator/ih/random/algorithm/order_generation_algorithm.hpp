@@ -1,7 +1,9 @@
 #ifndef SIMULATOR_GENERATOR_SRC_ALGORITHM_ORDER_GENERATION_ALGORITHM_HPP_
 #define SIMULATOR_GENERATOR_SRC_ALGORITHM_ORDER_GENERATION_ALGORITHM_HPP_
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "ih/adaptation/generated_message.hpp"
 #include "ih/context/order_generation_context.hpp"
@@ -15,6 +17,7 @@
 #include "ih/random/values/event.hpp"
 #include "ih/random/values/resting_order_action.hpp"
 #include "ih/registry/generated_order_data.hpp"
+#include "ih/tracing/trace_sampler.hpp"
 
 namespace Simulator::Generator::Random {
 
@@ -30,12 +33,21 @@ private:
         ,   std::unique_ptr<RestingOrderActionGenerator> _pRestingActionGenerator
         ,   std::unique_ptr<PriceGenerator> _pPriceGenerator
         ,   std::unique_ptr<QuantityGenerator> _pQtyGenerator
+        ,   Trace::Sampler _traceSampler
     ) noexcept;
 
 public:
 
+    // Generations are traced as selected by the trace sampler,
+    // which is disabled by default.
+    // Random values are generated from a stream of the instrument within
+    // the sequence of streams defined by the random seed, so that
+    // a generation may be reproduced. Without a seed the stream is seeded
+    // from std::random_device.
     static std::unique_ptr<OrderGenerationAlgorithm> create(
-        std::shared_ptr<OrderGenerationContext> _pAlgorithmContext
+            std::shared_ptr<OrderGenerationContext> _pAlgorithmContext
+        ,   Trace::Sampler _traceSampler = Trace::Sampler {}
+        ,   std::optional<std::uint64_t> _randomSeed = std::nullopt
     );
 
     static std::unique_ptr<OrderGenerationAlgorithm> create(
@@ -45,6 +57,7 @@ public:
         ,   std::unique_ptr<RestingOrderActionGenerator> _pRestingActionGenerator
         ,   std::unique_ptr<PriceGenerator> _pPriceGenerator
         ,   std::unique_ptr<QuantityGenerator> _pQtyGenerator
+        ,   Trace::Sampler _traceSampler = Trace::Sampler {}
     );
 
 
@@ -153,6 +166,8 @@ private:
     std::unique_ptr<QuantityGenerator> m_pQtyGenerator;
 
     QuantityParamsSelector quantity_params_selector_;
+
+    Trace::Sampler m_traceSampler;
 };
 
 } // namespace Simulator::Generator::Random
@@ -53,12 +53,15 @@ inline void AttributesSetter::set(
     using namespace Trace;
     _msg.message_type = _messageType;
 
-    auto step = makeStep(_tracer, "specifying MessageType");
-    traceOutput(step, makeValue(
-            "message_type"
-        ,   fmt::format("{}", _msg.message_type)
-    ));
-    traceStep(std::move(step), _tracer);
+    if constexpr (IsRecording<Tracer>)
+    {
+        auto step = makeStep(_tracer, "specifying MessageType");
+        traceOutput(step, makeValue(
+                "message_type"
+            ,   fmt::format("{}", _msg.message_type)
+        ));
+        traceStep(std::move(step), _tracer);
+    }
 }
 
 
@@ -72,9 +75,13 @@ inline void AttributesSetter::set(
     using namespace Trace;
     _msg.order_type = _orderType;
 
-    auto step = makeStep(_tracer, "specifying OrderType");
-    traceOutput(step, makeValue("order_type", fmt::format("{}", _msg.order_type)));
-    traceStep(std::move(step), _tracer);
+    if constexpr (IsRecording<Tracer>)
+    {
+        auto step = makeStep(_tracer, "specifying OrderType");
+        traceOutput(step,
+                    makeValue("order_type", fmt::format("{}", _msg.order_type)));
+        traceStep(std::move(step), _tracer);
+    }
 }
 
 
@@ -88,9 +95,12 @@ void AttributesSetter::set(
     using namespace Trace;
     _msg.side = _orderSide;
 
-    auto step = makeStep(_tracer, "specifying Side");
-    traceOutput(step, makeValue("side", fmt::format("{}", _msg.side)));
-    traceStep(std::move(step), _tracer);
+    if constexpr (IsRecording<Tracer>)
+    {
+        auto step = makeStep(_tracer, "specifying Side");
+        traceOutput(step, makeValue("side", fmt::format("{}", _msg.side)));
+        traceStep(std::move(step), _tracer);
+    }
 }
 
 
@@ -104,12 +114,15 @@ inline void AttributesSetter::set(
     using namespace Trace;
     _msg.time_in_force = _timeInForce;
 
-    auto step = makeStep(_tracer, "specifying TimeInForce");
-    traceOutput(step, makeValue(
-            "time_in_force"
-        ,   fmt::format("{}", _msg.time_in_force)
-    ));
-    traceStep(std::move(step), _tracer);
+    if constexpr (IsRecording<Tracer>)
+    {
+        auto step = makeStep(_tracer, "specifying TimeInForce");
+        traceOutput(step, makeValue(
+                "time_in_force"
+            ,   fmt::format("{}", _msg.time_in_force)
+        ));
+        traceStep(std::move(step), _tracer);
+    }
 }
 
 } // namespace Simulator::Generator::Random
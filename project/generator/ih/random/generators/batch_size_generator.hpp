@@ -0,0 +1,61 @@
+#ifndef SIMULATOR_GENERATOR_IH_RANDOM_GENERATORS_BATCH_SIZE_GENERATOR_HPP_
+#define SIMULATOR_GENERATOR_IH_RANDOM_GENERATORS_BATCH_SIZE_GENERATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ih/random/generators/xoshiro_engine.hpp"
+
+namespace Simulator::Generator::Random {
+
+// Draws sizes of generated batches from the Poisson distribution with
+// the mean equal to the number of messages expected per batch interval.
+// A generator, which is made with a seed, draws the same sizes on each run
+// with any standard library, as the distribution is sampled by the generator
+// itself rather than by std::poisson_distribution.
+// A generator is not thread-safe, each instrument owns a separate one.
+class BatchSizeGenerator
+{
+public:
+
+    // Seeds a generator from std::random_device
+    BatchSizeGenerator();
+
+    // Seeds a generator with a stream of the seed, identified by the stream
+    // id, which is distinct from the stream of values with the same id.
+    BatchSizeGenerator(std::uint64_t _seed, std::uint64_t _streamId) noexcept;
+
+    void setExpectedSize(double _expectedSize);
+
+    [[nodiscard]]
+    std::size_t generate();
+
+private:
+
+    // Constants of the transformed rejection sampling (PTRS) by W. Hormann,
+    // which are computed once per expected size.
+    struct RejectionParams
+    {
+        double a { 0. };
+        double b { 0. };
+        double logInvAlpha { 0. };
+        double vr { 0. };
+        double logMean { 0. };
+    };
+
+    // Multiplies uniform values until their product drops below e^-mean,
+    // used for small means.
+    std::size_t generateByMultiplication();
+
+    std::size_t generateByRejection();
+
+
+    XoshiroEngine m_engine;
+
+    double m_expectedSize { 1. };
+    RejectionParams m_rejection;
+};
+
+} // namespace Simulator::Generator::Random
+
+#endif // SIMULATOR_GENERATOR_IH_RANDOM_GENERATORS_BATCH_SIZE_GENERATOR_HPP_
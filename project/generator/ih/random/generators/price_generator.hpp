@@ -92,9 +92,12 @@ double PriceGenerator::generatePrice(
     traceInput(step,
         makeValue("priceSeedMid", mid_price)
     );
-    traceInput(step,
-        makeValue("currentSide", fmt::format("{}", _event.targetSide()))
-    );
+    if constexpr (IsRecording<Tracer>)
+    {
+        traceInput(step,
+            makeValue("currentSide", fmt::format("{}", _event.targetSide()))
+        );
+    }
 
     auto const [generatedPx, details] = generatePx(
             _params
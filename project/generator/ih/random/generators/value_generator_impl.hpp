@@ -1,22 +1,40 @@
 #ifndef SIMULATOR_GENERATOR_SRC_GENERATORS_RANDOM_VALUE_GENERATOR_HPP_
 #define SIMULATOR_GENERATOR_SRC_GENERATORS_RANDOM_VALUE_GENERATOR_HPP_
 
+#include <cstdint>
 #include <memory>
-#include <random>
 
 #include "ih/random/generators/value_generator.hpp"
+#include "ih/random/generators/xoshiro_engine.hpp"
 
 namespace Simulator::Generator::Random {
 
+// Generates values with a xoshiro256** engine. A generator, which is made
+// with a seed, generates the same sequence of values on each run, thus
+// a random generation may be reproduced by seed.
+// A generator is not thread-safe, each instrument owns a separate one.
 class ValueGeneratorImpl final
     :   public Random::ValueGenerator
 {
 public:
 
+    // Seeds a generator from std::random_device
     ValueGeneratorImpl();
 
+    explicit ValueGeneratorImpl(std::uint64_t _seed) noexcept;
+
     static std::shared_ptr<ValueGeneratorImpl> create();
 
+    static std::shared_ptr<ValueGeneratorImpl> create(std::uint64_t _seed);
+
+    // Creates a generator of a separate stream of values, identified by
+    // the stream id (e.g. an instrument identifier), within the sequence
+    // of streams defined by the seed.
+    static std::shared_ptr<ValueGeneratorImpl> create(
+            std::uint64_t _seed
+        ,   std::uint64_t _streamId
+    );
+
 private:
 
     RandomInt generateUniform(RandomInt _min, RandomInt _max) override;
@@ -28,8 +46,11 @@ private:
 
     RandomFloat generateUniform(RandomFloat _min, RandomFloat _max) override;
 
+    // Generates a value in [0, _range), or any value when _range is 0.
+    RandomUnsignedInt generateBelow(RandomUnsignedInt _range) noexcept;
+
 
-    std::mt19937 m_engine;
+    XoshiroEngine m_engine;
 };
 
 } // namespace Simulator::Generator::Random
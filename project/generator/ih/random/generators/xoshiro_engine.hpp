@@ -0,0 +1,112 @@
+#ifndef SIMULATOR_GENERATOR_IH_RANDOM_GENERATORS_XOSHIRO_ENGINE_HPP_
+#define SIMULATOR_GENERATOR_IH_RANDOM_GENERATORS_XOSHIRO_ENGINE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace Simulator::Generator::Random {
+
+// The xoshiro256** pseudo-random bits generator by D. Blackman and S. Vigna.
+// It is several times faster than std::mt19937_64, keeps 32 bytes of state
+// and satisfies the UniformRandomBitGenerator requirements.
+//
+// The state is expanded from a 64-bit seed with splitmix64, so that
+// close seeds (e.g. seeds derived from sequential instrument identifiers)
+// produce unrelated sequences.
+class XoshiroEngine
+{
+public:
+
+    using result_type = std::uint64_t;
+
+    explicit XoshiroEngine(std::uint64_t _seed) noexcept
+    {
+        for (auto & word : m_state)
+        {
+            word = splitMix(_seed);
+        }
+    }
+
+    // Draws a seed from std::random_device for engines, which are not seeded
+    // with a configured seed.
+    static std::uint64_t makeRandomSeed()
+    {
+        std::random_device device {};
+        std::uniform_int_distribution<std::uint64_t> distribution {};
+        return distribution(device);
+    }
+
+    static constexpr result_type min() noexcept
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept
+    {
+        result_type const result = rotateLeft(m_state[1] * 5, 7) * 9;
+        result_type const shifted = m_state[1] << 17;
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+
+        m_state[2] ^= shifted;
+        m_state[3] = rotateLeft(m_state[3], 45);
+
+        return result;
+    }
+
+    // Returns a double in [0, 1) made of the upper 53 bits of the next output,
+    // which is the same with any standard library.
+    double generateCanonical() noexcept
+    {
+        constexpr double Scale = 0x1.0p-53;
+        return static_cast<double>((*this)() >> 11) * Scale;
+    }
+
+    // Advances the given value and returns the next splitmix64 output.
+    static std::uint64_t splitMix(std::uint64_t & _value) noexcept
+    {
+        std::uint64_t mixed = (_value += 0x9E3779B97F4A7C15ULL);
+        mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+        return mixed ^ (mixed >> 31);
+    }
+
+    // Derives a seed of a separate stream, identified by the stream id
+    // (e.g. an instrument identifier), within the sequence of streams
+    // defined by the seed. The stream id is scrambled before being combined
+    // with the seed, so that streams of sequential ids do not share seed bits.
+    static std::uint64_t streamSeed(
+            std::uint64_t _seed
+        ,   std::uint64_t _streamId
+    ) noexcept
+    {
+        return _seed ^ splitMix(_streamId);
+    }
+
+private:
+
+    static constexpr std::uint64_t rotateLeft(
+            std::uint64_t _value
+        ,   int _bits
+    ) noexcept
+    {
+        return (_value << _bits) | (_value >> (64 - _bits));
+    }
+
+
+    std::array<std::uint64_t, 4> m_state {};
+};
+
+} // namespace Simulator::Generator::Random
+
+#endif // SIMULATOR_GENERATOR_IH_RANDOM_GENERATORS_XOSHIRO_ENGINE_HPP_
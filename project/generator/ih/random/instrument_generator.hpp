@@ -2,12 +2,17 @@
 #define SIMULATOR_GENERATOR_SRC_INSTRUMENT_GENERATOR_HPP_
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "ih/adaptation/generated_message.hpp"
 #include "ih/context/instrument_context.hpp"
 #include "ih/random/algorithm/generation_algorithm.hpp"
+#include "ih/random/generators/batch_size_generator.hpp"
+#include "ih/utils/engine_pacer.hpp"
 #include "ih/utils/executable.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 
 namespace Simulator::Generator::Random {
 
@@ -21,12 +26,17 @@ public:
     OrderGenerator(
             std::shared_ptr<OrderInstrumentContext> _pInstrumentContext
         ,   std::unique_ptr<GenerationAlgorithm> _pRandomGenerationAlgorithm
+        ,   std::chrono::microseconds _batchInterval = {}
+        ,   std::optional<std::uint64_t> _randomSeed = std::nullopt
     );
 
-    // An empty implementation.
-    // InstrumentGenerator has nothing to prepare before starting generation
+    // Resolves a handle of the instrument in the trading system,
+    // generated requests are sent to the resolved instrument directly.
+    // Requests are sent with the instrument descriptor when resolution fails.
     void prepare() noexcept override;
 
+    // Skips a generation and slows the generator down while
+    // the trading engine of the resolved instrument is saturated.
     void execute() override;
 
     bool finished() const noexcept override;
@@ -38,6 +48,16 @@ private:
 
     void initExecutionRate();
 
+    [[nodiscard]]
+    bool admitGeneration();
+
+    [[nodiscard]]
+    bool batched() const noexcept;
+
+    void executeBatch();
+
+    void send(simulator::protocol::OrderRequestBatch _batch);
+
 
     GeneratedMessage m_generatedMessage;
 
@@ -45,7 +65,18 @@ private:
 
     std::unique_ptr<GenerationAlgorithm> m_pGenerationAlgorithm;
 
+    std::optional<simulator::protocol::InstrumentHandle> m_instrumentHandle;
+
+    EnginePacer m_enginePacer;
+
     std::chrono::microseconds m_executionRate { 0 };
+
+    // In batched mode the generator wakes up once per batch interval
+    // and emits the number of messages drawn by the batch size generator.
+    std::chrono::microseconds m_batchInterval { 0 };
+
+    // Draws batch sizes from a stream of the random seed, if one is given.
+    BatchSizeGenerator m_batchSizeGenerator;
 };
 
 } // namespace Simulator::Generator::Random
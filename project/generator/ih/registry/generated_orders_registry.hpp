@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_GENERATOR_IH_REGISTRY_GENERATED_ORDERS_REGISTRY_HPP_
 #define SIMULATOR_GENERATOR_IH_REGISTRY_GENERATED_ORDERS_REGISTRY_HPP_
 
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <string_view>
@@ -24,6 +25,7 @@ public:
     using OrderData = GeneratedOrderData;
     using Visitor = std::function<void(OrderData const &)>;
     using Predicate = std::function<bool(OrderData const &)>;
+    using Transaction = std::function<void(GeneratedOrdersRegistry &)>;
 
 
     virtual ~GeneratedOrdersRegistry() = default;
@@ -77,6 +79,21 @@ public:
     virtual std::vector<OrderData> selectBy(
         Predicate const & _predicate
     ) const = 0;
+
+
+    /// Returns a revision of stored orders, which is increased each time
+    /// the container is changed. Changes of a transaction are published
+    /// at once, with the revision following the one the transaction
+    /// observes.
+    [[nodiscard]]
+    virtual std::uint64_t revision() const noexcept = 0;
+
+
+    /// Applies provided `_transaction` to the container, all operations
+    /// of the `_transaction` are performed under a single lock.
+    /// Please note: the container passed to a `_transaction` callback
+    /// must not be used after the callback returns.
+    virtual void transact(Transaction const & _transaction) = 0;
 };
 
 }// namespace Simulator::Generator
@@ -1,11 +1,14 @@
 #ifndef SIMULATOR_GENERATOR_SRC_REGISTRY_GENERATED_ORDERS_REGISTRY_HPP_
 #define SIMULATOR_GENERATOR_SRC_REGISTRY_GENERATED_ORDERS_REGISTRY_HPP_
 
-#include <list>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
-#include <shared_mutex>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 #include "ih/registry/generated_order_data.hpp"
@@ -13,22 +16,150 @@
 
 namespace Simulator::Generator {
 
+// Keeps orders in a flat vector of slots in the order of insertion,
+// removed orders leave empty slots, which are compacted once they make
+// up a half of the storage. Orders are looked up by owner and order id
+// through open-addressing hash indexes of slot numbers, which read keys
+// from stored orders, so that keys are neither copied nor allocated.
+//
+// Readers work with an immutable snapshot of the registry, which they
+// acquire by a single atomic load, and never wait for writers.
+// Writers are serialized by a mutex; a write is applied to a copy
+// of the current snapshot, which shares stored orders with it and is
+// published once the write is complete. A write, which is rejected,
+// neither copies nor publishes a snapshot. A snapshot, which is released
+// by readers, is reused by the next write, so that a write does not
+// allocate the storage and indexes again. A transaction is applied
+// to a single copy through a view and is published as a whole.
 class GeneratedOrdersRegistryImpl
     :   public GeneratedOrdersRegistry
 {
 private:
 
-    using Storage = std::list<OrderData>;
+    using Storage = std::vector<std::shared_ptr<OrderData const>>;
 
-    // An orders registry must guarantee that keys in hash-tables pointing
-    // to the stored object's string members.
-    using HashTable = std::unordered_map<
-            std::string_view  // A string key referenced to a stored object
-        ,   Storage::iterator // An iterator to a stored object
-    >;
+    using SlotIdx = std::uint32_t;
+
+    using KeyOf = std::string_view (*)(OrderData const &);
+
+    // A linear probing hash index of storage slots by a string key,
+    // the hash of a key is kept in an entry to avoid rehashing keys.
+    class HashIndex
+    {
+    public:
+
+        explicit HashIndex(KeyOf _keyOf) noexcept;
+
+        [[nodiscard]]
+        std::optional<SlotIdx> find(
+                Storage const & _storage
+            ,   std::string_view _key
+        ) const noexcept;
+
+        // A key of the slot must not be indexed yet.
+        void insert(Storage const & _storage, SlotIdx _slot);
+
+        void erase(Storage const & _storage, SlotIdx _slot) noexcept;
+
+        void rebuild(Storage const & _storage);
+
+    private:
+
+        static constexpr SlotIdx NoSlot =
+            std::numeric_limits<SlotIdx>::max();
+
+        // Marks an entry of an erased key, which does not break probe chains.
+        static constexpr SlotIdx ErasedSlot = NoSlot - 1;
+
+        struct Entry
+        {
+            std::size_t hash { 0 };
+            SlotIdx slot { NoSlot };
+        };
+
+        void place(std::size_t _hash, SlotIdx _slot) noexcept;
+
+        void grow();
+
+        [[nodiscard]]
+        std::size_t mask() const noexcept;
+
+
+        KeyOf m_keyOf;
+        std::vector<Entry> m_entries;
+        // Both present and erased entries, which lengthen probe chains.
+        std::size_t m_occupied { 0 };
+    };
+
+    // Holds the registry contents, which are not changed once published.
+    struct Snapshot
+    {
+        Snapshot() noexcept;
+
+        Storage storage;
+        std::size_t storedCount { 0 };
+        std::uint64_t revision { 0 };
+        HashIndex byOwnerIndex;
+        HashIndex byIdentifierIndex;
+    };
+
+    // Operates on a snapshot, which is written by a running transaction.
+    class TransactionView final
+        :   public GeneratedOrdersRegistry
+    {
+    public:
+
+        explicit TransactionView(Snapshot & _snapshot) noexcept;
+
+        std::optional<OrderData> findByOwner(
+            std::string_view _ownerID
+        ) const override;
+
+        std::optional<OrderData> findByIdentifier(
+            std::string_view _identifier
+        ) const override;
+
+
+        bool add(OrderData && _newOrderData) override;
+
+        bool updateByOwner(
+                std::string_view _ownerID
+            ,   OrderData::Patch && _patch
+        ) override;
+
+        bool updateByIdentifier(
+                std::string_view _identifier
+            ,   OrderData::Patch && _patch
+        ) override;
+
+        bool removeByOwner(std::string_view _ownerID) override;
+
+        bool removeByIdentifier(std::string_view _identifier) override;
+
+
+        void forEach(Visitor const & _visitor) const override;
+
+        std::vector<OrderData> selectBy(
+            Predicate const & _predicate
+        ) const override;
+
+
+        // Reports the revision of the snapshot the transaction has started
+        // with, which is not changed until the transaction is published.
+        std::uint64_t revision() const noexcept override;
+
+        // Applies a nested transaction to the same snapshot.
+        void transact(Transaction const & _transaction) override;
+
+    private:
+
+        Snapshot & m_snapshot;
+    };
 
 public:
 
+    GeneratedOrdersRegistryImpl();
+
     std::optional<OrderData> findByOwner(
         std::string_view _ownerID
     ) const override;
@@ -59,30 +190,94 @@ public:
 
     std::vector<OrderData> selectBy(Predicate const & _predicate) const override;
 
+
+    std::uint64_t revision() const noexcept override;
+
+    void transact(Transaction const & _transaction) override;
+
 private:
 
+    // Applies the write to a copy of the current snapshot under the writers
+    // lock, when the precondition holds for the current snapshot.
+    // Publishes the copy when the write reports a change.
+    template<typename Precondition, typename WriteOp>
+    bool write(Precondition && _precondition, WriteOp && _write);
+
     [[nodiscard]]
-    bool violatesUniqueConstraints(OrderData const & _orderData) const;
+    std::shared_ptr<Snapshot const> acquire() const noexcept;
 
-    void insert(OrderData && _orderData);
+    // Copies the current snapshot into a spare one, the caller holds
+    // the writers lock.
+    [[nodiscard]]
+    std::shared_ptr<Snapshot> makeWritableCopy();
 
-    void update(Storage::iterator _storedIt, OrderData::Patch && _patch);
+    void publish(std::shared_ptr<Snapshot> _snapshot);
 
-    void remove(Storage::iterator _storedIt);
 
     [[nodiscard]]
-    static std::optional<Storage::iterator> lookupIn(
-            HashTable const & _hashtable
+    static std::optional<OrderData> find(
+            Snapshot const & _snapshot
+        ,   HashIndex const & _index
+        ,   std::string_view _key
+    );
+
+    static bool add(Snapshot & _snapshot, OrderData && _newOrderData);
+
+    static bool update(
+            Snapshot & _snapshot
+        ,   HashIndex const & _index
+        ,   std::string_view _key
+        ,   OrderData::Patch && _patch
+    );
+
+    static bool remove(
+            Snapshot & _snapshot
+        ,   HashIndex const & _index
         ,   std::string_view _key
     );
 
+    static void forEach(Snapshot const & _snapshot, Visitor const & _visitor);
+
+    [[nodiscard]]
+    static std::vector<OrderData> selectBy(
+            Snapshot const & _snapshot
+        ,   Predicate const & _predicate
+    );
+
+
+    [[nodiscard]]
+    static std::string_view ownerKey(OrderData const & _orderData) noexcept;
+
+    [[nodiscard]]
+    static std::string_view identifierKey(
+        OrderData const & _orderData
+    ) noexcept;
+
+    [[nodiscard]]
+    static bool violatesUniqueConstraints(
+            Snapshot const & _snapshot
+        ,   OrderData const & _orderData
+    );
+
+    static void insert(Snapshot & _snapshot, OrderData && _orderData);
+
+    static bool update(
+            Snapshot & _snapshot
+        ,   SlotIdx _slot
+        ,   OrderData::Patch && _patch
+    );
+
+    static void remove(Snapshot & _snapshot, SlotIdx _slot);
+
+    static void compactIfSparse(Snapshot & _snapshot);
 
-    HashTable m_byOwnerAssoc;
-    HashTable m_byIdentifierAssoc;
 
-    mutable std::shared_mutex m_mutex;
+    std::atomic<std::shared_ptr<Snapshot const>> m_published;
 
-    Storage m_storage;
+    // Owned by writers, which hold the lock.
+    std::mutex m_writersMutex;
+    std::shared_ptr<Snapshot> m_current;
+    std::shared_ptr<Snapshot> m_spare;
 };
 
 } // namespace Simulator::Generator
@@ -2,6 +2,7 @@
 #define SIMULATOR_GENERATOR_SRC_REGISTRY_REGISTRY_UPDATER_HPP_
 
 #include <functional>
+#include <span>
 
 #include "ih/adaptation/generated_message.hpp"
 #include "ih/registry/generated_orders_registry.hpp"
@@ -15,6 +16,11 @@ class OrderRegistryUpdater {
   static void update(GeneratedOrdersRegistry& _registry,
                      GeneratedMessage const& _message);
 
+  // Applies messages in order within a single registry transaction.
+  // A message which fails to be applied is reported and skipped.
+  static void update(GeneratedOrdersRegistry& _registry,
+                     std::span<GeneratedMessage const> _messages);
+
   void update(GeneratedMessage const& _message);
 
  private:
@@ -0,0 +1,62 @@
+#ifndef SIMULATOR_GENERATOR_IH_TRACING_TRACE_SAMPLER_HPP_
+#define SIMULATOR_GENERATOR_IH_TRACING_TRACE_SAMPLER_HPP_
+
+#include <cstdint>
+
+namespace Simulator::Generator::Trace {
+
+// Selects generations to be traced: none of them, when tracing is disabled,
+// or each N-th one, starting with the first, where N is a sampling rate.
+// A sampler is owned by a single generation algorithm and is not thread-safe.
+class Sampler
+{
+public:
+
+    // Makes a sampler, which never selects a generation to be traced
+    Sampler() noexcept = default;
+
+    // A zero rate disables tracing, a rate of 1 selects every generation
+    explicit Sampler(std::uint32_t _rate) noexcept
+        :   m_rate { _rate }
+    {}
+
+    [[nodiscard]]
+    bool isEnabled() const noexcept
+    {
+        return m_rate != 0;
+    }
+
+    [[nodiscard]]
+    std::uint32_t rate() const noexcept
+    {
+        return m_rate;
+    }
+
+    // Tells whether the next generation has to be traced
+    [[nodiscard]]
+    bool sampleNext() noexcept
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        if (m_skipsLeft == 0)
+        {
+            m_skipsLeft = m_rate - 1;
+            return true;
+        }
+
+        --m_skipsLeft;
+        return false;
+    }
+
+private:
+
+    std::uint32_t m_rate { 0 };
+    std::uint32_t m_skipsLeft { 0 };
+};
+
+} // namespace Simulator::Generator::Trace
+
+#endif // SIMULATOR_GENERATOR_IH_TRACING_TRACE_SAMPLER_HPP_
@@ -3,13 +3,11 @@
 
 #include <type_traits>
 #include <utility>
-#include <variant>
-
-#include "cfg/api/cfg.hpp"
 
 #include "ih/tracing/json_tracer.hpp"
 #include "ih/tracing/null_tracer.hpp"
 #include "ih/tracing/trace_logger.hpp"
+#include "ih/tracing/trace_sampler.hpp"
 #include "ih/tracing/trace_value.hpp"
 
 namespace Simulator::Generator::Trace {
@@ -91,9 +89,20 @@ public:
 } // namespace Detail
 
 
+// Tells whether a tracer records traced steps and values.
+// Values, which have to be formatted to be traced, should be formatted
+// only for recording tracers, so a non-traced generation formats nothing.
+template<typename Tracer>
+inline constexpr bool IsRecording =
+    !std::is_same_v<std::decay_t<Tracer>, NullTracer>;
+
+
+// Runs an algorithm with a JSON tracer, when the sampler selects the run
+// to be traced, or with a null tracer otherwise. Each path is a separate
+// instantiation of the algorithm, the null one does no tracing work at all.
 template<typename Algorithm>
 [[maybe_unused]]
-auto trace(Algorithm && _algorithm)
+auto trace(Algorithm && _algorithm, Sampler & _sampler)
 {
     using DefaultTracer = NullTracer;
     using ReturnType = std::invoke_result_t<
@@ -111,17 +120,15 @@ auto trace(Algorithm && _algorithm)
         "a non-reference type or must not return anything."
     );
 
-    std::variant<DefaultTracer, JsonTracer> tracer { DefaultTracer {} };
-    if (Cfg::generator().enableTracing)
+    if (_sampler.sampleNext())
     {
-        tracer = JsonTracer {};
+        using TracingWrapper = Detail::TracingWrapper<Algorithm, isReturning>;
+        JsonTracer tracer {};
+        return TracingWrapper { std::forward<Algorithm>(_algorithm) }(tracer);
     }
 
-    using TracingWrapper = Detail::TracingWrapper<Algorithm, isReturning>;
-    return std::visit(
-            TracingWrapper { std::forward<Algorithm>(_algorithm) }
-        ,   tracer
-    );
+    DefaultTracer tracer {};
+    return std::forward<Algorithm>(_algorithm)(tracer);
 }
 
 
@@ -0,0 +1,100 @@
+#ifndef SIMULATOR_GENERATOR_IH_UTILS_ENGINE_PACER_HPP_
+#define SIMULATOR_GENERATOR_IH_UTILS_ENGINE_PACER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "ih/constants.hpp"
+#include "protocol/app/engine_load_request.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
+
+namespace Simulator::Generator {
+
+// Paces synthetic order flow to a trading engine, which falls behind
+// executing its commands, so that generated orders never starve
+// client orders sent to the same engine.
+//
+// An engine is saturated when too many commands wait in its queue or its
+// oldest command waits for too long. Each saturated probe doubles a slowdown
+// factor of the generation interval up to a limit, the factor is reset
+// as soon as the engine keeps up again.
+//
+// The engine is probed at most once per probe interval, so that generations
+// do not make a round trip to the engine each.
+class EnginePacer
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Limits
+    {
+        std::uint64_t maxQueueDepth;
+        std::chrono::microseconds maxRequestAge;
+        std::uint32_t maxSlowdown;
+        std::chrono::microseconds probeInterval {
+            Constant::EngineLoadProbeInterval
+        };
+    };
+
+    // Makes a pacer with default limits
+    EnginePacer() noexcept;
+
+    [[nodiscard]]
+    static Limits defaultLimits() noexcept;
+
+    explicit EnginePacer(Limits _limits) noexcept;
+
+    // Tells whether orders may be sent to the engine with the given load
+    [[nodiscard]]
+    bool admit(simulator::protocol::EngineLoad const & _load) noexcept;
+
+    // Tells whether orders may be sent to the engine of the resolved
+    // instrument. The engine load is queried only when the last probe is
+    // older than the probe interval, otherwise the last decision is kept.
+    [[nodiscard]]
+    bool admit(
+            simulator::protocol::InstrumentHandle _instrument
+        ,   Clock::time_point _now
+    ) noexcept;
+
+    // The engine load received on the last probe, if any
+    [[nodiscard]]
+    std::optional<simulator::protocol::EngineLoad> const &
+    lastLoad() const noexcept;
+
+    [[nodiscard]]
+    bool isSaturated(
+        simulator::protocol::EngineLoad const & _load
+    ) const noexcept;
+
+    // The factor a generation interval has to be multiplied by
+    [[nodiscard]]
+    std::uint32_t slowdown() const noexcept;
+
+    [[nodiscard]]
+    std::chrono::microseconds pace(
+        std::chrono::microseconds _interval
+    ) const noexcept;
+
+private:
+
+    Limits m_limits;
+    std::uint32_t m_slowdown { 1 };
+
+    std::optional<Clock::time_point> m_lastProbe;
+    std::optional<simulator::protocol::EngineLoad> m_lastLoad;
+    bool m_admitted { true };
+};
+
+// Queries the load of the engine of the resolved instrument, returns none
+// if the load can not be queried, so that a caller is not throttled.
+[[nodiscard]]
+std::optional<simulator::protocol::EngineLoad> queryEngineLoad(
+    simulator::protocol::InstrumentHandle _instrument
+) noexcept;
+
+} // namespace Simulator::Generator
+
+#endif // SIMULATOR_GENERATOR_IH_UTILS_ENGINE_PACER_HPP_
@@ -0,0 +1,130 @@
+#ifndef SIMULATOR_GENERATOR_IH_UTILS_GENERATION_SCHEDULER_HPP_
+#define SIMULATOR_GENERATOR_IH_UTILS_GENERATION_SCHEDULER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "ih/context/component_context.hpp"
+#include "ih/utils/executable.hpp"
+
+namespace Simulator::Generator {
+
+// Runs many executables on a small fixed pool of worker threads.
+//
+// Executables are ordered by the deadline of their next execution,
+// a worker takes the earliest due executable, executes it and schedules
+// it again after its `nextExecTimeout`, so the execution rate of each
+// executable is the same as if it had a dedicated thread.
+// When the component is suspended, executables are parked until
+// the next launch notification from the component context.
+//
+// A scheduler without workers executes nothing on its own, its owner
+// drives it by calling `runDue` with its own notion of current time.
+class GenerationScheduler
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    GenerationScheduler() = delete;
+
+    GenerationScheduler(
+            std::size_t _workersCount
+        ,   std::shared_ptr<ComponentContext> _pGlobalContext
+    ) noexcept;
+
+    GenerationScheduler(GenerationScheduler const &) = delete;
+    GenerationScheduler(GenerationScheduler &&) = delete;
+
+    ~GenerationScheduler() noexcept;
+
+    auto operator=(GenerationScheduler const &) -> GenerationScheduler & = delete;
+    auto operator=(GenerationScheduler &&) -> GenerationScheduler & = delete;
+
+    static std::unique_ptr<GenerationScheduler> create(
+            std::size_t _workersCount
+        ,   std::shared_ptr<ComponentContext> _pGlobalContext
+    );
+
+    // Returns a number of workers which is enough to serve
+    // a given number of executables on the current hardware.
+    [[nodiscard]]
+    static std::size_t defaultWorkersCount(std::size_t _executablesCount) noexcept;
+
+    // Executables must be added before the scheduler is launched.
+    void add(std::unique_ptr<Executable> _pExecutable);
+
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    void launch();
+
+    void terminate() noexcept;
+
+    // Executes, on the calling thread, executables which are due by the given
+    // time, each executable is executed at most once per call.
+    // Returns the number of executed executables.
+    std::size_t runDue(Clock::time_point _now);
+
+private:
+
+    struct Deadline
+    {
+        Clock::time_point time;
+        std::size_t executableIndex { 0 };
+
+        [[nodiscard]]
+        bool operator>(Deadline const & _other) const noexcept
+        {
+            return time > _other.time;
+        }
+    };
+
+    using DeadlineQueue = std::priority_queue<
+            Deadline
+        ,   std::vector<Deadline>
+        ,   std::greater<>
+    >;
+
+    void start();
+
+    void resume();
+
+    void park(std::size_t _executableIndex);
+
+    void schedule(std::size_t _executableIndex, Clock::time_point _time);
+
+    void work(std::stop_token const & _stopToken) noexcept;
+
+    // Returns true when the executable has to be executed again
+    // after its `nextExecTimeout`.
+    [[nodiscard]]
+    bool process(std::size_t _executableIndex) noexcept;
+
+
+    std::shared_ptr<ComponentContext> m_pGlobalContext;
+
+    std::vector<std::unique_ptr<Executable>> m_executables;
+    std::size_t m_workersCount { 0 };
+
+    mutable std::mutex m_mutex;
+    std::condition_variable_any m_deadlineCondition;
+    DeadlineQueue m_deadlines;
+    std::vector<std::size_t> m_parked;
+    bool m_resumptionRequested { false };
+    bool m_launched { false };
+    bool m_terminated { false };
+
+    std::vector<std::jthread> m_workers;
+};
+
+} // namespace Simulator::Generator
+
+#endif // SIMULATOR_GENERATOR_IH_UTILS_GENERATION_SCHEDULER_HPP_
@@ -0,0 +1,20 @@
+#ifndef SIMULATOR_GENERATOR_IH_UTILS_PARALLEL_HPP_
+#define SIMULATOR_GENERATOR_IH_UTILS_PARALLEL_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace Simulator::Generator {
+
+// Invokes the function for each index in [0, _count), splitting the range
+// into contiguous chunks, which are processed by concurrent tasks.
+// Exceptions thrown by the function are rethrown to the caller
+// once all the chunks are processed.
+auto forEachIndexInParallel(
+    std::size_t _count,
+    std::function<void(std::size_t)> const& _function
+) -> void;
+
+} // namespace Simulator::Generator
+
+#endif // SIMULATOR_GENERATOR_IH_UTILS_PARALLEL_HPP_
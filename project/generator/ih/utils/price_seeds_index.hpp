@@ -0,0 +1,36 @@
+#ifndef SIMULATOR_GENERATOR_IH_UTILS_PRICE_SEEDS_INDEX_HPP_
+#define SIMULATOR_GENERATOR_IH_UTILS_PRICE_SEEDS_INDEX_HPP_
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "data_layer/api/models/price_seed.hpp"
+
+namespace Simulator::Generator {
+
+// Price seeds indexed by instrument symbols.
+// A symbol having several price seeds is ambiguous, no seed is looked up
+// for it, as a random generator can not pick one of them.
+class PriceSeedsIndex
+{
+public:
+    explicit PriceSeedsIndex(std::vector<DataLayer::PriceSeed> _seeds);
+
+    // Returns nullptr if the symbol has no seed or is ambiguous.
+    [[nodiscard]]
+    auto find(std::string const& _symbol) const
+        -> DataLayer::PriceSeed const*;
+
+    [[nodiscard]]
+    auto isAmbiguous(std::string const& _symbol) const -> bool;
+
+private:
+    std::unordered_map<std::string, std::optional<DataLayer::PriceSeed>>
+        mSeedsBySymbol;
+};
+
+} // namespace Simulator::Generator
+
+#endif // SIMULATOR_GENERATOR_IH_UTILS_PRICE_SEEDS_INDEX_HPP_
@@ -0,0 +1,109 @@
+#ifndef SIMULATOR_GENERATOR_IH_UTILS_RING_BUFFER_HPP_
+#define SIMULATOR_GENERATOR_IH_UTILS_RING_BUFFER_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Simulator::Generator {
+
+// A bounded blocking single-producer single-consumer queue.
+// A producer waits while the buffer is full, a consumer waits while
+// the buffer is empty and has not been closed yet.
+template<typename T>
+class RingBuffer
+{
+public:
+
+    explicit RingBuffer(std::size_t _capacity)
+        :   m_slots(std::max<std::size_t>(_capacity, 1))
+    {}
+
+    // Returns false when the buffer has been closed,
+    // in which case the value is discarded.
+    bool push(T _value)
+    {
+        std::unique_lock<std::mutex> lock { m_mutex };
+        m_notFull.wait(lock, [this] {
+            return m_closed || m_size < m_slots.size();
+        });
+        if (m_closed)
+        {
+            return false;
+        }
+
+        m_slots[(m_head + m_size) % m_slots.size()].emplace(std::move(_value));
+        ++m_size;
+        lock.unlock();
+
+        m_notEmpty.notify_one();
+        return true;
+    }
+
+    // Returns nullopt when the buffer is closed and all values are consumed.
+    [[nodiscard]]
+    std::optional<T> pop()
+    {
+        std::unique_lock<std::mutex> lock { m_mutex };
+        m_notEmpty.wait(lock, [this] { return m_closed || m_size > 0; });
+        if (m_size == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::optional<T> value { std::move(m_slots[m_head]) };
+        m_slots[m_head].reset();
+        m_head = (m_head + 1) % m_slots.size();
+        --m_size;
+        lock.unlock();
+
+        m_notFull.notify_one();
+        return value;
+    }
+
+    // Waits until a value is available or the buffer is drained.
+    [[nodiscard]]
+    bool drained() const
+    {
+        std::unique_lock<std::mutex> lock { m_mutex };
+        m_notEmpty.wait(lock, [this] { return m_closed || m_size > 0; });
+        return m_size == 0;
+    }
+
+    // Values pushed before closing remain available to the consumer.
+    void close() noexcept
+    {
+        {
+            std::unique_lock<std::mutex> const lock { m_mutex };
+            m_closed = true;
+        }
+        m_notEmpty.notify_all();
+        m_notFull.notify_all();
+    }
+
+    [[nodiscard]]
+    std::size_t capacity() const noexcept
+    {
+        return m_slots.size();
+    }
+
+private:
+
+    std::vector<std::optional<T>> m_slots;
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+
+    std::size_t m_head { 0 };
+    std::size_t m_size { 0 };
+    bool m_closed { false };
+};
+
+} // namespace Simulator::Generator
+
+#endif // SIMULATOR_GENERATOR_IH_UTILS_RING_BUFFER_HPP_
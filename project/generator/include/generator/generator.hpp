@@ -1,7 +1,10 @@
 #ifndef SIMULATOR_GENERATOR_INCLUDE_GENERATOR_GENERATOR_HPP_
 #define SIMULATOR_GENERATOR_INCLUDE_GENERATOR_GENERATOR_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 
 #include "data_layer/api/database/context.hpp"
 #include "protocol/admin/generator.hpp"
@@ -12,6 +15,7 @@
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
 #include "protocol/app/order_placement_reject.hpp"
+#include "protocol/app/order_reply_batch.hpp"
 
 namespace simulator::generator {
 
@@ -38,6 +42,14 @@ struct Generator {
 
 auto launch_generator(Generator& generator) -> void;
 
+// Compiles a historical datasource into a replay file, which is read instead
+// of the source when configured as a CSV datasource connection.
+// Returns the number of compiled records, throws on any datasource error.
+auto compile_historical_replay(Simulator::DataLayer::Database::Context db,
+                               std::uint64_t datasource_id,
+                               const std::string& replay_file_path)
+    -> std::size_t;
+
 auto terminate_generator(Generator& generator) noexcept -> void;
 
 auto accept_reply(const protocol::ExecutionReport& reply, Generator& generator)
@@ -61,6 +73,10 @@ auto accept_reply(const protocol::OrderCancellationConfirmation& reply,
 auto accept_reply(const protocol::OrderCancellationReject& reply,
                   Generator& generator) -> void;
 
+// Accepts order replies produced by a single trading command.
+auto accept_replies(const protocol::OrderReplyBatch& replies,
+                    Generator& generator) -> void;
+
 auto process_admin_request(Generator& generator,
                            const protocol::GenerationStatusRequest& request,
                            protocol::GenerationStatusReply& reply) -> void;
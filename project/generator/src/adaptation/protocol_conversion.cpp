@@ -5,6 +5,7 @@
 
 #include "core/domain/attributes.hpp"
 #include "core/domain/instrument_descriptor.hpp"
+#include "ih/adaptation/request_prototypes.hpp"
 
 namespace Simulator::Generator {
 namespace {
@@ -126,14 +127,6 @@ auto convert_instrument_security_identifier(
   return std::nullopt;
 }
 
-[[nodiscard]] auto convert_order_parties(const simulator::PartyId& party_id)
-    -> std::vector<simulator::Party> {
-  return {simulator::Party{
-      simulator::PartyIdentifier{party_id,
-                                 simulator::PartyIdSource::Option::Proprietary},
-      simulator::PartyRole::Option::ExecutingFirm}};
-}
-
 template <typename T, typename U>
 auto assign(T& destination, U source) -> void {
   if constexpr (std::same_as<T, std::string>) {
@@ -150,6 +143,50 @@ auto assign(T& destination, std::optional<U> source) -> void {
   }
 }
 
+// Fill order attributes of a request, which already carries a session
+// and an instrument.
+
+auto fill_order_placement_request(
+    const GeneratedMessage& message,
+    const RequestPrototypes& prototypes,
+    simulator::protocol::OrderPlacementRequest& request) -> void {
+  request.order_type = message.order_type;
+  request.time_in_force = message.time_in_force;
+  request.side = message.side;
+  request.order_price =
+      convert_order_price(message.order_price, request.order_type);
+  request.order_quantity = convert_order_quantity(message.quantity);
+  request.client_order_id = message.client_order_id;
+  if (const auto& party_id = message.party_id) {
+    request.parties = prototypes.order_parties(*party_id);
+  }
+}
+
+auto fill_order_modification_request(
+    const GeneratedMessage& message,
+    const RequestPrototypes& prototypes,
+    simulator::protocol::OrderModificationRequest& request) -> void {
+  request.order_type = message.order_type;
+  request.time_in_force = message.time_in_force;
+  request.side = message.side;
+  request.order_price =
+      convert_order_price(message.order_price, request.order_type);
+  request.order_quantity = convert_order_quantity(message.quantity);
+  request.client_order_id = message.client_order_id;
+  request.orig_client_order_id = message.orig_client_order_id;
+  if (const auto& party_id = message.party_id) {
+    request.parties = prototypes.order_parties(*party_id);
+  }
+}
+
+auto fill_order_cancellation_request(
+    const GeneratedMessage& message,
+    simulator::protocol::OrderCancellationRequest& request) -> void {
+  request.side = message.side;
+  request.client_order_id = message.client_order_id;
+  request.orig_client_order_id = message.orig_client_order_id;
+}
+
 auto get_total_quantity(std::optional<simulator::CumExecutedQuantity> executed,
                         std::optional<simulator::LeavesQuantity> leaves)
     -> simulator::Quantity {
@@ -187,63 +224,29 @@ auto convert_to_instrument_descriptor(const DataLayer::Listing& listing)
   return descriptor;
 }
 
-auto convert_to_order_placement_request(
-    const GeneratedMessage& message,
-    const simulator::InstrumentDescriptor& instrument)
+auto convert_to_order_placement_request(const GeneratedMessage& message,
+                                        const RequestPrototypes& prototypes)
     -> simulator::protocol::OrderPlacementRequest {
-  simulator::protocol::OrderPlacementRequest request{
-      simulator::protocol::Session{simulator::protocol::generator::Session{}}};
-
-  request.order_type = message.order_type;
-  request.time_in_force = message.time_in_force;
-  request.side = message.side;
-  request.order_price =
-      convert_order_price(message.order_price, request.order_type);
-  request.order_quantity = convert_order_quantity(message.quantity);
-  request.client_order_id = message.client_order_id;
-  if (const auto& party_id = message.party_id) {
-    request.parties = convert_order_parties(*party_id);
-  }
-  request.instrument = instrument;
-
+  simulator::protocol::OrderPlacementRequest request{prototypes.placement()};
+  fill_order_placement_request(message, prototypes, request);
   return request;
 }
 
-auto convert_to_order_modification_request(
-    const GeneratedMessage& message,
-    const simulator::InstrumentDescriptor& instrument)
+auto convert_to_order_modification_request(const GeneratedMessage& message,
+                                           const RequestPrototypes& prototypes)
     -> simulator::protocol::OrderModificationRequest {
   simulator::protocol::OrderModificationRequest request{
-      simulator::protocol::Session{simulator::protocol::generator::Session{}}};
-
-  request.order_type = message.order_type;
-  request.time_in_force = message.time_in_force;
-  request.side = message.side;
-  request.order_price =
-      convert_order_price(message.order_price, request.order_type);
-  request.order_quantity = convert_order_quantity(message.quantity);
-  request.client_order_id = message.client_order_id;
-  request.orig_client_order_id = message.orig_client_order_id;
-  if (const auto& party_id = message.party_id) {
-    request.parties = convert_order_parties(*party_id);
-  }
-  request.instrument = instrument;
-
+      prototypes.modification()};
+  fill_order_modification_request(message, prototypes, request);
   return request;
 }
 
-auto convert_to_order_cancellation_request(
-    const GeneratedMessage& message,
-    const simulator::InstrumentDescriptor& instrument)
+auto convert_to_order_cancellation_request(const GeneratedMessage& message,
+                                           const RequestPrototypes& prototypes)
     -> simulator::protocol::OrderCancellationRequest {
   simulator::protocol::OrderCancellationRequest request{
-      simulator::protocol::Session{simulator::protocol::generator::Session{}}};
-
-  request.side = message.side;
-  request.client_order_id = message.client_order_id;
-  request.orig_client_order_id = message.orig_client_order_id;
-  request.instrument = instrument;
-
+      prototypes.cancellation()};
+  fill_order_cancellation_request(message, request);
   return request;
 }
 
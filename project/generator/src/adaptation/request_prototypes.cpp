@@ -0,0 +1,72 @@
+#include "ih/adaptation/request_prototypes.hpp"
+
+#include <cassert>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "log/logging.hpp"
+#include "middleware/routing/trading_request_channel.hpp"
+#include "protocol/types/session.hpp"
+
+namespace Simulator::Generator {
+namespace {
+
+[[nodiscard]] auto make_session() -> simulator::protocol::Session {
+  return simulator::protocol::Session{simulator::protocol::generator::Session{}};
+}
+
+}  // namespace
+
+RequestPrototypes::RequestPrototypes(
+    std::shared_ptr<const simulator::InstrumentDescriptor> instrument)
+    : instrument_{std::move(instrument)},
+      placement_{make_session()},
+      modification_{make_session()},
+      cancellation_{make_session()} {
+  assert(instrument_);
+  placement_.instrument = *instrument_;
+  modification_.instrument = *instrument_;
+  cancellation_.instrument = *instrument_;
+}
+
+RequestPrototypes::RequestPrototypes(simulator::InstrumentDescriptor instrument)
+    : RequestPrototypes{std::make_shared<const simulator::InstrumentDescriptor>(
+          std::move(instrument))} {}
+
+auto RequestPrototypes::order_parties(const simulator::PartyId& party_id) const
+    -> const std::vector<simulator::Party>& {
+  const std::lock_guard lock{order_parties_lock_};
+  auto parties = order_parties_.find(party_id);
+  if (parties == order_parties_.end()) {
+    std::vector<simulator::Party> converted{simulator::Party{
+        simulator::PartyIdentifier{
+            party_id, simulator::PartyIdSource::Option::Proprietary},
+        simulator::PartyRole::Option::ExecutingFirm}};
+    parties = order_parties_.emplace(party_id, std::move(converted)).first;
+  }
+  // Elements of the map are never erased, so the reference stays valid.
+  return parties->second;
+}
+
+auto resolve_instrument_handle(const RequestPrototypes& prototypes) noexcept
+    -> std::optional<simulator::protocol::InstrumentHandle> {
+  simulator::protocol::InstrumentHandleReply reply;
+  try {
+    const simulator::protocol::InstrumentHandleRequest request{
+        prototypes.instrument()};
+    simulator::middleware::send_trading_request(request, reply);
+  } catch (const simulator::middleware::ChannelUnboundError&) {
+    simulator::log::warn(
+        "failed to resolve instrument handle - trading request channel is "
+        "not bound");
+  } catch (const std::exception& ex) {
+    simulator::log::warn("failed to resolve instrument handle: {}", ex.what());
+  }
+  return reply.handle;
+}
+
+}  // namespace Simulator::Generator
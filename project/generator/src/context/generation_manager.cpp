@@ -3,9 +3,12 @@
 #include <fmt/format.h>
 
 #include <chrono>
+#include <cstdint>
 #include <list>
+#include <optional>
 
 #include "ih/constants.hpp"
+#include "ih/random/generators/xoshiro_engine.hpp"
 #include "log/logging.hpp"
 
 namespace Simulator::Generator {
@@ -66,8 +69,27 @@ IdentifierGenerator::IdentifierGenerator()
 {}
 
 
+IdentifierGenerator::IdentifierGenerator(
+        std::uint64_t _seed
+    ,   std::uint64_t _streamId
+) noexcept
+    :   m_streamId { _streamId }
+{
+    std::uint64_t streamSeed =
+        Random::XoshiroEngine::streamSeed(_seed, _streamId);
+    // The upper half of the range is left for identifiers to grow
+    m_nextIdentifier = static_cast<std::size_t>(
+        Random::XoshiroEngine::splitMix(streamSeed) >> 1
+    );
+}
+
+
 std::string IdentifierGenerator::generateIdentifier() noexcept
 {
+    if (m_streamId.has_value())
+    {
+        return fmt::format("SIM-{}-{}", *m_streamId, m_nextIdentifier++);
+    }
     return fmt::format("SIM-{}", m_nextIdentifier++);
 }
 
@@ -1,7 +1,9 @@
 #include "ih/context/order_generation_context_impl.hpp"
 
 #include <cassert>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "ih/registry/generated_orders_registry_impl.hpp"
@@ -13,14 +15,20 @@ OrderInstrumentContextImpl::OrderInstrumentContextImpl(
     ,   simulator::InstrumentDescriptor _descriptor
     ,   std::shared_ptr<ComponentContext> _pGlobalContext
     ,   std::unique_ptr<GeneratedOrdersRegistry> _pGeneratedOrdersRegistry
+    ,   std::optional<std::uint64_t> _randomSeed
 ) noexcept
     :   m_instrument { std::move(_instrument) }
-    ,   m_instrumentDescriptor { std::move(_descriptor) }
+    ,   m_requestPrototypes { std::move(_descriptor) }
     ,   m_pGlobalContext { std::move(_pGlobalContext) }
     ,   m_pInstrumentOrdersRegistry { std::move(_pGeneratedOrdersRegistry) }
 {
     assert(m_pGlobalContext);
     assert(m_pInstrumentOrdersRegistry);
+
+    if (_randomSeed.has_value())
+    {
+        m_idGenerator.emplace(*_randomSeed, m_instrument.getListingId());
+    }
 }
 
 
@@ -28,6 +36,7 @@ std::shared_ptr<OrderInstrumentContext> OrderInstrumentContextImpl::create(
         DataLayer::Listing const & _instrument
     ,   simulator::InstrumentDescriptor const & _descriptor
     ,   std::shared_ptr<ComponentContext> _pGlobalContext
+    ,   std::optional<std::uint64_t> _randomSeed
 )
 {
     return std::make_shared<OrderInstrumentContextImpl>(
@@ -35,6 +44,7 @@ std::shared_ptr<OrderInstrumentContext> OrderInstrumentContextImpl::create(
         ,   _descriptor
         ,   std::move(_pGlobalContext)
         ,   std::make_unique<GeneratedOrdersRegistryImpl>()
+        ,   _randomSeed
     );
 }
 
@@ -42,7 +52,9 @@ std::shared_ptr<OrderInstrumentContext> OrderInstrumentContextImpl::create(
 
 std::string OrderInstrumentContextImpl::getSyntheticIdentifier() noexcept
 {
-    return m_pGlobalContext->generateIdentifier();
+    return m_idGenerator.has_value()
+        ? m_idGenerator->generateIdentifier()
+        : m_pGlobalContext->generateIdentifier();
 }
 
 
@@ -62,7 +74,14 @@ OrderInstrumentContextImpl::getInstrument() const noexcept
 simulator::InstrumentDescriptor const &
 OrderInstrumentContextImpl::getInstrumentDescriptor() const noexcept
 {
-  return m_instrumentDescriptor;
+  return m_requestPrototypes.instrument();
+}
+
+
+RequestPrototypes const &
+OrderInstrumentContextImpl::getRequestPrototypes() const noexcept
+{
+    return m_requestPrototypes;
 }
 
 
@@ -131,6 +150,13 @@ OrderGenerationContextImpl::getInstrumentDescriptor() const noexcept
 }
 
 
+RequestPrototypes const &
+OrderGenerationContextImpl::getRequestPrototypes() const noexcept
+{
+    return m_pInstrumentContext->getRequestPrototypes();
+}
+
+
 std::size_t OrderGenerationContextImpl::nextMessageNumber() noexcept
 {
     return m_pInstrumentContext->nextMessageNumber();
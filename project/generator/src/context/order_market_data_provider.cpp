@@ -1,6 +1,7 @@
 #include "ih/context/order_market_data_provider.hpp"
 
 #include "core/domain/instrument_descriptor.hpp"
+#include "middleware/mirror/market_state_mirror.hpp"
 #include "middleware/routing/trading_request_channel.hpp"
 
 namespace Simulator::Generator {
@@ -19,20 +20,47 @@ namespace {
   if (instrument_state.best_offer_price.has_value()) {
     market_state.bestOfferPrice = instrument_state.best_offer_price->value();
   }
-  if (instrument_state.current_bid_depth.has_value()) {
+  if (instrument_state.current_offer_depth.has_value()) {
     market_state.offerDepthLevels =
         instrument_state.current_offer_depth->value();
   }
   return market_state;
 }
 
+[[nodiscard]] auto convert_to_market_state(
+    const simulator::middleware::MirroredMarketState& mirrored) noexcept
+    -> MarketState {
+  MarketState market_state;
+  market_state.bestBidPrice = mirrored.best_bid_price;
+  market_state.bestOfferPrice = mirrored.best_offer_price;
+  market_state.bidDepthLevels = mirrored.bid_depth_levels;
+  market_state.offerDepthLevels = mirrored.offer_depth_levels;
+  return market_state;
+}
+
 }  // namespace
 
 OrderMarketDataProvider::OrderMarketDataProvider(
     simulator::InstrumentDescriptor order_instrument)
-    : instrument_descriptor_(std::move(order_instrument)) {}
+    : instrument_descriptor_(std::move(order_instrument)) {
+  // The requester instrument identifier holds the listing identifier
+  // which trading engines use to publish mirrored states.
+  if (instrument_descriptor_.requester_instrument_id.has_value()) {
+    mirror_ = &simulator::middleware::market_state_mirror(
+        instrument_descriptor_.requester_instrument_id->value());
+  }
+}
 
 auto OrderMarketDataProvider::getMarketState() const -> MarketState {
+  if (mirror_ != nullptr) {
+    if (const auto mirrored = mirror_->read()) {
+      return convert_to_market_state(*mirrored);
+    }
+  }
+  return requestMarketState();
+}
+
+auto OrderMarketDataProvider::requestMarketState() const -> MarketState {
   simulator::protocol::InstrumentStateRequest request;
   simulator::protocol::InstrumentState reply;
 
@@ -1,16 +1,35 @@
 #include "ih/factory/executable_factory_impl.hpp"
 
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 
+#include "cfg/api/cfg.hpp"
 #include "ih/context/order_generation_context_impl.hpp"
 #include "ih/context/order_market_data_provider.hpp"
 #include "ih/historical/replier.hpp"
 #include "ih/random/algorithm/order_generation_algorithm.hpp"
 #include "ih/random/instrument_generator.hpp"
+#include "ih/tracing/trace_sampler.hpp"
 #include "ih/utils/validator.hpp"
 
 namespace Simulator::Generator {
 
+namespace {
+
+auto makeTraceSampler() -> Trace::Sampler
+{
+    auto const& config = Cfg::generator();
+    if (!config.enableTracing) {
+        return Trace::Sampler{};
+    }
+    return Trace::Sampler{
+        static_cast<std::uint32_t>(config.tracingSampleRate)
+    };
+}
+
+} // namespace
+
 auto InstrumentRandomGeneratorFactoryImpl::create()
     -> std::unique_ptr<InstrumentRandomGeneratorFactory>
 {
@@ -39,7 +58,13 @@ auto InstrumentRandomGeneratorFactoryImpl::createOrdersExecutable(
 
     return std::make_unique<Random::OrderGenerator>(
         std::move(_pInstrumentContext),
-        Random::OrderGenerationAlgorithm::create(pGenerationContext)
+        Random::OrderGenerationAlgorithm::create(
+            pGenerationContext,
+            makeTraceSampler(),
+            Cfg::generator().randomSeed
+        ),
+        std::chrono::milliseconds{Cfg::generator().batchInterval},
+        Cfg::generator().randomSeed
     );
 }
 
@@ -50,7 +75,8 @@ auto HistoricalReplierFactoryImpl::createOrdersExecutable(
 {
     return std::make_unique<Historical::Replier>(
         _datasources,
-        _contexts
+        _contexts,
+        Cfg::generator().replaySpeed
     );
 }
 
@@ -1,10 +1,17 @@
 #include "generator/generator.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <optional>
+#include <string>
 #include <utility>
 
 #include "data_layer/api/data_access_layer.hpp"
+#include "data_layer/api/models/datasource.hpp"
+#include "data_layer/api/predicate/predicate.hpp"
+#include "ih/historical/adapters/data_access_adapter.hpp"
+#include "ih/historical/replay/replay_file.hpp"
 #include "ih/generator.hpp"
 #include "log/logging.hpp"
 
@@ -109,6 +116,23 @@ auto enrich_reply(const auto& reply, Generator::Implementation& generator)
   }
 }
 
+auto enrich_replies(const protocol::OrderReplyBatch& replies,
+                    Generator::Implementation& generator) -> void {
+  try {
+    generator.enrich(replies);
+  } catch (const std::exception& exception) {
+    log::warn(
+        "failed to handle a batch of {} reply messages, error occurred: {}",
+        replies.size(),
+        exception.what());
+  } catch (...) {
+    log::err(
+        "failed to handle a batch of {} reply messages, unknown error "
+        "occurred",
+        replies.size());
+  }
+}
+
 }  // namespace
 
 Generator::Generator(std::unique_ptr<Implementation> impl) noexcept
@@ -129,6 +153,25 @@ auto Generator::implementation() noexcept -> Implementation& {
   std::abort();
 }
 
+auto compile_historical_replay(Simulator::DataLayer::Database::Context db,
+                               std::uint64_t datasource_id,
+                               const std::string& replay_file_path)
+    -> std::size_t {
+  using Attribute = data_layer::Datasource::Attribute;
+  log::info("compiling historical datasource {} into `{}' replay file",
+            datasource_id,
+            replay_file_path);
+
+  const data_layer::Datasource datasource = data_layer::selectOneDatasource(
+      db, data_layer::DatasourceCmp::eq(Attribute::DatasourceId, datasource_id));
+
+  const auto adapter =
+      Simulator::Generator::Historical::DataAccessAdapterFactoryImpl{}
+          .createDataAdapter(datasource);
+  return Simulator::Generator::Historical::ReplayFile::compile(
+      *adapter, replay_file_path);
+}
+
 auto create_generator(Simulator::DataLayer::Database::Context db) -> Generator {
   log::debug("creating simulator generator instance");
 
@@ -205,6 +248,13 @@ auto accept_reply(const protocol::OrderCancellationReject& reply,
       reply);
 }
 
+auto accept_replies(const protocol::OrderReplyBatch& replies,
+                    Generator& generator) -> void {
+  log::debug("accepting a batch of {} order replies sent to the generator",
+             replies.size());
+  enrich_replies(replies, generator.implementation());
+}
+
 auto process_admin_request(
     Generator& generator,
     [[maybe_unused]] const protocol::GenerationStatusRequest& request,
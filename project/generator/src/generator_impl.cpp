@@ -1,7 +1,13 @@
 #include "ih/generator_impl.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
 
+#include "cfg/api/cfg.hpp"
 #include "data_layer/api/data_access_layer.hpp"
 #include "ih/adaptation/protocol_conversion.hpp"
 #include "ih/context/generation_manager.hpp"
@@ -9,6 +15,9 @@
 #include "ih/factory/executable_factory_impl.hpp"
 #include "ih/registry/registry_updater.hpp"
 #include "ih/utils/executor.hpp"
+#include "ih/utils/generation_scheduler.hpp"
+#include "ih/utils/parallel.hpp"
+#include "ih/utils/price_seeds_index.hpp"
 #include "ih/utils/validator.hpp"
 #include "log/logging.hpp"
 
@@ -46,8 +55,8 @@ auto GeneratorImpl::resume() -> void { mGenerationManager->launch(); }
 
 auto GeneratorImpl::start() -> void
 {
-    for (auto const& pRandomOrdersExecutable : mListingsRandomGenerators) {
-        pRandomOrdersExecutable->launch();
+    if (mRandomGenerationScheduler) {
+        mRandomGenerationScheduler->launch();
     }
 
     if (mHistoricalReplier) {
@@ -90,6 +99,7 @@ auto GeneratorImpl::initializeInstrument(DataLayer::Listing const& _listing)
             _listing
         ,   descriptor
         ,   mGenerationManager
+        ,   Cfg::generator().randomSeed
     );
 
     mOrderListingsContexts.emplace_back(pContext);
@@ -102,7 +112,14 @@ auto GeneratorImpl::initializeInstrument(DataLayer::Listing const& _listing)
 
 auto GeneratorImpl::initializeRandomGenerationExecutors() -> void
 {
-    for (auto const& pInstrumentCtx : mOrderListingsContexts) {
+    // Price seeds of all instruments are fetched with a single query.
+    PriceSeedsIndex const priceSeeds{
+        DataLayer::selectAllPriceSeeds(mDatabaseContext)};
+
+    std::vector<std::unique_ptr<Executable>> created(
+        mOrderListingsContexts.size());
+    forEachIndexInParallel(created.size(), [&](std::size_t _idx) {
+        auto const& pInstrumentCtx = mOrderListingsContexts[_idx];
         auto const& instrument = pInstrumentCtx->getInstrument();
 
         if (!instrument.getSymbol().has_value()) {
@@ -110,35 +127,62 @@ auto GeneratorImpl::initializeRandomGenerationExecutors() -> void
                 "can not initialize random orders generation executable for "
                 "instrument id `{}' - the instrument does not have a symbol",
                 instrument.getListingId());
-            continue;
+            return;
         }
 
-        std::unique_ptr<Executable> pExecutable;
-        try {
-            const auto pxSeed = DataLayer::selectOnePriceSeed(
-                mDatabaseContext,
-                DataLayer::Predicate::eq<DataLayer::PriceSeed>(
-                    DataLayer::PriceSeed::Attribute::Symbol,
-                    *instrument.getSymbol()));
-
-            pExecutable =
-                mRndExecutorFactory->createOrdersExecutable(pInstrumentCtx, pxSeed);
+        auto const& symbol = *instrument.getSymbol();
+        if (priceSeeds.isAmbiguous(symbol)) {
+            simulator::log::warn(
+                "can not initialize random orders generation executable for "
+                "`{}' instrument - several price seed entries have been found "
+                "for the instrument",
+                symbol);
+            return;
         }
-        catch (std::logic_error& e) {
+
+        auto const* const pPriceSeed = priceSeeds.find(symbol);
+        if (pPriceSeed == nullptr) {
             simulator::log::info(
                 "can not initialize random orders generation executable for "
                 "`{}' instrument - no price seed entry has been found "
                 "for the instrument",
-                instrument.getSymbol());
-            continue;
+                symbol);
+            return;
+        }
+
+        try {
+            created[_idx] = mRndExecutorFactory->createOrdersExecutable(
+                pInstrumentCtx,
+                *pPriceSeed);
         }
+        catch (std::logic_error const& e) {
+            simulator::log::info(
+                "can not initialize random orders generation executable for "
+                "`{}' instrument - {}",
+                symbol,
+                e.what());
+        }
+    });
 
+    std::vector<std::unique_ptr<Executable>> executables;
+    for (auto& pExecutable : created) {
         if (pExecutable) {
-            mListingsRandomGenerators.emplace_back(
-                Executor::create(std::move(pExecutable), mGenerationManager)
-            );
+            executables.emplace_back(std::move(pExecutable));
         }
     }
+
+    if (executables.empty()) {
+        return;
+    }
+
+    // All random generators share a small worker pool
+    // instead of running a dedicated thread per instrument.
+    mRandomGenerationScheduler = GenerationScheduler::create(
+        GenerationScheduler::defaultWorkersCount(executables.size()),
+        mGenerationManager);
+    for (auto& pExecutable : executables) {
+        mRandomGenerationScheduler->add(std::move(pExecutable));
+    }
 }
 
 auto GeneratorImpl::initializeHistoricalExecutor() -> void
@@ -186,6 +230,26 @@ auto GeneratorImpl::process_reply(std::uint64_t instrument_id,
              instrument_id);
 }
 
+auto GeneratorImpl::process_replies(std::uint64_t instrument_id,
+                                    std::span<const GeneratedMessage> replies)
+    -> void {
+  const auto context_iter = mContextLookup.find(instrument_id);
+  if (context_iter == mContextLookup.end()) {
+      simulator::log::warn(
+          "can not process {} reply messages for instrument {}, "
+          "no context has been found",
+          replies.size(),
+          instrument_id);
+      return;
+  }
+
+  OrderRegistryUpdater::update(context_iter->second->takeRegistry(), replies);
+
+  simulator::log::debug("{} reply messages for instrument {} processed",
+             replies.size(),
+             instrument_id);
+}
+
 auto GeneratorImpl::terminateGenerator() noexcept -> void
 {
     if (m_wasTerminated) {
@@ -193,10 +257,9 @@ auto GeneratorImpl::terminateGenerator() noexcept -> void
     }
 
     m_wasTerminated = true;
-    for (auto const& pRandomOrdersExecutable : mListingsRandomGenerators) {
-        pRandomOrdersExecutable->terminate();
+    if (mRandomGenerationScheduler) {
+        mRandomGenerationScheduler->terminate();
     }
-    mListingsRandomGenerators.clear();
 
     if (mHistoricalReplier) {
         mHistoricalReplier->terminate();
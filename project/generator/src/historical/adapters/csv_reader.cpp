@@ -1,12 +1,18 @@
 #include "ih/historical/adapters/csv_reader.hpp"
 
-#include <algorithm>
+#include <fmt/format.h>
+
+#include <cassert>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <csv.hpp>
 
+#include "ih/constants.hpp"
 #include "ih/historical/data/record.hpp"
 #include "ih/historical/mapping/params.hpp"
 #include "ih/historical/parsing/parsing.hpp"
@@ -18,16 +24,55 @@ namespace Simulator::Generator::Historical {
 CsvReader::CsvReader(
     Historical::CsvParsingParams _parsingParams,
     MappingParams _mappingParams,
-    csv::CSVReader& _reader
+    std::unique_ptr<csv::CSVReader> _pReader,
+    std::size_t _readAheadCapacity
 ) :
     mParsingParams(std::move(_parsingParams)),
-    mMappingParams{std::move(_mappingParams)}
+    mMappingParams{std::move(_mappingParams)},
+    mReader{std::move(_pReader)},
+    mReadAheadBuffer{_readAheadCapacity}
 {
-    loadCsvData(_reader);
+    assert(mReader);
+
+    // The csv parsing library trims all rows before header row and a header row
+    // itself. Thus, sentinel represents a 'global' row number with respect to
+    // possibly-trimmed rows. Sentinel itself is initialized as index (with 0),
+    // but is interpreted as a global row number inside a reading loop.
+    if (mParsingParams.has_header_row()) {
+        mRowSentinel = mParsingParams.header_row();
+    }
 
-    auto depth_config = make_depth_config(_reader);
+    // The first data row is read in advance, as it defines a number of columns
+    // when a header row is absent.
+    mFirstDataRow = readNextDataRow();
+
+    auto depth_config = make_depth_config();
     depth_ = depth_config.depth_to_parse;
-    initMappingParams(_reader, std::move(depth_config));
+    initMappingParams(std::move(depth_config));
+
+    mReadingThread = std::jthread{[this](std::stop_token const& _stopToken) {
+        readAhead(_stopToken);
+    }};
+}
+
+CsvReader::CsvReader(
+    Historical::CsvParsingParams _parsingParams,
+    MappingParams _mappingParams,
+    std::unique_ptr<csv::CSVReader> _pReader
+) :
+    CsvReader(
+        std::move(_parsingParams),
+        std::move(_mappingParams),
+        std::move(_pReader),
+        Constant::Historical::ReadAheadRecordsCount
+    )
+{}
+
+CsvReader::~CsvReader()
+{
+    // Unblocks the reading thread, which is joined by std::jthread destructor.
+    mReadingThread.request_stop();
+    mReadAheadBuffer.close();
 }
 
 auto CsvReader::create(
@@ -36,14 +81,15 @@ auto CsvReader::create(
 ) -> std::unique_ptr<CsvReader>
 {
     csv::CSVFormat format = makeFormat(_parsingPrams);
-    csv::CSVReader csvReader{
+    // The file is memory-mapped and parsed chunk by chunk by the library.
+    auto csvReader = std::make_unique<csv::CSVReader>(
         _parsingPrams.datasource_connection(),
-        std::move(format)};
+        std::move(format));
 
     return std::make_unique<CsvReader>(
         std::move(_parsingPrams),
         std::move(_mappingParams),
-        csvReader
+        std::move(csvReader)
     );
 }
 
@@ -67,81 +113,106 @@ auto CsvReader::makeFormat(Historical::CsvParsingParams const& _parsingPrams)
 
 auto CsvReader::hasNextRecord() const noexcept -> bool
 {
-    return mNextRowIdx < mExtractedRows.size();
+    return !mReadAheadBuffer.drained() || mReadError != nullptr;
 }
 
 auto CsvReader::parseNextRecord(Historical::Record::Builder& _builder) -> void
 {
-    assert(hasNextRecord());
-
-    auto [rowNumber, csvRow] = mExtractedRows[mNextRowIdx++];
-
-    _builder.with_source_row(rowNumber)
-        .with_source_name(mParsingParams.datasource_name())
-        .with_source_connection(mParsingParams.datasource_connection());
+    std::optional<ParsedRow> parsed = mReadAheadBuffer.pop();
+    if (!parsed.has_value()) {
+        // The buffer is drained after the reading thread failed.
+        assert(mReadError != nullptr);
+        std::rethrow_exception(std::exchange(mReadError, nullptr));
+    }
 
-    Historical::Row const row = Historical::Row::from(csvRow);
-    Historical::parse(row, _builder, mMappingParams, depth_);
+    if (parsed->error) {
+        std::rethrow_exception(parsed->error);
+    }
+    _builder = std::move(parsed->builder);
 }
 
-auto CsvReader::make_depth_config(const csv::CSVReader& _reader) const
-    -> Mapping::DepthConfig {
-  const auto data_depth =
-      Mapping::depth_from_columns_number(columns_number(_reader));
+auto CsvReader::make_depth_config() const -> Mapping::DepthConfig {
+  const auto data_depth = Mapping::depth_from_columns_number(columns_number());
   const auto depth_to_parse = Mapping::depth_to_parse(
       data_depth, mParsingParams.datasource_max_depth_levels());
   return {.datasource_depth = data_depth, .depth_to_parse = depth_to_parse};
 }
 
-auto CsvReader::initMappingParams(csv::CSVReader const& _reader, Mapping::DepthConfig depth_config) -> void
+auto CsvReader::initMappingParams(Mapping::DepthConfig depth_config) -> void
 {
     if (mParsingParams.has_header_row()) {
-        std::vector<std::string> columnsNames = _reader.get_col_names();
+        std::vector<std::string> columnsNames = mReader->get_col_names();
         mMappingParams.initialize(std::move(columnsNames), std::move(depth_config));
     } else {
         mMappingParams.initialize(std::move(depth_config));
     }
 }
 
-auto CsvReader::loadCsvData(csv::CSVReader& _reader) -> void
+auto CsvReader::readNextDataRow() -> std::optional<SourceRow>
 {
-    // The csv parsing library trims all rows before header row and a header row
-    // itself. Thus, sentinel represents a 'global' row number with respect to
-    // possibly-trimmed rows. Sentinel itself is initialized as index (with 0),
-    // but is interpreted as a global row number inside a reading loop.
-
     std::uint64_t const dataRowNumber = mParsingParams.data_row();
-    std::uint64_t rowSentinel = [&]() -> std::uint64_t {
-        if (mParsingParams.has_header_row()) {
-            return mParsingParams.header_row();
+
+    csv::CSVRow row;
+    while (mReader->read_row(row)) {
+        if (++mRowSentinel >= dataRowNumber) {
+            return SourceRow{mRowSentinel, std::move(row)};
         }
-        return 0;
-    }();
-
-    std::for_each(
-        std::begin(_reader),
-        std::end(_reader),
-        [&](csv::CSVRow& _row) {
-            if (++rowSentinel >= dataRowNumber) {
-                mExtractedRows.emplace_back(rowSentinel, std::move(_row));
+    }
+    return std::nullopt;
+}
+
+auto CsvReader::parseRow(SourceRow const& _row) const -> ParsedRow
+{
+    auto const& [rowNumber, csvRow] = _row;
+
+    ParsedRow parsed{};
+    try {
+        parsed.builder.with_source_row(rowNumber)
+            .with_source_name(mParsingParams.datasource_name())
+            .with_source_connection(mParsingParams.datasource_connection());
+
+        Historical::Row const row = Historical::Row::from(csvRow);
+        Historical::parse(row, parsed.builder, mMappingParams, depth_);
+    } catch (...) {
+        // Reported by the consumer, as if the row was parsed on its thread.
+        parsed.error = std::current_exception();
+    }
+    return parsed;
+}
+
+auto CsvReader::readAhead(std::stop_token const& _stopToken) noexcept -> void
+{
+    try {
+        std::optional<SourceRow> row = std::exchange(mFirstDataRow, std::nullopt);
+        while (row.has_value() && !_stopToken.stop_requested()) {
+            if (!mReadAheadBuffer.push(parseRow(*row))) {
+                break;
             }
+            row = readNextDataRow();
         }
-    );
+    } catch (std::exception const& _ex) {
+        mReadError = std::make_exception_ptr(DataSourceReadError{fmt::format(
+            "failed to read rows of the `{}' CSV datasource after row {}: {}",
+            mParsingParams.datasource_name(),
+            mRowSentinel,
+            _ex.what())});
+    }
+
+    mReadAheadBuffer.close();
 }
 
-auto CsvReader::columns_number(const csv::CSVReader& reader) const
-    -> std::uint32_t {
+auto CsvReader::columns_number() const -> std::uint32_t {
   if (mParsingParams.has_header_row()) {
     const auto number =
-        static_cast<std::uint32_t>(reader.get_col_names().size());
+        static_cast<std::uint32_t>(mReader->get_col_names().size());
     simulator::log::debug("Got a number of columns {} from the header row.",
                           number);
     return number;
   }
 
-  if (!mExtractedRows.empty()) {
+  if (mFirstDataRow.has_value()) {
     const auto number =
-        static_cast<std::uint32_t>(mExtractedRows.front().second.size());
+        static_cast<std::uint32_t>(mFirstDataRow->second.size());
     simulator::log::debug("Got a number of columns {} from the first data row.",
                           number);
     return number;
@@ -1,25 +1,45 @@
 #include "ih/historical/adapters/data_access_adapter.hpp"
 
+#include <cstdint>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
+#include "cfg/api/cfg.hpp"
 #include "data_layer/api/models/datasource.hpp"
 #include "ih/historical/adapters/csv_reader.hpp"
 #include "ih/historical/adapters/postgresql_connector.hpp"
+#include "ih/historical/adapters/replay_file_reader.hpp"
 #include "ih/historical/data/record.hpp"
 #include "ih/historical/mapping/params.hpp"
 #include "ih/historical/parsing/params.hpp"
+#include "ih/historical/replay/replay_file.hpp"
 #include "log/logging.hpp"
 
 namespace Simulator::Generator::Historical {
 
-auto DataAccessAdapter::accept(RecordVisitor const& _visitor) noexcept -> void
+auto DataAccessAdapter::accept(RecordVisitor const& _visitor) -> void
+{
+    while (std::optional<Record> record = next()) {
+        try {
+            _visitor(std::move(*record));
+        } catch (std::exception const& _ex) {
+            simulator::log::warn("failed to process historical data record: {}",
+                                 _ex.what());
+        }
+    }
+}
+
+auto DataAccessAdapter::next() -> std::optional<Record>
 {
     while (hasNextRecord()) {
         Record::Builder builder{};
 
         try {
             parseNextRecord(builder);
+        } catch (DataSourceReadError const&) {
+            throw;
         } catch (std::exception const& _ex) {
             simulator::log::warn("failed to parse historical datasource row: {}",
                                  _ex.what());
@@ -27,13 +47,25 @@ auto DataAccessAdapter::accept(RecordVisitor const& _visitor) noexcept -> void
         }
 
         try {
-            Record record = Record::Builder::construct(std::move(builder));
-            _visitor(std::move(record));
+            return Record::Builder::construct(std::move(builder));
         } catch (std::exception const& _ex) {
             simulator::log::warn("failed to process historical data record: {}",
                                  _ex.what());
         }
     }
+
+    return std::nullopt;
+}
+
+auto DataAccessAdapter::parseNext() -> std::optional<Record>
+{
+    if (!hasNextRecord()) {
+        return std::nullopt;
+    }
+
+    Record::Builder builder{};
+    parseNextRecord(builder);
+    return Record::Builder::construct(std::move(builder));
 }
 
 auto DataAccessAdapterFactoryImpl::createDataAdapter(
@@ -55,6 +87,15 @@ auto DataAccessAdapterFactoryImpl::createCsvReader(
     DataLayer::Datasource const& _datasource
 ) -> std::unique_ptr<DataAccessAdapter>
 {
+    // A replay file, compiled from any datasource, is configured
+    // as a CSV datasource and is recognized by its content.
+    std::string const& connection = _datasource.connection();
+    if (ReplayFile::is_replay_file(connection)) {
+        simulator::log::info("reading `{}' as a compiled replay file",
+                             connection);
+        return ReplayFileReader::create(connection);
+    }
+
     CsvParsingParams parsing = make_csv_parsing_params(_datasource);
     MappingParams mapping = make_mapping_params(_datasource);
     return CsvReader::create(std::move(parsing), std::move(mapping));
@@ -65,6 +106,14 @@ auto DataAccessAdapterFactoryImpl::createPostgresDbReader(
 ) -> std::unique_ptr<DataAccessAdapter>
 {
     DatabaseParsingParams parsing = make_database_parsing_params(_datasource);
+    auto const& config = Cfg::generator();
+    if (config.historicalFetchSize.has_value()) {
+        parsing.set_fetch_size(
+            static_cast<std::uint32_t>(*config.historicalFetchSize));
+    }
+    parsing.set_partitions(
+        static_cast<std::uint32_t>(config.historicalPartitions));
+
     MappingParams mapping = make_mapping_params(_datasource);
     return PostgresConnector::create(std::move(parsing), std::move(mapping));
 }
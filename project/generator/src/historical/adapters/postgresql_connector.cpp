@@ -1,23 +1,37 @@
 #include "ih/historical/adapters/postgresql_connector.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include <pqxx/connection>
 #include <pqxx/result>
 #include <pqxx/row>
 #include <pqxx/transaction>
 
+#include "data_layer/api/converters/column_mapping.hpp"
+#include "ih/constants.hpp"
 #include "ih/historical/parsing/params.hpp"
 #include "ih/historical/parsing/parsing.hpp"
 #include "ih/historical/parsing/row.hpp"
 #include "log/logging.hpp"
 
 namespace Simulator::Generator::Historical {
+namespace {
+
+constexpr std::string_view CursorName{"historical_records"};
+
+} // namespace
 
 PostgresConnector::PostgresConnector(
     Historical::DatabaseParsingParams _params,
@@ -27,13 +41,45 @@ PostgresConnector::PostgresConnector(
     mMappingParams{std::move(_mappingParams)},
     mParsingParams{std::move(_params)}
 {
-    loadData(_connection);
+    pqxx::result const description = describeTable(_connection);
 
-    auto depth_config = make_depth_config(_connection);
+    auto depth_config =
+        make_depth_config(static_cast<std::uint32_t>(description.columns()));
     depth_ = depth_config.datasource_depth;
 
-    initMappingParams(std::move(depth_config));
-    extractData();
+    initMappingParams(description, std::move(depth_config));
+    initPartitions(_connection, description);
+
+    // The given connection reads the first partition, other partitions are
+    // read by dedicated connections, all of which are opened before reading
+    // starts, so that a failure to connect leaves no reading threads behind.
+    std::vector<pqxx::connection> connections{};
+    connections.push_back(std::move(_connection));
+    while (connections.size() < mPartitions.size()) {
+        connections.emplace_back(mParsingParams.datasource_connection());
+    }
+
+    for (std::size_t idx = 0; idx < mPartitions.size(); ++idx) {
+        Partition& partition = *mPartitions[idx];
+        mReadingThreads.emplace_back(
+            [this, &partition, connection = std::move(connections[idx])](
+                std::stop_token const& _stopToken
+            ) mutable {
+                readAhead(_stopToken, partition, std::move(connection));
+            });
+    }
+}
+
+PostgresConnector::~PostgresConnector()
+{
+    // Unblocks reading threads, which are joined by std::jthread destructors.
+    for (auto& thread : mReadingThreads) {
+        thread.request_stop();
+    }
+    for (auto& partition : mPartitions) {
+        partition->readAheadBuffer.close();
+    }
+    mReadingThreads.clear();
 }
 
 auto PostgresConnector::create(
@@ -49,74 +95,278 @@ auto PostgresConnector::create(
     );
 }
 
+auto PostgresConnector::makePartitionBoundsQuery(
+    std::string_view _table,
+    std::string_view _quotedTimeColumn,
+    std::uint32_t _partitions
+) -> std::string
+{
+    std::vector<std::string> percentiles{};
+    for (std::uint32_t idx = 1; idx < _partitions; ++idx) {
+        percentiles.push_back(fmt::format(
+            "percentile_disc({}) WITHIN GROUP (ORDER BY {})::text",
+            static_cast<double>(idx) / _partitions,
+            _quotedTimeColumn));
+    }
+
+    return fmt::format(
+        "SELECT {} FROM {} TABLESAMPLE SYSTEM ({});",
+        fmt::join(percentiles, ", "),
+        _table,
+        Constant::Historical::DatabasePartitionSamplePercent);
+}
+
+auto PostgresConnector::makeCursorQuery(
+    std::string_view _table,
+    std::optional<std::string> const& _quotedTimeColumn,
+    std::optional<std::string> const& _quotedLowerBound,
+    std::optional<std::string> const& _quotedUpperBound
+) -> std::string
+{
+    if (!_quotedTimeColumn.has_value()) {
+        return fmt::format("SELECT * FROM {}", _table);
+    }
+
+    // Receive times are compared as values of the column type,
+    // into which the text bounds are cast by the database.
+    std::vector<std::string> conditions{};
+    if (_quotedLowerBound.has_value()) {
+        conditions.push_back(fmt::format(
+            "{} >= {}", *_quotedTimeColumn, *_quotedLowerBound));
+    }
+    if (_quotedUpperBound.has_value()) {
+        conditions.push_back(fmt::format(
+            "{} < {}", *_quotedTimeColumn, *_quotedUpperBound));
+    }
+
+    if (conditions.empty()) {
+        return fmt::format(
+            "SELECT * FROM {} ORDER BY {}", _table, *_quotedTimeColumn);
+    }
+    return fmt::format(
+        "SELECT * FROM {} WHERE {} ORDER BY {}",
+        _table,
+        fmt::join(conditions, " AND "),
+        *_quotedTimeColumn);
+}
+
 auto PostgresConnector::hasNextRecord() const noexcept -> bool
 {
-    return mNextRowIdx < mExtractedRows.size();
+    return std::any_of(
+        std::next(mPartitions.begin(),
+                  static_cast<std::ptrdiff_t>(mNextPartitionIdx)),
+        mPartitions.end(),
+        [](auto const& _partition) {
+            return !_partition->readAheadBuffer.drained() ||
+                   _partition->readError != nullptr;
+        });
 }
 
 auto PostgresConnector::parseNextRecord(Record::Builder& _builder) -> void
 {
     assert(hasNextRecord());
 
-    auto& [rowNumber, pqRow] = mExtractedRows[mNextRowIdx++];
+    std::optional<ParsedRow> parsed{};
+    while (!parsed.has_value() && mNextPartitionIdx < mPartitions.size()) {
+        Partition& partition = *mPartitions[mNextPartitionIdx];
+        parsed = partition.readAheadBuffer.pop();
+        if (parsed.has_value()) {
+            break;
+        }
 
-    _builder.with_source_row(rowNumber)
-        .with_source_name(mParsingParams.datasource_name())
-        .with_source_connection(mParsingParams.datasource_connection());
+        ++mNextPartitionIdx;
+        if (partition.readError != nullptr) {
+            std::rethrow_exception(std::exchange(partition.readError, nullptr));
+        }
+    }
+    assert(parsed.has_value());
 
-    Historical::Row const row = Historical::Row::from(pqRow);
-    Historical::parse(row, _builder, mMappingParams, depth_);
+    ++mRowNumber;
+    if (parsed->error) {
+        std::rethrow_exception(parsed->error);
+    }
+    _builder = std::move(parsed->builder);
+    _builder.with_source_row(mRowNumber);
 }
 
-auto PostgresConnector::loadData(pqxx::connection& _databaseConnection) -> void
+auto PostgresConnector::describeTable(
+    pqxx::connection& _databaseConnection
+) const -> pqxx::result
 {
     pqxx::work transaction{_databaseConnection};
-    mData = transaction.exec(
-        fmt::format("SELECT * FROM {};", mParsingParams.table_name())
+    pqxx::result description = transaction.exec(
+        fmt::format("SELECT * FROM {} LIMIT 0;", mParsingParams.table_name())
     );
+
+    simulator::log::debug("Selected number of columns {}.",
+                          description.columns());
+    return description;
 }
 
-auto PostgresConnector::make_depth_config(
-    pqxx::connection& database_connection) const -> Mapping::DepthConfig {
-  const auto data_depth =
-      Mapping::depth_from_columns_number(columns_number(database_connection));
+auto PostgresConnector::make_depth_config(std::uint32_t columns_number) const
+    -> Mapping::DepthConfig {
+  const auto data_depth = Mapping::depth_from_columns_number(columns_number);
   const auto depth_to_parse = Mapping::depth_to_parse(
       data_depth, mParsingParams.datasource_max_depth_levels());
   return {.datasource_depth = data_depth, .depth_to_parse = depth_to_parse};
 }
 
-auto PostgresConnector::initMappingParams(Mapping::DepthConfig depth_config)
-    -> void {
-    std::int32_t const columnsCount = mData.columns();
+auto PostgresConnector::initMappingParams(
+    pqxx::result const& _description,
+    Mapping::DepthConfig depth_config
+) -> void {
+    std::int32_t const columnsCount = _description.columns();
 
     std::vector<std::string> columnNames{};
     columnNames.reserve(static_cast<std::uint32_t>(columnsCount));
 
     for (std::int32_t rowIdx = 0; rowIdx < columnsCount; ++rowIdx) {
-        std::string_view const columnName = mData.column_name(rowIdx);
+        std::string_view const columnName = _description.column_name(rowIdx);
         columnNames.emplace_back(columnName);
     }
 
     mMappingParams.initialize(std::move(columnNames), std::move(depth_config));
 }
 
-auto PostgresConnector::extractData() -> void
+auto PostgresConnector::initPartitions(
+    pqxx::connection& _databaseConnection,
+    pqxx::result const& _description
+) -> void
+{
+    using ColumnFrom = DataLayer::Converter::ColumnFrom;
+
+    // Each partition buffers its own share of the read-ahead rows.
+    std::uint32_t const requested = mParsingParams.partitions();
+    std::size_t const readAheadCapacity =
+        std::max<std::size_t>(
+            Constant::Historical::ReadAheadRecordsCount / requested,
+            mParsingParams.fetch_size());
+
+    auto const timeColumnIdx =
+        mMappingParams.column_idx(ColumnFrom::ReceivedTimestamp);
+    if (requested > 1 && timeColumnIdx.has_value() &&
+        *timeColumnIdx < static_cast<std::uint32_t>(_description.columns())) {
+        mTimeColumn = _description.column_name(
+            static_cast<pqxx::row::size_type>(*timeColumnIdx));
+    } else if (requested > 1) {
+        simulator::log::warn(
+            "unable to partition the `{}' PostgreSQL datasource: "
+            "receive time column is not mapped, the table is read "
+            "by a single connection",
+            mParsingParams.datasource_name());
+    }
+
+    if (!mTimeColumn.has_value()) {
+        mPartitions.push_back(std::make_unique<Partition>(readAheadCapacity));
+        return;
+    }
+
+    // Boundaries split the table into ranges of about the same size,
+    // a table too small to be sampled is read by a single connection.
+    pqxx::work transaction{_databaseConnection};
+    pqxx::row const selected = transaction.exec1(makePartitionBoundsQuery(
+        mParsingParams.table_name(),
+        _databaseConnection.quote_name(*mTimeColumn),
+        requested));
+    transaction.commit();
+
+    std::vector<std::string> bounds{};
+    for (pqxx::field const& field : selected) {
+        if (!field.is_null() &&
+            (bounds.empty() || bounds.back() != field.view())) {
+            bounds.emplace_back(field.view());
+        }
+    }
+
+    for (std::size_t idx = 0; idx <= bounds.size(); ++idx) {
+        auto& partition =
+            mPartitions.emplace_back(
+                std::make_unique<Partition>(readAheadCapacity));
+        if (idx > 0) {
+            partition->lowerBound = bounds[idx - 1];
+        }
+        if (idx < bounds.size()) {
+            partition->upperBound = bounds[idx];
+        }
+    }
+
+    simulator::log::info(
+        "the `{}' PostgreSQL datasource is read by {} connections "
+        "partitioned by `{}' column",
+        mParsingParams.datasource_name(),
+        mPartitions.size(),
+        *mTimeColumn);
+}
+
+auto PostgresConnector::parseRow(pqxx::row const& _row) const -> ParsedRow
 {
-    std::uint64_t rowNumber{1};
-    for (pqxx::row row : mData) {
-        mExtractedRows.emplace_back(rowNumber++, std::move(row));
+    ParsedRow parsed{};
+    try {
+        parsed.builder.with_source_name(mParsingParams.datasource_name())
+            .with_source_connection(mParsingParams.datasource_connection());
+
+        Historical::Row const row = Historical::Row::from(_row);
+        Historical::parse(row, parsed.builder, mMappingParams, depth_);
+    } catch (...) {
+        // Reported by the consumer, as if the row was parsed on its thread.
+        parsed.error = std::current_exception();
     }
+    return parsed;
 }
 
-auto PostgresConnector::columns_number(
-    pqxx::connection& database_connection) const -> std::uint32_t {
-  pqxx::work transaction{database_connection};
-  pqxx::result result = transaction.exec(
-      fmt::format("SELECT * FROM {} LIMIT 1;", mParsingParams.table_name()));
+auto PostgresConnector::readAhead(
+    std::stop_token const& _stopToken,
+    Partition& _partition,
+    pqxx::connection _connection
+) noexcept -> void
+{
+    try {
+        // A cursor lives until the end of the transaction, thus a read-only
+        // transaction is kept open while the partition is being read.
+        pqxx::read_transaction transaction{_connection};
+        auto const quote = [&_connection](auto const& _bound) {
+            return _bound.has_value()
+                       ? std::make_optional(_connection.quote(*_bound))
+                       : std::nullopt;
+        };
+        auto const timeColumn =
+            mTimeColumn.has_value()
+                ? std::make_optional(_connection.quote_name(*mTimeColumn))
+                : std::nullopt;
+        transaction.exec0(fmt::format(
+            "DECLARE {} NO SCROLL CURSOR FOR {};",
+            CursorName,
+            makeCursorQuery(
+                mParsingParams.table_name(),
+                timeColumn,
+                quote(_partition.lowerBound),
+                quote(_partition.upperBound))));
+
+        std::string const fetch = fmt::format(
+            "FETCH FORWARD {} FROM {};",
+            mParsingParams.fetch_size(),
+            CursorName);
+
+        bool reading{true};
+        while (reading && !_stopToken.stop_requested()) {
+            pqxx::result const chunk = transaction.exec(fetch);
+            reading = !chunk.empty();
+            for (pqxx::row const& row : chunk) {
+                if (!_partition.readAheadBuffer.push(parseRow(row))) {
+                    reading = false;
+                    break;
+                }
+            }
+        }
+    } catch (std::exception const& _ex) {
+        _partition.readError =
+            std::make_exception_ptr(DataSourceReadError{fmt::format(
+                "failed to read rows of the `{}' PostgreSQL datasource: {}",
+                mParsingParams.datasource_name(),
+                _ex.what())});
+    }
 
-  const auto number = static_cast<std::uint32_t>(result.columns());
-  simulator::log::debug("Selected number of columns {}.", number);
-  return number;
+    _partition.readAheadBuffer.close();
 }
 
 } // namespace Simulator::Generator::Historical
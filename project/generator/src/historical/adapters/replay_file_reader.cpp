@@ -0,0 +1,238 @@
+#include "ih/historical/adapters/replay_file_reader.hpp"
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/data/time.hpp"
+#include "ih/historical/replay/replay_file.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+auto to_timepoint(std::int64_t nanoseconds) noexcept -> Historical::Timepoint {
+  return Historical::Timepoint{
+      std::chrono::duration_cast<Historical::Timepoint::duration>(
+          std::chrono::nanoseconds{nanoseconds})};
+}
+
+auto from_column_value(double value) noexcept -> std::optional<double> {
+  return std::isnan(value) ? std::nullopt : std::make_optional(value);
+}
+
+auto make_system_error(int error,
+                       const std::string& action,
+                       const std::string& path) -> std::system_error {
+  return std::system_error{error,
+                           std::generic_category(),
+                           fmt::format("unable to {} `{}'", action, path)};
+}
+
+}  // namespace
+
+ReplayFileReader::ReplayFileReader(const std::string& path) {
+  const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor == -1) {
+    throw make_system_error(errno, "open replay file", path);
+  }
+
+  struct stat status {};
+  if (::fstat(descriptor, &status) == -1) {
+    const auto error = make_system_error(errno, "stat replay file", path);
+    ::close(descriptor);
+    throw error;
+  }
+
+  mapping_size_ = static_cast<std::size_t>(status.st_size);
+  if (mapping_size_ < sizeof(ReplayFile::Header)) {
+    ::close(descriptor);
+    throw std::runtime_error{
+        fmt::format("`{}' is too small to be a replay file", path)};
+  }
+
+  void* mapping =
+      ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  const int mapping_error = errno;
+  // The mapping remains valid after the descriptor is closed.
+  ::close(descriptor);
+  if (mapping == MAP_FAILED) {
+    throw make_system_error(mapping_error, "map replay file", path);
+  }
+  mapping_ = mapping;
+  // Records are usually replayed from the first to the last one.
+  ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+
+  try {
+    validate(path);
+    decode_strings();
+  } catch (...) {
+    ::munmap(mapping_, mapping_size_);
+    throw;
+  }
+
+  receive_times_ = section<std::int64_t>(layout_.receive_times);
+  message_times_ = section<std::int64_t>(layout_.message_times);
+  source_rows_ = section<std::uint64_t>(layout_.source_rows);
+  instruments_ = section<std::uint32_t>(layout_.instruments);
+  sources_ = section<std::uint32_t>(layout_.sources);
+  levels_begin_ = section<std::uint64_t>(layout_.levels_begin);
+  bid_prices_ = section<double>(layout_.bid_prices);
+  bid_quantities_ = section<double>(layout_.bid_quantities);
+  offer_prices_ = section<double>(layout_.offer_prices);
+  offer_quantities_ = section<double>(layout_.offer_quantities);
+  bid_counterparties_ = section<std::uint32_t>(layout_.bid_counterparties);
+  offer_counterparties_ = section<std::uint32_t>(layout_.offer_counterparties);
+  source_table_ = section<ReplayFile::SourceEntry>(layout_.source_table);
+}
+
+ReplayFileReader::~ReplayFileReader() { ::munmap(mapping_, mapping_size_); }
+
+auto ReplayFileReader::create(const std::string& path)
+    -> std::unique_ptr<ReplayFileReader> {
+  return std::make_unique<ReplayFileReader>(path);
+}
+
+auto ReplayFileReader::size() const noexcept -> std::size_t {
+  return header_.records_count;
+}
+
+auto ReplayFileReader::hasNextRecord() const noexcept -> bool {
+  return next_record_ < size();
+}
+
+auto ReplayFileReader::parseNextRecord(Record::Builder& builder) -> void {
+  assert(hasNextRecord());
+  const std::size_t record = next_record_++;
+
+  builder.with_source_row(source_rows_[record])
+      .with_receive_time(to_timepoint(receive_times_[record]));
+  if (message_times_[record] != ReplayFile::NoTime) {
+    builder.with_message_time(to_timepoint(message_times_[record]));
+  }
+  if (const auto* instrument = string(instruments_[record])) {
+    builder.with_instrument(*instrument);
+  }
+
+  if (sources_[record] >= header_.sources_count) {
+    throw std::runtime_error{"replay file record refers to unknown source"};
+  }
+  const ReplayFile::SourceEntry& source = source_table_[sources_[record]];
+  if (const auto* name = string(source.name)) {
+    builder.with_source_name(*name);
+  }
+  if (const auto* connection = string(source.connection)) {
+    builder.with_source_connection(*connection);
+  }
+
+  const std::uint64_t begin = levels_begin_[record];
+  const std::uint64_t end = levels_begin_[record + 1];
+  if (begin > end || end > header_.levels_count) {
+    throw std::runtime_error{"replay file record refers to unknown levels"};
+  }
+  for (std::uint64_t position = begin; position < end; ++position) {
+    builder.add_level(position - begin, level(position));
+  }
+}
+
+auto ReplayFileReader::validate(const std::string& path) -> void {
+  std::memcpy(&header_, mapping_, sizeof(ReplayFile::Header));
+
+  if (header_.magic != ReplayFile::Magic) {
+    throw std::runtime_error{
+        fmt::format("`{}' is not a replay file", path)};
+  }
+  if (header_.version != ReplayFile::Version) {
+    throw std::runtime_error{
+        fmt::format("`{}' replay file has unsupported version {}, "
+                    "expected version {}, the file has to be recompiled",
+                    path,
+                    header_.version,
+                    ReplayFile::Version)};
+  }
+
+  // Every count is bounded by the file size, which also prevents overflows
+  // while the layout is being computed.
+  const bool counts_fit = header_.records_count < mapping_size_ &&
+                          header_.levels_count < mapping_size_ &&
+                          header_.sources_count < mapping_size_ &&
+                          header_.strings_count < mapping_size_ &&
+                          header_.strings_size < mapping_size_;
+  layout_ = ReplayFile::make_layout(header_);
+  if (!counts_fit || layout_.file_size > mapping_size_) {
+    throw std::runtime_error{
+        fmt::format("`{}' replay file is truncated or corrupted", path)};
+  }
+}
+
+template <typename T>
+auto ReplayFileReader::section(std::size_t offset) const noexcept -> const T* {
+  const auto* const data = static_cast<const char*>(mapping_) + offset;
+  assert(reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0);
+  // NOLINTNEXTLINE(*reinterpret-cast*)
+  return reinterpret_cast<const T*>(data);
+}
+
+auto ReplayFileReader::decode_strings() -> void {
+  const auto* const offsets = section<std::uint64_t>(layout_.string_offsets);
+  const auto* const data = section<char>(layout_.string_data);
+
+  strings_.reserve(header_.strings_count);
+  for (std::size_t id = 0; id < header_.strings_count; ++id) {
+    const std::uint64_t begin = offsets[id];
+    const std::uint64_t end = offsets[id + 1];
+    if (begin > end || end > header_.strings_size) {
+      throw std::runtime_error{"replay file string table is corrupted"};
+    }
+    strings_.emplace_back(data + begin, data + end);
+  }
+}
+
+auto ReplayFileReader::string(std::uint32_t id) const -> const std::string* {
+  if (id == ReplayFile::NoString) {
+    return nullptr;
+  }
+  if (id >= strings_.size()) {
+    throw std::runtime_error{"replay file record refers to unknown string"};
+  }
+  return &strings_[id];
+}
+
+auto ReplayFileReader::level(std::size_t position) const -> Level {
+  Level::Builder builder;
+  if (const auto price = from_column_value(bid_prices_[position])) {
+    builder.with_bid_price(*price);
+  }
+  if (const auto quantity = from_column_value(bid_quantities_[position])) {
+    builder.with_bid_quantity(*quantity);
+  }
+  if (const auto* party = string(bid_counterparties_[position])) {
+    builder.with_bid_counterparty(*party);
+  }
+  if (const auto price = from_column_value(offer_prices_[position])) {
+    builder.with_offer_price(*price);
+  }
+  if (const auto quantity = from_column_value(offer_quantities_[position])) {
+    builder.with_offer_quantity(*quantity);
+  }
+  if (const auto* party = string(offer_counterparties_[position])) {
+    builder.with_offer_counterparty(*party);
+  }
+  return Level::Builder::construct(std::move(builder));
+}
+
+}  // namespace Simulator::Generator::Historical
@@ -1,14 +1,24 @@
 #include "ih/historical/data/provider.hpp"
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <exception>
+#include <future>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "data_layer/api/models/datasource.hpp"
 #include "ih/historical/adapters/data_access_adapter.hpp"
 #include "ih/historical/data/record.hpp"
+#include "ih/historical/data/record_store.hpp"
 #include "ih/historical/data/time.hpp"
+#include "ih/historical/replay/replay_clock.hpp"
 #include "log/logging.hpp"
 
 namespace Simulator::Generator::Historical {
@@ -21,6 +31,7 @@ auto DataProvider::prepare(Historical::DataAccessAdapter& _adapter)
         add(std::move(_record));
         ++recordsAccepted;
     });
+    onPrepared();
     return recordsAccepted;
 }
 
@@ -53,120 +64,293 @@ auto DataProvider::getTimeOffset() const noexcept -> Historical::Duration
     return mOptTimeOffset.value_or(Historical::Duration{0});
 }
 
+auto DataProvider::useClock(std::shared_ptr<ReplayClock const> _pClock) noexcept
+    -> void
+{
+    mClock = std::move(_pClock);
+}
+
 auto DataProvider::setTimeOffset(Historical::Duration _offset) noexcept -> void
 {
     mOptTimeOffset = _offset;
 }
 
+auto DataProvider::makeTimeOffset(
+    Historical::Timepoint _historicalTime
+) const noexcept -> Historical::Duration
+{
+    return mClock != nullptr
+               ? Historical::Time::makeOffset(_historicalTime, mClock->now())
+               : Historical::Time::makeOffset(_historicalTime);
+}
+
 
-auto FiniteProvider::isEmpty() const noexcept -> bool
+RepeatingProvider::RepeatingProvider() :
+    mRecords{Historical::RecordStore::create()}
+{}
+
+auto RepeatingProvider::isEmpty() const noexcept -> bool
 {
-    return mRecords.empty();
+    return mRecords->empty();
 }
 
-auto FiniteProvider::initializeTimeOffset() noexcept -> void
+auto RepeatingProvider::initializeTimeOffset() noexcept -> void
 {
     if (isEmpty()) {
         return;
     }
 
-    assert(!mRecords.empty());
-    auto const& nextRecTime = mRecords.front().receive_time();
-    auto const timeOffset = Historical::Time::makeOffset(nextRecTime);
+    if (mNextRecordIdx == mRecords->size()) {
+        mNextRecordIdx = 0;
+    }
+
+    assert(mNextRecordIdx < mRecords->size());
+    auto const nextRecTime = mRecords->receive_time(mNextRecordIdx);
+    auto const timeOffset = makeTimeOffset(nextRecTime);
     DataProvider::setTimeOffset(timeOffset);
 }
 
-auto FiniteProvider::add(Historical::Record _record) -> void
+auto RepeatingProvider::add(Historical::Record _record) -> void
+{
+    mRecords->add(_record);
+}
+
+auto RepeatingProvider::onPrepared() -> void
 {
-    mRecords.emplace_back(std::move(_record));
+    mRecords->shrink_to_fit();
 }
 
-auto FiniteProvider::pullInto(Historical::Action::Builder& _pulledActionBuilder)
-    -> void
+
+auto RepeatingProvider::pullInto(
+    Historical::Action::Builder& _pulledActionBuilder
+) -> void
 {
     // Should be checked in parent template method
+    assert(!isEmpty());
+
+    if (mNextRecordIdx == mRecords->size()) {
+        initializeTimeOffset();
+    }
+
     assert(hasTimeOffset());
-    assert(!mRecords.empty());
+    assert(mNextRecordIdx < mRecords->size());
 
     auto const timeOffset = getTimeOffset();
     std::optional<Historical::Timepoint> prevRecTime{};
-    while (!mRecords.empty()) {
-        auto const nextRecTime = mRecords.front().receive_time();
+    while (mNextRecordIdx < mRecords->size()) {
+        auto const nextRecTime = mRecords->receive_time(mNextRecordIdx);
         if (prevRecTime.value_or(nextRecTime) != nextRecTime) {
             break;
         }
 
         prevRecTime = nextRecTime;
-        auto nextRec = std::move(mRecords.front());
-        mRecords.pop_front();
-
-        _pulledActionBuilder.add(std::move(nextRec), timeOffset);
+        _pulledActionBuilder.add(mRecords->record(mNextRecordIdx), timeOffset);
+        ++mNextRecordIdx;
     }
 }
 
 
-auto RepeatingProvider::isEmpty() const noexcept -> bool
+StreamingProvider::StreamingProvider(
+    std::unique_ptr<Historical::DataAccessAdapter> _pAdapter
+) :
+    mAdapter{std::move(_pAdapter)}
 {
-    return mRecords.empty() && mProcessedRecords.empty();
+    assert(mAdapter);
+    mNextRecord = mAdapter->next();
 }
 
-auto RepeatingProvider::initializeTimeOffset() noexcept -> void
+auto StreamingProvider::isEmpty() const noexcept -> bool
+{
+    return !mNextRecord.has_value();
+}
+
+auto StreamingProvider::initializeTimeOffset() noexcept -> void
 {
     if (isEmpty()) {
         return;
     }
 
-    if (mRecords.empty()) {
-        assert(!mProcessedRecords.empty());
-        std::swap(mRecords, mProcessedRecords);
-    }
-
-    assert(!mRecords.empty());
-    auto const& nextRecTime = mRecords.front().receive_time();
-    auto const timeOffset = Historical::Time::makeOffset(nextRecTime);
+    auto const& nextRecTime = mNextRecord->receive_time();
+    auto const timeOffset = makeTimeOffset(nextRecTime);
     DataProvider::setTimeOffset(timeOffset);
 }
 
-auto RepeatingProvider::add(Historical::Record _record) -> void
+auto StreamingProvider::add(Historical::Record _record) -> void
 {
-    mRecords.emplace_back(std::move(_record));
+    // Records are pulled from the adapter on demand.
+    throw std::logic_error{fmt::format(
+        "unable to add historical record from source row {} - streaming data "
+        "provider does not store records",
+        _record.source_row())};
 }
 
-
-auto RepeatingProvider::pullInto(
+auto StreamingProvider::pullInto(
     Historical::Action::Builder& _pulledActionBuilder
 ) -> void
 {
     // Should be checked in parent template method
-    assert(!isEmpty());
+    assert(hasTimeOffset());
+    assert(mNextRecord.has_value());
 
-    if (mRecords.empty()) {
-        assert(!mProcessedRecords.empty());
-        std::swap(mRecords, mProcessedRecords);
-        initializeTimeOffset();
+    auto const timeOffset = getTimeOffset();
+    std::optional<Historical::Timepoint> prevRecTime{};
+    while (mNextRecord.has_value()) {
+        auto const nextRecTime = mNextRecord->receive_time();
+        if (prevRecTime.value_or(nextRecTime) != nextRecTime) {
+            break;
+        }
+
+        prevRecTime = nextRecTime;
+        // The provider stays empty, if the adapter fails to be read.
+        _pulledActionBuilder.add(
+            *std::exchange(mNextRecord, std::nullopt), timeOffset);
+        mNextRecord = mAdapter->next();
+    }
+}
+
+
+// Pulls records directly from an adapter. CSV and PostgreSQL adapters
+// read their datasources ahead by their own threads, so sources are read
+// concurrently without a buffer of their own.
+class MergingProvider::Source {
+  public:
+    explicit Source(std::unique_ptr<Historical::DataAccessAdapter> _pAdapter) :
+        mAdapter{std::move(_pAdapter)}
+    {
+        assert(mAdapter);
+    }
+
+    // Waits until the next record is read or the datasource is drained.
+    // Throws when the datasource has failed to be read.
+    auto advance() -> void
+    {
+        mNextRecord.reset();
+        mNextRecord = mAdapter->next();
+    }
+
+    [[nodiscard]]
+    auto nextRecord() noexcept -> std::optional<Historical::Record>&
+    {
+        return mNextRecord;
+    }
+
+    [[nodiscard]]
+    auto nextRecord() const noexcept -> std::optional<Historical::Record> const&
+    {
+        return mNextRecord;
     }
 
+  private:
+    std::unique_ptr<Historical::DataAccessAdapter> mAdapter;
+    std::optional<Historical::Record> mNextRecord;
+};
+
+MergingProvider::MergingProvider(Adapters _adapters)
+{
+    mSources.reserve(_adapters.size());
+    for (auto& pAdapter : _adapters) {
+        mSources.emplace_back(std::make_unique<Source>(std::move(pAdapter)));
+    }
+
+    mSourcesHeap.reserve(mSources.size());
+    for (std::size_t sourceIdx = 0; sourceIdx < mSources.size(); ++sourceIdx) {
+        mSources[sourceIdx]->advance();
+        if (mSources[sourceIdx]->nextRecord().has_value()) {
+            mSourcesHeap.push_back(sourceIdx);
+            std::push_heap(
+                mSourcesHeap.begin(),
+                mSourcesHeap.end(),
+                [this](std::size_t _lhs, std::size_t _rhs) {
+                    return receivedLater(_lhs, _rhs);
+                });
+        }
+    }
+}
+
+MergingProvider::~MergingProvider() = default;
+
+auto MergingProvider::isEmpty() const noexcept -> bool
+{
+    return mSourcesHeap.empty();
+}
+
+auto MergingProvider::initializeTimeOffset() noexcept -> void
+{
+    if (isEmpty()) {
+        return;
+    }
+
+    auto const timeOffset = makeTimeOffset(nextRecordTime());
+    DataProvider::setTimeOffset(timeOffset);
+}
+
+auto MergingProvider::add(Historical::Record _record) -> void
+{
+    // Records are pulled from the merged sources on demand.
+    throw std::logic_error{fmt::format(
+        "unable to add historical record from source row {} - merging data "
+        "provider does not store records",
+        _record.source_row())};
+}
+
+auto MergingProvider::pullInto(
+    Historical::Action::Builder& _pulledActionBuilder
+) -> void
+{
+    // Should be checked in parent template method
     assert(hasTimeOffset());
-    assert(!mRecords.empty());
+    assert(!isEmpty());
 
     auto const timeOffset = getTimeOffset();
     std::optional<Historical::Timepoint> prevRecTime{};
-    while (!mRecords.empty()) {
-        auto const nextRecTime = mRecords.front().receive_time();
+    while (!isEmpty()) {
+        auto const nextRecTime = nextRecordTime();
         if (prevRecTime.value_or(nextRecTime) != nextRecTime) {
             break;
         }
 
         prevRecTime = nextRecTime;
+        _pulledActionBuilder.add(popNextRecord(), timeOffset);
+    }
+}
 
-        auto nextRec = std::move(mRecords.front());
-        mRecords.pop_front();
-        mProcessedRecords.push_back(nextRec);
+auto MergingProvider::nextRecordTime() const noexcept -> Historical::Timepoint
+{
+    assert(!isEmpty());
+    return mSources[mSourcesHeap.front()]->nextRecord()->receive_time();
+}
 
-        _pulledActionBuilder.add(std::move(nextRec), timeOffset);
+auto MergingProvider::popNextRecord() -> Historical::Record
+{
+    assert(!isEmpty());
+    auto const later = [this](std::size_t _lhs, std::size_t _rhs) {
+        return receivedLater(_lhs, _rhs);
+    };
+
+    std::pop_heap(mSourcesHeap.begin(), mSourcesHeap.end(), later);
+    std::size_t const sourceIdx = mSourcesHeap.back();
+    mSourcesHeap.pop_back();
+    Source& source = *mSources[sourceIdx];
+
+    // A source, which fails to be read, is not merged any further.
+    Historical::Record record = std::move(*source.nextRecord());
+    source.advance();
+    if (source.nextRecord().has_value()) {
+        mSourcesHeap.push_back(sourceIdx);
+        std::push_heap(mSourcesHeap.begin(), mSourcesHeap.end(), later);
     }
+    return record;
 }
 
+auto MergingProvider::receivedLater(
+    std::size_t _lhs,
+    std::size_t _rhs
+) const noexcept -> bool
+{
+    auto const lhsTime = mSources[_lhs]->nextRecord()->receive_time();
+    auto const rhsTime = mSources[_rhs]->nextRecord()->receive_time();
+    return lhsTime != rhsTime ? lhsTime > rhsTime : _lhs > _rhs;
+}
 
 DataProvidersFactoryImpl::DataProvidersFactoryImpl() :
     DataProvidersFactoryImpl(std::make_unique<DataAccessAdapterFactoryImpl>())
@@ -185,16 +369,21 @@ auto DataProvidersFactoryImpl::createProvider(
 ) const -> std::unique_ptr<DataProvider>
 {
     auto pDataAdapter = mDataAdapterFactory->createDataAdapter(_datasource);
-    auto pDataProvider = [&]() -> std::unique_ptr<DataProvider> {
-        if (_datasource.repeat_flag().value_or(false)) {
-            return std::make_unique<RepeatingProvider>();
-        }
-        return std::make_unique<FiniteProvider>();
-    }();
-
     assert(pDataAdapter);
-    assert(pDataProvider);
 
+    if (!_datasource.repeat_flag().value_or(false)) {
+        simulator::log::info(
+            "created a streaming data provider for a `{}' datasource "
+            "(DatasourceID: {} connection: {})",
+            _datasource.name(),
+            _datasource.datasource_id(),
+            _datasource.connection());
+        return std::make_unique<StreamingProvider>(std::move(pDataAdapter));
+    }
+
+    // A repeating provider replays processed records again,
+    // so all of them are prepared in advance.
+    auto pDataProvider = std::make_unique<RepeatingProvider>();
     std::size_t const recordsRead = pDataProvider->prepare(*pDataAdapter);
 
     simulator::log::info(
@@ -208,4 +397,58 @@ auto DataProvidersFactoryImpl::createProvider(
     return pDataProvider;
 }
 
+auto DataProvidersFactoryImpl::createMergingProvider(
+    std::vector<DataLayer::Datasource> const& _datasources
+) const -> std::unique_ptr<DataProvider>
+{
+    std::vector<std::future<std::unique_ptr<DataAccessAdapter>>> pendingAdapters;
+    pendingAdapters.reserve(_datasources.size());
+    for (DataLayer::Datasource const& datasource : _datasources) {
+        pendingAdapters.push_back(std::async(std::launch::async, [&] {
+            return mDataAdapterFactory->createDataAdapter(datasource);
+        }));
+    }
+
+    MergingProvider::Adapters adapters;
+    adapters.reserve(_datasources.size());
+    for (std::size_t idx = 0; idx < _datasources.size(); ++idx) {
+        DataLayer::Datasource const& datasource = _datasources[idx];
+        try {
+            adapters.push_back(pendingAdapters[idx].get());
+        } catch (std::exception const& _ex) {
+            simulator::log::warn(
+                "failed to open a `{}' datasource (DatasourceID: {}) for a "
+                "merged replay, the datasource is skipped: {}",
+                datasource.name(),
+                datasource.datasource_id(),
+                _ex.what());
+            continue;
+        }
+
+        if (datasource.repeat_flag().value_or(false)) {
+            simulator::log::warn(
+                "repeat flag of a `{}' datasource (DatasourceID: {}) is "
+                "ignored, merged datasources are replayed once",
+                datasource.name(),
+                datasource.datasource_id());
+        }
+    }
+
+    if (adapters.empty()) {
+        throw std::runtime_error{fmt::format(
+            "none of {} datasources can be opened for a merged replay",
+            _datasources.size())};
+    }
+
+    std::size_t const sourcesCount = adapters.size();
+    auto pDataProvider = std::make_unique<MergingProvider>(std::move(adapters));
+
+    simulator::log::info(
+        "created a merging data provider for {} of {} datasources",
+        sourcesCount,
+        _datasources.size());
+
+    return pDataProvider;
+}
+
 } // namespace Simulator::Generator::Historical
@@ -4,12 +4,16 @@
 #include <fmt/format.h>
 
 #include <cassert>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "core/common/std_formatter.hpp"
+#include "ih/historical/data/record_store.hpp"
 #include "ih/historical/data/time.hpp"
 
 namespace Simulator::Generator::Historical {
@@ -40,6 +44,17 @@ auto Level::offer_counterparty() const noexcept
   return offer_counterparty_;
 }
 
+LevelView::LevelView(const Level& level) noexcept
+    : bid_price{level.bid_price()},
+      bid_quantity{level.bid_quantity()},
+      bid_counterparty{level.bid_counterparty() ? &*level.bid_counterparty()
+                                                : nullptr},
+      offer_price{level.offer_price()},
+      offer_quantity{level.offer_quantity()},
+      offer_counterparty{level.offer_counterparty()
+                             ? &*level.offer_counterparty()
+                             : nullptr} {}
+
 auto Level::Builder::with_bid_price(double px) noexcept -> Level::Builder& {
   bid_price_ = px;
   return *this;
@@ -94,7 +109,7 @@ auto Level::Builder::construct(Level::Builder builder) noexcept -> Level {
 }
 
 auto Record::instrument() const noexcept -> const std::string& {
-  return instrument_;
+  return store_ ? store_->instrument(store_index_) : content().instrument;
 }
 
 auto Record::receive_time() const noexcept -> Historical::Timepoint {
@@ -108,24 +123,41 @@ auto Record::message_time() const noexcept
 
 auto Record::source_connection() const noexcept
     -> const std::optional<std::string>& {
-  return source_conn_;
+  return store_ ? store_->source_connection(store_index_)
+                : content().source_conn;
 }
 
 auto Record::source_name() const noexcept -> const std::optional<std::string>& {
-  return source_name_;
+  return store_ ? store_->source_name(store_index_) : content().source_name;
 }
 
 auto Record::source_row() const noexcept -> std::uint64_t {
   return source_row_;
 }
 
-auto Record::has_levels() const noexcept -> bool { return !levels_.empty(); }
+auto Record::has_levels() const noexcept -> bool {
+  return store_ ? store_->levels_count(store_index_) > 0
+                : !content().levels.empty();
+}
 
 auto Record::steal_levels(const LevelStealer& stealer) -> void {
   std::vector<Level> stolen_levels;
-  std::swap(levels_, stolen_levels);
+  if (content_ && content_.use_count() == 1) {
+    stolen_levels = std::move(content_->levels);
+    content_->levels.clear();
+  } else {
+    // The content may be shared with other copies of the record, or the
+    // record is a view of a stored one, so the levels are copied.
+    stolen_levels = store_ ? store_->levels(store_index_) : content().levels;
+    content_ = std::make_shared<Content>(
+        Content{.levels = {},
+                .source_name = source_name(),
+                .source_conn = source_connection(),
+                .instrument = instrument()});
+    store_.reset();
+  }
 
-  assert(levels_.empty());
+  assert(!has_levels());
 
   for (std::uint64_t levelIdx = 0; levelIdx < stolen_levels.size();
        ++levelIdx) {
@@ -134,22 +166,65 @@ auto Record::steal_levels(const LevelStealer& stealer) -> void {
 }
 
 auto Record::visit_levels(const LevelVisitor& visitor) const -> void {
-  for (std::uint64_t levelIdx = 0; levelIdx < levels_.size(); ++levelIdx) {
-    visitor(levelIdx, levels_[levelIdx]);
+  if (store_) {
+    const std::size_t levels_count = store_->levels_count(store_index_);
+    for (std::uint64_t levelIdx = 0; levelIdx < levels_count; ++levelIdx) {
+      visitor(levelIdx, store_->level(store_index_, levelIdx));
+    }
+    return;
+  }
+
+  const auto& levels = content().levels;
+  for (std::uint64_t levelIdx = 0; levelIdx < levels.size(); ++levelIdx) {
+    visitor(levelIdx, levels[levelIdx]);
+  }
+}
+
+auto Record::visit_level_views(const LevelViewVisitor& visitor) const -> void {
+  if (store_) {
+    const std::size_t levels_count = store_->levels_count(store_index_);
+    for (std::uint64_t levelIdx = 0; levelIdx < levels_count; ++levelIdx) {
+      visitor(levelIdx, store_->level_view(store_index_, levelIdx));
+    }
+    return;
+  }
+
+  const auto& levels = content().levels;
+  for (std::uint64_t levelIdx = 0; levelIdx < levels.size(); ++levelIdx) {
+    visitor(levelIdx, LevelView{levels[levelIdx]});
   }
 }
 
+auto Record::view(std::shared_ptr<const RecordStore> store, std::size_t index)
+    -> Record {
+  assert(store);
+  assert(index < store->size());
+
+  Record record;
+  record.received_time_ = store->receive_time(index);
+  record.message_time_ = store->message_time(index);
+  record.source_row_ = store->source_row(index);
+  record.store_ = std::move(store);
+  record.store_index_ = index;
+  return record;
+}
+
+auto Record::content() const noexcept -> const Content& {
+  assert(content_);
+  return *content_;
+}
+
 Record::Builder::Builder(Record base_record) noexcept
-    : instrument_{std::move(base_record.instrument_)},
-      source_name_{std::move(base_record.source_name_)},
-      source_conn_{std::move(base_record.source_conn_)},
-      levels_{std::move(base_record.levels_)},
+    : base_content_{std::move(base_record.content_)},
+      base_store_{std::move(base_record.store_)},
+      base_store_index_{base_record.store_index_},
       message_time_{base_record.message_time_},
       received_time_{base_record.received_time_},
       source_row_{base_record.source_row_} {}
 
 auto Record::Builder::with_instrument(std::string instrument) noexcept
     -> Record::Builder& {
+  detach();
   instrument_ = std::make_optional(std::move(instrument));
   return *this;
 }
@@ -168,12 +243,14 @@ auto Record::Builder::with_message_time(
 
 auto Record::Builder::with_source_name(std::string source_name) noexcept
     -> Record::Builder& {
+  detach();
   source_name_ = std::make_optional(std::move(source_name));
   return *this;
 }
 
 auto Record::Builder::with_source_connection(std::string source_conn) noexcept
     -> Record::Builder& {
+  detach();
   source_conn_ = std::make_optional(std::move(source_conn));
   return *this;
 }
@@ -186,6 +263,7 @@ auto Record::Builder::with_source_row(std::uint64_t source_row) noexcept
 
 auto Record::Builder::add_level(std::uint64_t index, Historical::Level level)
     -> Record::Builder& {
+  detach();
   if (index >= levels_.size()) {
     levels_.resize(index + 1);
   }
@@ -205,18 +283,45 @@ auto Record::Builder::construct(Record::Builder builder) -> Record {
   assert(builder.received_time_.has_value());
   record.received_time_ = *builder.received_time_;
 
-  assert(builder.instrument_.has_value());
-  record.instrument_ = std::move(*builder.instrument_);
-
   record.message_time_ = builder.message_time_;
-  record.source_name_ = std::move(builder.source_name_);
-  record.source_conn_ = std::move(builder.source_conn_);
 
-  record.levels_ = std::move(builder.levels_);
+  // The content of the base record has not been modified.
+  if (builder.base_store_) {
+    record.store_ = std::move(builder.base_store_);
+    record.store_index_ = builder.base_store_index_;
+    return record;
+  }
+  if (builder.base_content_) {
+    record.content_ = std::move(builder.base_content_);
+    return record;
+  }
+
+  assert(builder.instrument_.has_value());
+  record.content_ = std::make_shared<Content>(
+      Content{.levels = std::move(builder.levels_),
+              .source_name = std::move(builder.source_name_),
+              .source_conn = std::move(builder.source_conn_),
+              .instrument = std::move(*builder.instrument_)});
 
   return record;
 }
 
+auto Record::Builder::detach() -> void {
+  if (base_store_) {
+    instrument_ = base_store_->instrument(base_store_index_);
+    source_name_ = base_store_->source_name(base_store_index_);
+    source_conn_ = base_store_->source_connection(base_store_index_);
+    levels_ = base_store_->levels(base_store_index_);
+    base_store_.reset();
+  } else if (base_content_) {
+    instrument_ = base_content_->instrument;
+    source_name_ = base_content_->source_name;
+    source_conn_ = base_content_->source_conn;
+    levels_ = base_content_->levels;
+    base_content_.reset();
+  }
+}
+
 auto Record::Builder::validate(const Builder& builder) -> void {
   if (!builder.source_row_.has_value()) {
     throw std::invalid_argument{
@@ -232,7 +337,8 @@ auto Record::Builder::validate(const Builder& builder) -> void {
                     row)};
   }
 
-  if (!builder.instrument_.has_value()) {
+  const bool has_base = builder.base_content_ || builder.base_store_;
+  if (!has_base && !builder.instrument_.has_value()) {
     throw std::invalid_argument{
         fmt::format("missing mandatory instrument attribute "
                     "(row: {})",
@@ -335,6 +441,10 @@ auto operator<<(std::ostream& os, const Level& level) -> std::ostream& {
   return os << fmt::to_string(level);
 }
 
+auto operator<<(std::ostream& os, const LevelView& level) -> std::ostream& {
+  return os << fmt::to_string(level);
+}
+
 auto operator<<(std::ostream& os, const Record& record) -> std::ostream& {
   return os << fmt::to_string(record);
 }
@@ -348,15 +458,26 @@ auto operator<<(std::ostream& os, const Action& action) -> std::ostream& {
 auto fmt::formatter<Simulator::Generator::Historical::Level>::format(
     const formattable& level, format_context& context) const
     -> decltype(context.out()) {
+  return fmt::format_to(
+      context.out(), "{}", Simulator::Generator::Historical::LevelView{level});
+}
+
+auto fmt::formatter<Simulator::Generator::Historical::LevelView>::format(
+    const formattable& level, format_context& context) const
+    -> decltype(context.out()) {
+  const auto counterparty = [](const std::string* party) {
+    return party != nullptr ? std::make_optional<std::string_view>(*party)
+                            : std::nullopt;
+  };
   return fmt::format_to(context.out(),
                         "{{ Bid={{ Price={} Qty={} Counterparty={} }} "
                         "Offer={{ Price={} Qty={} Counterparty={} }} }}",
-                        level.bid_price(),
-                        level.bid_quantity(),
-                        level.bid_counterparty(),
-                        level.offer_price(),
-                        level.offer_quantity(),
-                        level.offer_counterparty());
+                        level.bid_price,
+                        level.bid_quantity,
+                        counterparty(level.bid_counterparty),
+                        level.offer_price,
+                        level.offer_quantity,
+                        counterparty(level.offer_counterparty));
 }
 
 auto fmt::formatter<Simulator::Generator::Historical::Record>::format(
@@ -384,7 +505,8 @@ auto fmt::formatter<Simulator::Generator::Historical::Record>::format_levels(
   fmt::format_to(context.out(), " Levels=[");
 
   bool is_first = true;
-  record.visit_levels([&context, &is_first](auto level_idx, const auto& level) {
+  record.visit_level_views([&context, &is_first](auto level_idx,
+                                                 const auto& level) {
     fmt::format_to(context.out(),
                    "{}Level={{ Index={} Data={} }}",
                    is_first ? " " : ", ",
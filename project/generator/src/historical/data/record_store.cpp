@@ -0,0 +1,216 @@
+#include "ih/historical/data/record_store.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/data/time.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+constexpr std::uint32_t NoString = std::numeric_limits<std::uint32_t>::max();
+
+constexpr double NoValue = std::numeric_limits<double>::quiet_NaN();
+
+auto to_column_value(std::optional<double> value) noexcept -> double {
+  return value.value_or(NoValue);
+}
+
+auto from_column_value(double value) noexcept -> std::optional<double> {
+  return std::isnan(value) ? std::nullopt : std::make_optional(value);
+}
+
+}  // namespace
+
+auto RecordStore::create() -> std::shared_ptr<RecordStore> {
+  return std::shared_ptr<RecordStore>{new RecordStore};
+}
+
+auto RecordStore::add(const Record& record) -> void {
+  receive_times_.push_back(record.receive_time());
+  const auto message_time = record.message_time();
+  message_times_.push_back(message_time.value_or(Historical::Timepoint{}));
+  has_message_times_.push_back(message_time.has_value());
+  source_rows_.push_back(record.source_row());
+  instruments_.push_back(intern(record.instrument()));
+  sources_.push_back(intern_source(record));
+
+  record.visit_level_views(
+      [this](std::uint64_t, const LevelView& level) { add_level(level); });
+  if (bid_prices_.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error{"too many historical levels to be stored"};
+  }
+  levels_begin_.push_back(static_cast<std::uint32_t>(bid_prices_.size()));
+}
+
+auto RecordStore::shrink_to_fit() -> void {
+  receive_times_.shrink_to_fit();
+  message_times_.shrink_to_fit();
+  has_message_times_.shrink_to_fit();
+  source_rows_.shrink_to_fit();
+  instruments_.shrink_to_fit();
+  sources_.shrink_to_fit();
+  levels_begin_.shrink_to_fit();
+
+  bid_prices_.shrink_to_fit();
+  bid_quantities_.shrink_to_fit();
+  bid_counterparties_.shrink_to_fit();
+  offer_prices_.shrink_to_fit();
+  offer_quantities_.shrink_to_fit();
+  offer_counterparties_.shrink_to_fit();
+
+  // The interning index is only needed while the store is being filled.
+  string_ids_ = {};
+}
+
+auto RecordStore::size() const noexcept -> std::size_t {
+  return receive_times_.size();
+}
+
+auto RecordStore::empty() const noexcept -> bool { return size() == 0; }
+
+auto RecordStore::record(Index index) const -> Record {
+  assert(index < size());
+  return Record::view(shared_from_this(), index);
+}
+
+auto RecordStore::instrument(Index index) const noexcept
+    -> const std::string& {
+  return strings_[instruments_[index]];
+}
+
+auto RecordStore::receive_time(Index index) const noexcept
+    -> Historical::Timepoint {
+  return receive_times_[index];
+}
+
+auto RecordStore::message_time(Index index) const noexcept
+    -> std::optional<Historical::Timepoint> {
+  if (!has_message_times_[index]) {
+    return std::nullopt;
+  }
+  return message_times_[index];
+}
+
+auto RecordStore::source_name(Index index) const noexcept
+    -> const std::optional<std::string>& {
+  return source_table_[sources_[index]].name;
+}
+
+auto RecordStore::source_connection(Index index) const noexcept
+    -> const std::optional<std::string>& {
+  return source_table_[sources_[index]].connection;
+}
+
+auto RecordStore::source_row(Index index) const noexcept -> std::uint64_t {
+  return source_rows_[index];
+}
+
+auto RecordStore::levels_count(Index index) const noexcept -> std::size_t {
+  return levels_begin_[index + 1] - levels_begin_[index];
+}
+
+auto RecordStore::level_view(Index index, std::size_t level_idx) const noexcept
+    -> LevelView {
+  assert(level_idx < levels_count(index));
+  const std::size_t position = levels_begin_[index] + level_idx;
+  LevelView view;
+  view.bid_price = from_column_value(bid_prices_[position]);
+  view.bid_quantity = from_column_value(bid_quantities_[position]);
+  view.bid_counterparty = lookup(bid_counterparties_[position]);
+  view.offer_price = from_column_value(offer_prices_[position]);
+  view.offer_quantity = from_column_value(offer_quantities_[position]);
+  view.offer_counterparty = lookup(offer_counterparties_[position]);
+  return view;
+}
+
+auto RecordStore::level(Index index, std::size_t level_idx) const -> Level {
+  const LevelView view = level_view(index, level_idx);
+
+  Level::Builder builder;
+  if (view.bid_price.has_value()) {
+    builder.with_bid_price(*view.bid_price);
+  }
+  if (view.bid_quantity.has_value()) {
+    builder.with_bid_quantity(*view.bid_quantity);
+  }
+  if (view.bid_counterparty != nullptr) {
+    builder.with_bid_counterparty(*view.bid_counterparty);
+  }
+  if (view.offer_price.has_value()) {
+    builder.with_offer_price(*view.offer_price);
+  }
+  if (view.offer_quantity.has_value()) {
+    builder.with_offer_quantity(*view.offer_quantity);
+  }
+  if (view.offer_counterparty != nullptr) {
+    builder.with_offer_counterparty(*view.offer_counterparty);
+  }
+  return Level::Builder::construct(std::move(builder));
+}
+
+auto RecordStore::levels(Index index) const -> std::vector<Level> {
+  std::vector<Level> levels;
+  levels.reserve(levels_count(index));
+  for (std::size_t level_idx = 0; level_idx < levels_count(index);
+       ++level_idx) {
+    levels.push_back(level(index, level_idx));
+  }
+  return levels;
+}
+
+auto RecordStore::add_level(const LevelView& level) -> void {
+  bid_prices_.push_back(to_column_value(level.bid_price));
+  bid_quantities_.push_back(to_column_value(level.bid_quantity));
+  bid_counterparties_.push_back(intern(level.bid_counterparty));
+  offer_prices_.push_back(to_column_value(level.offer_price));
+  offer_quantities_.push_back(to_column_value(level.offer_quantity));
+  offer_counterparties_.push_back(intern(level.offer_counterparty));
+}
+
+auto RecordStore::intern(const std::string& value) -> StringId {
+  const auto [it, inserted] =
+      string_ids_.try_emplace(value, static_cast<StringId>(strings_.size()));
+  if (inserted) {
+    if (strings_.size() >= NoString) {
+      string_ids_.erase(it);
+      throw std::length_error{"too many historical strings to be stored"};
+    }
+    strings_.push_back(value);
+  }
+  return it->second;
+}
+
+auto RecordStore::intern(const std::string* value) -> StringId {
+  return value != nullptr ? intern(*value) : NoString;
+}
+
+auto RecordStore::intern_source(const Record& record) -> std::uint32_t {
+  // Records are usually added from a single datasource,
+  // thus the last source is checked first.
+  for (std::size_t id = source_table_.size(); id > 0; --id) {
+    const Source& source = source_table_[id - 1];
+    if (source.name == record.source_name() &&
+        source.connection == record.source_connection()) {
+      return static_cast<std::uint32_t>(id - 1);
+    }
+  }
+
+  source_table_.push_back(
+      {.name = record.source_name(), .connection = record.source_connection()});
+  return static_cast<std::uint32_t>(source_table_.size() - 1);
+}
+
+auto RecordStore::lookup(StringId id) const noexcept -> const std::string* {
+  return id == NoString ? nullptr : &strings_[id];
+}
+
+}  // namespace Simulator::Generator::Historical
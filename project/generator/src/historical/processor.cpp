@@ -1,31 +1,40 @@
 #include "ih/historical/processor.hpp"
 
+#include <fmt/chrono.h>
+
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "ih/adaptation/protocol_conversion.hpp"
+#include "ih/adaptation/request_prototypes.hpp"
 #include "ih/context/instrument_context.hpp"
 #include "ih/historical/data/record.hpp"
 #include "ih/historical/record_applier.hpp"
+#include "ih/utils/engine_pacer.hpp"
 #include "log/logging.hpp"
 #include "middleware/routing/trading_request_channel.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 
 namespace Simulator::Generator::Historical {
 namespace {
 
 auto send_message(const GeneratedMessage& message,
-                  const simulator::InstrumentDescriptor& instrument) -> void {
+                  const RequestPrototypes& prototypes) -> void {
   try {
     if (message.message_type == MessageType::NewOrderSingle) {
       simulator::middleware::send_trading_request(
-          convert_to_order_placement_request(message, instrument));
+          convert_to_order_placement_request(message, prototypes));
     } else if (message.message_type == MessageType::OrderCancelReplaceRequest) {
       simulator::middleware::send_trading_request(
-          convert_to_order_modification_request(message, instrument));
+          convert_to_order_modification_request(message, prototypes));
     } else if (message.message_type == MessageType::OrderCancelRequest) {
       simulator::middleware::send_trading_request(
-          convert_to_order_cancellation_request(message, instrument));
+          convert_to_order_cancellation_request(message, prototypes));
     }
   } catch (const simulator::middleware::ChannelUnboundError&) {
     simulator::log::err(
@@ -64,14 +73,19 @@ auto ActionProcessor::ContextsRegistry::resolveContext(
 
 ActionProcessor::ActionProcessor(
     ActionProcessor::Contexts const& _availableContexts)
-    : mCtxRegistry{_availableContexts} {}
+    : ActionProcessor{_availableContexts, EnginePacer::defaultLimits()} {}
+
+ActionProcessor::ActionProcessor(
+    ActionProcessor::Contexts const& _availableContexts,
+    EnginePacer::Limits _pacerLimits)
+    : mCtxRegistry{_availableContexts}, mPacerLimits{_pacerLimits} {}
 
 auto ActionProcessor::process(Historical::Action _action) -> void {
   _action.steal_records(
       [this](Historical::Record _record) { process(std::move(_record)); });
 }
 
-auto ActionProcessor::process(Historical::Record _record) const -> void {
+auto ActionProcessor::process(Historical::Record _record) -> void {
   ContextPointer const pContext = mCtxRegistry.resolveContext(_record);
   if (!pContext) {
     simulator::log::warn(
@@ -81,14 +95,105 @@ auto ActionProcessor::process(Historical::Record _record) const -> void {
     return;
   }
 
+  InstrumentReplay& replay = replayOf(pContext);
+  if (isEngineSaturated(pContext, replay)) {
+    // A record holds a complete book of an instrument, so the latest one
+    // supersedes records held before, which are conflated this way.
+    replay.heldRecord = std::move(_record);
+    return;
+  }
+
+  replay.heldRecord.reset();
+  apply(std::move(_record), pContext, replay);
+}
+
+auto ActionProcessor::apply(Historical::Record _record,
+                            ContextPointer const& _pContext,
+                            InstrumentReplay& _replay) -> void {
   std::vector<GeneratedMessage> const historicalMessages =
-      RecordApplier::apply(std::move(_record), pContext);
-  const simulator::InstrumentDescriptor& instrument =
-      pContext->getInstrumentDescriptor();
+      RecordApplier::apply(std::move(_record), _pContext, _replay.book);
+  const RequestPrototypes& prototypes = _pContext->getRequestPrototypes();
 
   for (auto const& historicalRequest : historicalMessages) {
-    send_message(historicalRequest, instrument);
+    send_message(historicalRequest, prototypes);
+  }
+}
+
+auto ActionProcessor::retryHeldRecords() -> void {
+  applyHeldRecords(true);
+}
+
+auto ActionProcessor::flushHeldRecords() -> void {
+  applyHeldRecords(false);
+}
+
+auto ActionProcessor::hasHeldRecords() const noexcept -> bool {
+  return std::any_of(
+      std::begin(mReplays), std::end(mReplays), [](auto const& _replay) {
+        return _replay.second.heldRecord.has_value();
+      });
+}
+
+auto ActionProcessor::applyHeldRecords(bool _whenAdmitted) -> void {
+  for (auto& [_, replay] : mReplays) {
+    if (!replay.heldRecord.has_value()) {
+      continue;
+    }
+
+    ContextPointer const pContext =
+        mCtxRegistry.resolveContext(*replay.heldRecord);
+    if (!pContext) {
+      replay.heldRecord.reset();
+      continue;
+    }
+    if (_whenAdmitted && isEngineSaturated(pContext, replay)) {
+      continue;
+    }
+
+    Historical::Record record = std::move(*replay.heldRecord);
+    replay.heldRecord.reset();
+    apply(std::move(record), pContext, replay);
+  }
+}
+
+auto ActionProcessor::replayOf(ContextPointer const& _pContext)
+    -> InstrumentReplay& {
+  const auto found = mReplays.find(_pContext.get());
+  if (found != std::end(mReplays)) {
+    return found->second;
   }
+
+  InstrumentReplay replay{.enginePacer = EnginePacer{mPacerLimits}};
+  return mReplays.emplace(_pContext.get(), std::move(replay)).first->second;
+}
+
+auto ActionProcessor::isEngineSaturated(ContextPointer const& _pContext,
+                                        InstrumentReplay& _replay) -> bool {
+  if (!_replay.handleRequested) {
+    _replay.handleRequested = true;
+    _replay.handle =
+        resolve_instrument_handle(_pContext->getRequestPrototypes());
+  }
+
+  // The load of an instrument, which is not resolved, can not be queried.
+  if (!_replay.handle.has_value()) {
+    return false;
+  }
+
+  auto& pacer = _replay.enginePacer;
+  if (pacer.admit(*_replay.handle, EnginePacer::Clock::now())) {
+    return false;
+  }
+
+  const auto& load = pacer.lastLoad();
+  simulator::log::debug(
+      "trading engine of `{}' instrument is saturated with {} pending "
+      "commands, the oldest one waits for {}, historical records are "
+      "conflated until the engine keeps up",
+      _pContext->getInstrument().getSymbol(),
+      load->queue_depth,
+      load->oldest_request_age);
+  return true;
 }
 
 }  // namespace Simulator::Generator::Historical
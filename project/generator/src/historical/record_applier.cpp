@@ -5,6 +5,7 @@
 #include <exception>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -22,6 +23,14 @@ namespace Simulator::Generator::Historical {
 auto RecordApplier::apply(Historical::Record record,
                           RecordApplier::ContextPointer context) noexcept
     -> std::vector<GeneratedMessage> {
+  Book book;
+  return apply(std::move(record), std::move(context), book);
+}
+
+auto RecordApplier::apply(Historical::Record record,
+                          RecordApplier::ContextPointer context,
+                          Book& book) noexcept
+    -> std::vector<GeneratedMessage> {
   bool failed = false;
   std::vector<GeneratedMessage> replies;
 
@@ -29,27 +38,32 @@ auto RecordApplier::apply(Historical::Record record,
   const std::optional<std::string> source_name = record.source_name();
   const std::optional<std::string> source_conn = record.source_connection();
 
-  RecordApplier applier{std::move(context)};
-
   try {
-    applier.process(std::move(record));
+    context->takeRegistry().transact([&](GeneratedOrdersRegistry& registry) {
+      RecordApplier applier{context, registry, book};
+      applier.process(std::move(record));
+      replies = std::move(applier.request_messages_);
+      // The transaction is published with the revision following
+      // the one it has been started with.
+      book.registry_revision = registry.revision() + 1;
+    });
   } catch (const std::exception& ex) {
     simulator::log::err(
         "an error occurred while processing a historical record "
         "from row {} from the `{}' datasource (connection: `{}'): {}. "
         "Discarding all generated historical messages, "
-        "internal generated orders registry may be corrupted",
+        "the record is not applied to the generated orders registry",
         row_number,
         source_name.value_or("unknown"),
         source_conn.value_or("unknown"),
         ex.what());
-
     failed = true;
   }
 
-  if (!failed) {
-    replies = std::move(applier.request_messages_);
-
+  if (failed) {
+    book = Book{};
+    replies.clear();
+  } else {
     const std::size_t num_messages = replies.size();
     simulator::log::debug(
         "{} messages generated based on historical record from row {} of "
@@ -62,37 +76,56 @@ auto RecordApplier::apply(Historical::Record record,
   return replies;
 }
 
-RecordApplier::RecordApplier(RecordApplier::ContextPointer context) noexcept
-    : context_{std::move(context)} {}
+RecordApplier::RecordApplier(RecordApplier::ContextPointer context,
+                             GeneratedOrdersRegistry& registry,
+                             Book& book) noexcept
+    : context_{std::move(context)}, registry_{registry}, book_{book} {}
 
 void RecordApplier::process(Historical::Record record) {
-  if (record.has_levels()) {
-    cancel_other_parties(record);
+  book_trusted_ = book_.registry_revision.has_value() &&
+                  *book_.registry_revision == registry_.revision();
+  book_.registry_revision.reset();
+  if (!book_trusted_) {
+    book_.orders.clear();
+  }
 
+  if (record.has_levels()) {
     const std::optional<std::string>& source_name = record.source_name();
     const std::uint64_t source_row = record.source_row();
     std::size_t levels_applied = 0;
 
-    record.steal_levels([this, &levels_applied, &source_name, source_row](
-                            std::uint64_t level_idx, Historical::Level level) {
-      if (process(level, level_idx)) {
-        ++levels_applied;
-      } else {
-        simulator::log::warn(
-            "level at index {} has been skipped in a record from "
-            "`{}' datasource at row {}: {}",
-            level_idx,
-            source_name.value_or("undefined"),
-            source_row,
-            level);
-      }
-    });
+    std::vector<Order> orders;
+    record.visit_level_views(
+        [this, &orders, &levels_applied, &source_name, source_row](
+            std::uint64_t level_idx, const Historical::LevelView& level) {
+          if (collect(level, level_idx, orders)) {
+            ++levels_applied;
+          } else {
+            simulator::log::warn(
+                "level at index {} has been skipped in a record from "
+                "`{}' datasource at row {}: {}",
+                level_idx,
+                source_name.value_or("undefined"),
+                source_row,
+                level);
+          }
+        });
+
+    cancel_other_parties(orders);
+    for (Order& order : orders) {
+      place(std::move(order));
+    }
 
     simulator::log::debug(
         "{} level applied from historical {}", levels_applied, record);
   } else {
-    cancel_bid_part();
-    cancel_offer_part();
+    if (book_trusted_) {
+      cancel_other_parties({});
+    } else {
+      cancel_bid_part();
+      cancel_offer_part();
+    }
+    book_.orders.clear();
 
     simulator::log::debug(
         "created cancel messages for all bid and offer generated orders, "
@@ -101,20 +134,22 @@ void RecordApplier::process(Historical::Record record) {
   }
 }
 
-auto RecordApplier::process(const Historical::Level& level,
-                            std::uint64_t level_idx) -> bool {
+auto RecordApplier::collect(const Historical::LevelView& level,
+                            std::uint64_t level_idx,
+                            std::vector<RecordApplier::Order>& orders)
+    -> bool {
   if (!RecordChecker::is_processable(level)) {
     return false;
   }
 
-  if (!place_bid(level)) {
+  if (!collect_bid(level, orders)) {
     simulator::log::warn(
         "no bid data was found at the historical level at "
         "index {}; the bid part of the level has been ignored",
         level_idx);
   }
 
-  if (!place_offer(level)) {
+  if (!collect_offer(level, orders)) {
     simulator::log::warn(
         "no offer data was found at the historical level at "
         "index {}; the offer part of the level has been ignored",
@@ -124,91 +159,122 @@ auto RecordApplier::process(const Historical::Level& level,
   return true;
 }
 
-auto RecordApplier::place_bid(const Historical::Level& level) -> bool {
+auto RecordApplier::collect_bid(const Historical::LevelView& level,
+                                std::vector<RecordApplier::Order>& orders)
+    -> bool {
   if (!RecordChecker::has_bid_part(level)) {
     return false;
   }
 
   constexpr auto target_side = simulator::Side::Option::Buy;
 
-  assert(level.bid_price().has_value());
-  const double price = level.bid_price().value();
+  assert(level.bid_price.has_value());
+  const double price = level.bid_price.value();
 
-  assert(level.bid_quantity().has_value());
-  const double quantity = level.bid_quantity().value();
+  assert(level.bid_quantity.has_value());
+  const double quantity = level.bid_quantity.value();
 
-  std::string party = level.bid_counterparty().has_value()
-                          ? level.bid_counterparty().value()
+  std::string party = level.bid_counterparty != nullptr
+                          ? *level.bid_counterparty
                           : next_party_id();
 
-  place(Order{price, target_side, quantity, std::move(party)});
+  orders.emplace_back(price, target_side, quantity, std::move(party));
   return true;
 }
 
-auto RecordApplier::place_offer(const Historical::Level& level) -> bool {
+auto RecordApplier::collect_offer(const Historical::LevelView& level,
+                                  std::vector<RecordApplier::Order>& orders)
+    -> bool {
   if (!RecordChecker::has_offer_part(level)) {
     return false;
   }
 
   constexpr auto target_side = simulator::Side::Option::Sell;
 
-  assert(level.offer_price().has_value());
-  const double price = level.offer_price().value();
+  assert(level.offer_price.has_value());
+  const double price = level.offer_price.value();
 
-  assert(level.offer_quantity().has_value());
-  const double quantity = level.offer_quantity().value();
+  assert(level.offer_quantity.has_value());
+  const double quantity = level.offer_quantity.value();
 
-  std::string party = level.offer_counterparty().has_value()
-                          ? level.offer_counterparty().value()
+  std::string party = level.offer_counterparty != nullptr
+                          ? *level.offer_counterparty
                           : next_party_id();
 
-  place(Order{price, target_side, quantity, std::move(party)});
+  orders.emplace_back(price, target_side, quantity, std::move(party));
   return true;
 }
 
 auto RecordApplier::place(RecordApplier::Order order) -> void {
-  auto& context = *context_;
-  auto& registry = context.takeRegistry();
+  // The registry is looked up only for levels changed since
+  // the previous record, while the book is trusted.
+  if (book_trusted_ && is_booked(order)) {
+    return;
+  }
 
   const std::optional<GeneratedOrderData> existing_order =
-      registry.findByOwner(order.counterparty_id);
-
-  RequestBuilder message_builder;
-  message_builder.withRestingAttributes()
-      .withPrice(simulator::OrderPrice{order.price})
-      .withQuantity(simulator::Quantity{order.quantity})
-      .withSide(order.side)
-      .withCounterparty(simulator::PartyId{std::move(order.counterparty_id)});
-
-  if (existing_order.has_value() &&
-      existing_order->getOrderSide() == order.side) {
-    message_builder.makeModificationRequest()
-        .withClOrdID(existing_order->getOrderID())
-        .withOrigClOrdID(existing_order->getOrigOrderID());
-  } else {
-    if (existing_order.has_value()) {
-      const auto& target_ord_id = existing_order->getOrderID();
-      cancel([&target_ord_id](const GeneratedOrderData& _placedOrder) {
-        return _placedOrder.getOrderID() == target_ord_id;
-      });
+      registry_.findByOwner(order.counterparty_id);
+  if (!is_unchanged(order, existing_order)) {
+    RequestBuilder message_builder;
+    message_builder.withRestingAttributes()
+        .withPrice(simulator::OrderPrice{order.price})
+        .withQuantity(simulator::Quantity{order.quantity})
+        .withSide(order.side)
+        .withCounterparty(simulator::PartyId{order.counterparty_id});
+
+    if (existing_order.has_value() &&
+        existing_order->getOrderSide() == order.side) {
+      message_builder.makeModificationRequest()
+          .withClOrdID(existing_order->getOrderID())
+          .withOrigClOrdID(existing_order->getOrigOrderID());
+    } else {
+      if (existing_order.has_value()) {
+        cancel(std::vector<GeneratedOrderData>{*existing_order});
+      }
+
+      message_builder.makeNewOrderRequest().withClOrdID(
+          simulator::ClientOrderId{context_->getSyntheticIdentifier()});
     }
 
-    message_builder.makeNewOrderRequest().withClOrdID(
-        simulator::ClientOrderId{context.getSyntheticIdentifier()});
+    auto order_message = RequestBuilder::construct(std::move(message_builder));
+    OrderRegistryUpdater::update(registry_, order_message);
+    request_messages_.emplace_back(std::move(order_message));
   }
 
-  auto order_message = RequestBuilder::construct(std::move(message_builder));
-  OrderRegistryUpdater::update(registry, order_message);
-  request_messages_.emplace_back(std::move(order_message));
+  std::string party = order.counterparty_id;
+  book_.orders.insert_or_assign(std::move(party), std::move(order));
+}
+
+auto RecordApplier::is_booked(const RecordApplier::Order& order) const
+    -> bool {
+  const auto booked = book_.orders.find(order.counterparty_id);
+  return booked != std::end(book_.orders) &&
+         booked->second.side == order.side &&
+         booked->second.price == order.price &&
+         booked->second.quantity == order.quantity;
+}
+
+// A level is unchanged when the party's order resting in the registry
+// already has its side, price and quantity. A partially filled order has
+// a lower quantity in the registry, so it is topped back up to the level.
+auto RecordApplier::is_unchanged(
+    const RecordApplier::Order& order,
+    const std::optional<GeneratedOrderData>& resting_order) noexcept -> bool {
+  // Prices and quantities are compared exactly, as both are parsed
+  // from historical data the same way, and any difference must be applied.
+  return resting_order.has_value() &&
+         resting_order->getOrderSide() == order.side &&
+         resting_order->getOrderPx() == simulator::OrderPrice{order.price} &&
+         resting_order->getOrderQty() == simulator::Quantity{order.quantity};
 }
 
 auto RecordApplier::cancel(
     const GeneratedOrdersRegistry::Predicate& cancel_criteria) -> void {
-  GeneratedOrdersRegistry& registry = context_->takeRegistry();
-
-  const std::vector<GeneratedOrderData> orders =
-      registry.selectBy(cancel_criteria);
+  cancel(registry_.selectBy(cancel_criteria));
+}
 
+auto RecordApplier::cancel(const std::vector<GeneratedOrderData>& orders)
+    -> void {
   if (orders.empty()) {
     return;
   }
@@ -230,7 +296,7 @@ auto RecordApplier::cancel(
   }
 
   for (const GeneratedMessage& cancel_request : cancel_requests) {
-    OrderRegistryUpdater::update(registry, cancel_request);
+    OrderRegistryUpdater::update(registry_, cancel_request);
   }
 
   std::copy(std::make_move_iterator(std::begin(cancel_requests)),
@@ -256,21 +322,37 @@ auto RecordApplier::cancel_offer_part() -> void {
   cancel(all_offer_order);
 }
 
-auto RecordApplier::cancel_other_parties(const Historical::Record& record)
-    -> void {
-  std::unordered_set<std::string> parties;
-  record.visit_levels([&parties](std::uint64_t, const Level& level) {
-    if (const auto party = level.bid_counterparty()) {
-      parties.insert(*party);
-    }
-    if (const auto party = level.offer_counterparty()) {
-      parties.insert(*party);
+auto RecordApplier::cancel_other_parties(
+    const std::vector<RecordApplier::Order>& orders) -> void {
+  // Viewed parties are owned by the orders, which outlive the set.
+  std::unordered_set<std::string_view> parties;
+  for (const Order& order : orders) {
+    parties.insert(order.counterparty_id);
+  }
+
+  if (!book_trusted_) {
+    cancel([&parties = std::as_const(parties)](const GeneratedOrderData& order) {
+      return !parties.contains(order.getOwnerID().value());
+    });
+    return;
+  }
+
+  // Only parties of the previous record have orders in the registry,
+  // while the book is trusted.
+  std::vector<GeneratedOrderData> left_orders;
+  for (auto booked = std::begin(book_.orders);
+       booked != std::end(book_.orders);) {
+    if (parties.contains(booked->first)) {
+      ++booked;
+      continue;
     }
-  });
 
-  cancel([&parties = std::as_const(parties)](const GeneratedOrderData& order) {
-    return !parties.contains(order.getOwnerID().value());
-  });
+    if (auto resting_order = registry_.findByOwner(booked->first)) {
+      left_orders.emplace_back(std::move(*resting_order));
+    }
+    booked = book_.orders.erase(booked);
+  }
+  cancel(left_orders);
 }
 
 auto RecordApplier::next_party_id() -> std::string {
@@ -288,12 +370,12 @@ RecordApplier::Order::Order(double _price,
       side{_side} {}
 
 auto RecordApplier::RecordChecker::is_processable(
-    const Historical::Level& level) noexcept -> bool {
-  const bool has_bid_px = level.bid_price().has_value();
-  const bool has_bid_qty = level.bid_quantity().has_value();
+    const Historical::LevelView& level) noexcept -> bool {
+  const bool has_bid_px = level.bid_price.has_value();
+  const bool has_bid_qty = level.bid_quantity.has_value();
 
-  const bool has_offer_px = level.offer_price().has_value();
-  const bool has_offer_qty = level.offer_quantity().has_value();
+  const bool has_offer_px = level.offer_price.has_value();
+  const bool has_offer_qty = level.offer_quantity.has_value();
 
   const bool is_bid_valid = !static_cast<bool>(has_bid_px ^ has_bid_qty);
   const bool is_offer_valid = !static_cast<bool>(has_offer_px ^ has_offer_qty);
@@ -302,26 +384,26 @@ auto RecordApplier::RecordChecker::is_processable(
 }
 
 auto RecordApplier::RecordChecker::has_bid_part(
-    const Historical::Level& level) noexcept -> bool {
+    const Historical::LevelView& level) noexcept -> bool {
   if (!is_processable(level)) {
     return false;
   }
 
-  const bool has_price = level.bid_price().has_value();
-  const bool has_qty = level.bid_quantity().has_value();
+  const bool has_price = level.bid_price.has_value();
+  const bool has_qty = level.bid_quantity.has_value();
 
   assert(!(has_price ^ has_qty));
   return has_price && has_qty;
 }
 
 auto RecordApplier::RecordChecker::has_offer_part(
-    const Historical::Level& level) noexcept -> bool {
+    const Historical::LevelView& level) noexcept -> bool {
   if (!is_processable(level)) {
     return false;
   }
 
-  const bool has_price = level.offer_price().has_value();
-  const bool has_qty = level.offer_quantity().has_value();
+  const bool has_price = level.offer_price.has_value();
+  const bool has_qty = level.offer_quantity.has_value();
 
   assert(!(has_price ^ has_qty));
   return has_price && has_qty;
@@ -0,0 +1,95 @@
+#include "ih/historical/replay/replay_clock.hpp"
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+
+#include "core/tools/time.hpp"
+#include "ih/historical/data/time.hpp"
+
+namespace Simulator::Generator::Historical {
+
+ReplayClock::ReplayClock(double _speed) :
+    mSpeed{_speed},
+    mWallAnchor{WallClock::now()},
+    mReplayAnchor{mWallAnchor}
+{
+    if (!std::isfinite(_speed) || _speed < 0.) {
+        throw std::invalid_argument{fmt::format(
+            "historical replay speed must be a non-negative number, {} given",
+            _speed)};
+    }
+}
+
+ReplayClock::ReplayClock() :
+    ReplayClock(1.)
+{}
+
+auto ReplayClock::system_time() const noexcept -> simulator::core::sys_us
+{
+    return simulator::core::to_time(now());
+}
+
+auto ReplayClock::speed() const noexcept -> double
+{
+    return mSpeed;
+}
+
+auto ReplayClock::isMaxSpeed() const noexcept -> bool
+{
+    return mSpeed == MaxSpeed;
+}
+
+auto ReplayClock::now() const noexcept -> Historical::Timepoint
+{
+    std::lock_guard const lock{mAnchorsLock};
+    return mReplayAnchor + elapsedReplayTime(mWallAnchor);
+}
+
+auto ReplayClock::timeUntil(Historical::Timepoint _replayTime) const noexcept
+    -> std::chrono::microseconds
+{
+    using std::chrono::microseconds;
+
+    constexpr microseconds immediately{0};
+
+    auto const replayNow = now();
+    if (isMaxSpeed() || _replayTime <= replayNow) {
+        return immediately;
+    }
+
+    auto const replayWait =
+        std::chrono::duration<double, std::micro>{_replayTime - replayNow};
+    return std::chrono::ceil<microseconds>(replayWait / mSpeed);
+}
+
+auto ReplayClock::advanceTo(Historical::Timepoint _replayTime) noexcept -> void
+{
+    std::lock_guard const lock{mAnchorsLock};
+    if (_replayTime <= mReplayAnchor + elapsedReplayTime(mWallAnchor)) {
+        return;
+    }
+
+    mWallAnchor = WallClock::now();
+    mReplayAnchor = _replayTime;
+}
+
+auto ReplayClock::elapsedReplayTime(
+    WallClock::time_point _wallAnchor) const noexcept -> WallClock::duration
+{
+    if (isMaxSpeed()) {
+        return WallClock::duration::zero();
+    }
+
+    auto const elapsed = WallClock::now() - _wallAnchor;
+    if (mSpeed == 1.) {
+        return elapsed;
+    }
+    return std::chrono::duration_cast<WallClock::duration>(
+        std::chrono::duration<double, WallClock::period>{elapsed} * mSpeed);
+}
+
+} // namespace Simulator::Generator::Historical
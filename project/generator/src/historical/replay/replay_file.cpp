@@ -0,0 +1,460 @@
+#include "ih/historical/replay/replay_file.hpp"
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ih/historical/adapters/data_access_adapter.hpp"
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/data/record_store.hpp"
+#include "ih/historical/data/time.hpp"
+#include "log/logging.hpp"
+
+namespace Simulator::Generator::Historical::ReplayFile {
+namespace {
+
+constexpr std::size_t SectionAlignment = 8;
+
+constexpr auto align(std::size_t offset) noexcept -> std::size_t {
+  return (offset + SectionAlignment - 1) / SectionAlignment * SectionAlignment;
+}
+
+auto to_nanoseconds(Historical::Timepoint time) noexcept -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+auto to_column_value(std::optional<double> value) noexcept -> double {
+  return value.value_or(std::numeric_limits<double>::quiet_NaN());
+}
+
+auto make_system_error(int error,
+                       const std::string& action,
+                       const std::string& path) -> std::system_error {
+  return std::system_error{error,
+                           std::generic_category(),
+                           fmt::format("unable to {} `{}'", action, path)};
+}
+
+class StringTable {
+ public:
+  auto intern(const std::string& value) -> std::uint32_t {
+    const auto [it, inserted] = ids_.try_emplace(
+        value, static_cast<std::uint32_t>(offsets_.size() - 1));
+    if (inserted) {
+      if (offsets_.size() > NoString) {
+        ids_.erase(it);
+        throw std::length_error{"too many strings in a replay file"};
+      }
+      data_.insert(data_.end(), value.begin(), value.end());
+      offsets_.push_back(data_.size());
+    }
+    return it->second;
+  }
+
+  auto intern(const std::optional<std::string>& value) -> std::uint32_t {
+    return value.has_value() ? intern(*value) : NoString;
+  }
+
+  auto intern(const std::string* value) -> std::uint32_t {
+    return value != nullptr ? intern(*value) : NoString;
+  }
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t {
+    return offsets_.size() - 1;
+  }
+
+  [[nodiscard]]
+  auto offsets() const noexcept -> const std::vector<std::uint64_t>& {
+    return offsets_;
+  }
+
+  [[nodiscard]]
+  auto data() const noexcept -> const std::vector<char>& {
+    return data_;
+  }
+
+ private:
+  std::unordered_map<std::string, std::uint32_t> ids_;
+  std::vector<std::uint64_t> offsets_{0};
+  std::vector<char> data_;
+};
+
+// Column sections, which are written record by record (or level by level).
+// Levels begin column holds the end of levels of each record, the leading
+// zero is written when the column is joined.
+enum class Column : std::uint8_t {
+  ReceiveTimes,
+  MessageTimes,
+  SourceRows,
+  Instruments,
+  Sources,
+  LevelsEnd,
+  BidPrices,
+  BidQuantities,
+  OfferPrices,
+  OfferQuantities,
+  BidCounterparties,
+  OfferCounterparties
+};
+
+constexpr std::size_t ColumnsCount{12};
+
+auto column_offset(const Layout& layout, Column column) noexcept
+    -> std::size_t {
+  switch (column) {
+    case Column::ReceiveTimes:
+      return layout.receive_times;
+    case Column::MessageTimes:
+      return layout.message_times;
+    case Column::SourceRows:
+      return layout.source_rows;
+    case Column::Instruments:
+      return layout.instruments;
+    case Column::Sources:
+      return layout.sources;
+    case Column::LevelsEnd:
+      return layout.levels_begin + sizeof(std::uint64_t);
+    case Column::BidPrices:
+      return layout.bid_prices;
+    case Column::BidQuantities:
+      return layout.bid_quantities;
+    case Column::OfferPrices:
+      return layout.offer_prices;
+    case Column::OfferQuantities:
+      return layout.offer_quantities;
+    case Column::BidCounterparties:
+      return layout.bid_counterparties;
+    case Column::OfferCounterparties:
+      return layout.offer_counterparties;
+  }
+  return layout.file_size;
+}
+
+// Keeps values of a column in a temporary file until the column is joined
+// into the replay file, the temporary file is removed on destruction.
+class ColumnFile {
+ public:
+  explicit ColumnFile(std::string path)
+      : path_{std::move(path)},
+        stream_{path_, std::ios::binary | std::ios::trunc} {
+    if (!stream_) {
+      throw std::runtime_error{
+          fmt::format("unable to open `{}' for writing", path_)};
+    }
+  }
+
+  ColumnFile(const ColumnFile&) = delete;
+  auto operator=(const ColumnFile&) -> ColumnFile& = delete;
+
+  ColumnFile(ColumnFile&&) = delete;
+  auto operator=(ColumnFile&&) -> ColumnFile& = delete;
+
+  ~ColumnFile() {
+    stream_.close();
+    std::error_code error;
+    std::filesystem::remove(path_, error);
+  }
+
+  template <typename T>
+  auto put(const T& value) -> void {
+    // NOLINTNEXTLINE(*reinterpret-cast*)
+    stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    size_ += sizeof(T);
+  }
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t {
+    return size_;
+  }
+
+  auto copy_to(std::ofstream& destination) -> void {
+    stream_.close();
+    if (!stream_) {
+      throw std::runtime_error{
+          fmt::format("failed to write replay file column `{}'", path_)};
+    }
+    if (size_ == 0) {
+      return;
+    }
+
+    std::ifstream source{path_, std::ios::binary};
+    destination << source.rdbuf();
+    if (!source || !destination) {
+      throw std::runtime_error{
+          fmt::format("failed to join replay file column `{}'", path_)};
+    }
+  }
+
+ private:
+  std::string path_;
+  std::ofstream stream_;
+  std::size_t size_{0};
+};
+
+// Writes records into a replay file. Column values are spilled into column
+// files as records are added, only the string and source tables are kept
+// in memory.
+class ReplayFileWriter {
+ public:
+  explicit ReplayFileWriter(const std::string& temporary_path) {
+    for (std::size_t column = 0; column < ColumnsCount; ++column) {
+      columns_[column] = std::make_unique<ColumnFile>(
+          fmt::format("{}.{}", temporary_path, column));
+    }
+  }
+
+  auto add(const Record& record) -> void {
+    column(Column::ReceiveTimes).put(to_nanoseconds(record.receive_time()));
+    const auto message_time = record.message_time();
+    column(Column::MessageTimes)
+        .put(message_time.has_value() ? to_nanoseconds(*message_time)
+                                      : NoTime);
+    column(Column::SourceRows).put(record.source_row());
+    column(Column::Instruments).put(strings_.intern(record.instrument()));
+    column(Column::Sources).put(intern_source(record));
+
+    record.visit_level_views([this](std::uint64_t, const LevelView& level) {
+      column(Column::BidPrices).put(to_column_value(level.bid_price));
+      column(Column::BidQuantities).put(to_column_value(level.bid_quantity));
+      column(Column::OfferPrices).put(to_column_value(level.offer_price));
+      column(Column::OfferQuantities)
+          .put(to_column_value(level.offer_quantity));
+      column(Column::BidCounterparties)
+          .put(strings_.intern(level.bid_counterparty));
+      column(Column::OfferCounterparties)
+          .put(strings_.intern(level.offer_counterparty));
+      ++levels_count_;
+    });
+    column(Column::LevelsEnd).put(levels_count_);
+    ++records_count_;
+  }
+
+  [[nodiscard]]
+  auto records_count() const noexcept -> std::size_t {
+    return records_count_;
+  }
+
+  // Joins the header, the columns and the tables into the stream.
+  auto write(std::ofstream& stream) -> void {
+    const Header header{.magic = Magic,
+                        .version = Version,
+                        .flags = 0,
+                        .records_count = records_count_,
+                        .levels_count = levels_count_,
+                        .sources_count = source_table_.size(),
+                        .strings_count = strings_.size(),
+                        .strings_size = strings_.data().size()};
+    const Layout layout = make_layout(header);
+
+    std::size_t written = 0;
+    const auto pad_to = [&](std::size_t offset) {
+      for (; written < offset; ++written) {
+        stream.put('\0');
+      }
+    };
+    const auto write_data = [&](const auto* data, std::size_t count) {
+      const auto bytes = count * sizeof(*data);
+      // NOLINTNEXTLINE(*reinterpret-cast*)
+      stream.write(reinterpret_cast<const char*>(data),
+                   static_cast<std::streamsize>(bytes));
+      written += bytes;
+    };
+
+    write_data(&header, 1);
+    for (std::size_t index = 0; index < ColumnsCount; ++index) {
+      const auto column = static_cast<Column>(index);
+      if (column == Column::LevelsEnd) {
+        pad_to(layout.levels_begin);
+        const std::uint64_t levels_begin = 0;
+        write_data(&levels_begin, 1);
+      }
+      pad_to(column_offset(layout, column));
+      columns_[index]->copy_to(stream);
+      written += columns_[index]->size();
+    }
+
+    pad_to(layout.source_table);
+    write_data(source_table_.data(), source_table_.size());
+    pad_to(layout.string_offsets);
+    write_data(strings_.offsets().data(), strings_.offsets().size());
+    pad_to(layout.string_data);
+    write_data(strings_.data().data(), strings_.data().size());
+    pad_to(layout.file_size);
+  }
+
+ private:
+  auto column(Column column) -> ColumnFile& {
+    return *columns_[static_cast<std::size_t>(column)];
+  }
+
+  auto intern_source(const Record& record) -> std::uint32_t {
+    const SourceEntry source{
+        .name = strings_.intern(record.source_name()),
+        .connection = strings_.intern(record.source_connection())};
+
+    // Records are usually compiled from a single datasource,
+    // thus the last source is checked first.
+    for (std::size_t id = source_table_.size(); id > 0; --id) {
+      const SourceEntry& entry = source_table_[id - 1];
+      if (entry.name == source.name && entry.connection == source.connection) {
+        return static_cast<std::uint32_t>(id - 1);
+      }
+    }
+
+    source_table_.push_back(source);
+    return static_cast<std::uint32_t>(source_table_.size() - 1);
+  }
+
+  std::array<std::unique_ptr<ColumnFile>, ColumnsCount> columns_;
+  std::vector<SourceEntry> source_table_;
+  StringTable strings_;
+
+  std::uint64_t records_count_{0};
+  std::uint64_t levels_count_{0};
+};
+
+// Flushes the file to the storage device, so that it is not renamed
+// over the previous replay file before its content is durable.
+auto sync(const std::string& path, int flags) -> void {
+  const int descriptor = ::open(path.c_str(), flags | O_CLOEXEC);
+  if (descriptor < 0) {
+    throw make_system_error(errno, "open", path);
+  }
+  const int result = ::fsync(descriptor);
+  const int sync_error = errno;
+  ::close(descriptor);
+  if (result != 0) {
+    throw make_system_error(sync_error, "synchronize", path);
+  }
+}
+
+// Writes records added by the filler into a replay file. A replay file may be
+// read by a running replay, thus the file is written aside and is renamed
+// when it is complete.
+template <typename Filler>
+auto write_file(const std::string& path, Filler fill) -> void {
+  const std::string temporary_path = path + ".tmp";
+  {
+    ReplayFileWriter writer{temporary_path};
+    fill(writer);
+
+    std::ofstream stream{temporary_path, std::ios::binary | std::ios::trunc};
+    if (!stream) {
+      throw std::runtime_error{
+          fmt::format("unable to open `{}' for writing", temporary_path)};
+    }
+
+    writer.write(stream);
+
+    stream.close();
+    if (!stream) {
+      throw std::runtime_error{
+          fmt::format("failed to write replay file `{}'", temporary_path)};
+    }
+  }
+
+  sync(temporary_path, O_RDONLY);
+  std::filesystem::rename(temporary_path, path);
+
+  // The rename is durable only when the directory entry is synchronized.
+  const std::filesystem::path directory =
+      std::filesystem::absolute(path).parent_path();
+  sync(directory.string(), O_RDONLY | O_DIRECTORY);
+}
+
+}  // namespace
+
+auto make_layout(const Header& header) noexcept -> Layout {
+  const std::size_t records = header.records_count;
+  const std::size_t levels = header.levels_count;
+
+  Layout layout{};
+  std::size_t offset = sizeof(Header);
+  const auto next = [&offset](std::size_t size) {
+    const std::size_t section = align(offset);
+    offset = section + size;
+    return section;
+  };
+
+  layout.receive_times = next(records * sizeof(std::int64_t));
+  layout.message_times = next(records * sizeof(std::int64_t));
+  layout.source_rows = next(records * sizeof(std::uint64_t));
+  layout.instruments = next(records * sizeof(std::uint32_t));
+  layout.sources = next(records * sizeof(std::uint32_t));
+  layout.levels_begin = next((records + 1) * sizeof(std::uint64_t));
+
+  layout.bid_prices = next(levels * sizeof(double));
+  layout.bid_quantities = next(levels * sizeof(double));
+  layout.offer_prices = next(levels * sizeof(double));
+  layout.offer_quantities = next(levels * sizeof(double));
+  layout.bid_counterparties = next(levels * sizeof(std::uint32_t));
+  layout.offer_counterparties = next(levels * sizeof(std::uint32_t));
+
+  layout.source_table = next(header.sources_count * sizeof(SourceEntry));
+  layout.string_offsets =
+      next((header.strings_count + 1) * sizeof(std::uint64_t));
+  layout.string_data = next(header.strings_size);
+
+  layout.file_size = offset;
+  return layout;
+}
+
+auto is_replay_file(const std::string& path) noexcept -> bool {
+  std::ifstream stream{path, std::ios::binary};
+  std::array<char, Magic.size()> magic{};
+  stream.read(magic.data(), magic.size());
+  return stream.good() && magic == Magic;
+}
+
+auto write(const RecordStore& store, const std::string& path) -> void {
+  write_file(path, [&store](ReplayFileWriter& writer) {
+    for (RecordStore::Index record = 0; record < store.size(); ++record) {
+      writer.add(store.record(record));
+    }
+  });
+}
+
+auto compile(DataAccessAdapter& adapter, const std::string& path)
+    -> std::size_t {
+  std::size_t records = 0;
+  write_file(path, [&](ReplayFileWriter& writer) {
+    try {
+      while (std::optional<Record> record = adapter.parseNext()) {
+        writer.add(*record);
+      }
+    } catch (const std::exception& exception) {
+      throw std::runtime_error{
+          fmt::format("failed to compile historical record #{}: {}",
+                      writer.records_count() + 1,
+                      exception.what())};
+    }
+    records = writer.records_count();
+  });
+
+  simulator::log::info(
+      "compiled {} historical records into `{}' replay file", records, path);
+  return records;
+}
+
+}  // namespace Simulator::Generator::Historical::ReplayFile
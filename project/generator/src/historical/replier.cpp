@@ -1,14 +1,19 @@
 #include "ih/historical/replier.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
+#include "core/tools/time.hpp"
+#include "ih/constants.hpp"
 #include "ih/historical/data/provider.hpp"
 #include "ih/historical/data/record.hpp"
 #include "ih/historical/processor.hpp"
+#include "ih/historical/replay/replay_clock.hpp"
 #include "ih/historical/scheduler.hpp"
 #include "log/logging.hpp"
 
@@ -16,7 +21,9 @@ namespace Simulator::Generator::Historical {
 
 Replier::Replier(
     Datasources const& _datasources,
-    InstrumentsContexts const& _instrumentsContexts)
+    InstrumentsContexts const& _instrumentsContexts,
+    double _replaySpeed) :
+    m_pClock{std::make_shared<ReplayClock>(_replaySpeed)}
 {
     if (_instrumentsContexts.empty()) {
         throw std::invalid_argument{
@@ -28,24 +35,62 @@ Replier::Replier(
         _instrumentsContexts
     );
 
-    // We'll redesign the approach of datasources initialization when
-    // a reading from multiple datasources will be required.
-    // It may require parallel initialization of data_providers and
-    // data_adapters.
     auto pProvider = createProvider(_datasources);
 
-    m_pActionsScheduler =
-        std::make_unique<Historical::ActionsScheduler>(std::move(pProvider));
+    m_pActionsScheduler = std::make_unique<Historical::ActionsScheduler>(
+        std::move(pProvider),
+        m_pClock
+    );
 
     simulator::log::info("historical data replier initialized successfully");
 }
 
 
-auto Replier::prepare() noexcept -> void { m_pActionsScheduler->initialize(); }
+Replier::~Replier()
+{
+    if (m_clockInstalled) {
+        simulator::core::use_system_time_source(nullptr);
+    }
+}
+
+
+auto Replier::prepare() noexcept -> void
+{
+    m_pActionsScheduler->initialize();
+
+    // Replay time runs apart from the wall clock only when it is scaled,
+    // in which case trading engines are switched to replay time as well.
+    if (m_pClock->speed() != 1. && !m_clockInstalled) {
+        simulator::core::use_system_time_source(m_pClock.get());
+        m_clockInstalled = true;
+        simulator::log::info(
+            "system time follows historical replay time from now on");
+    }
+}
 
 
 auto Replier::execute() -> void
 {
+    m_pHistoricalProcessor->retryHeldRecords();
+
+    if (m_pActionsScheduler->finished()) {
+        m_pHistoricalProcessor->flushHeldRecords();
+        return;
+    }
+
+    // Nothing but trading engines paces a replay in the max speed mode,
+    // so no further action is replayed while any engine is saturated.
+    if (m_pClock->isMaxSpeed() && m_pHistoricalProcessor->hasHeldRecords()) {
+        return;
+    }
+
+    // The replier wakes up before the next action is due
+    // only to retry records held back by saturated engines.
+    if (m_pActionsScheduler->nextActionTimeout() >
+        std::chrono::microseconds::zero()) {
+        return;
+    }
+
     m_pActionsScheduler->processNextAction([this](Historical::Action _action) {
         simulator::log::debug("historical replier is applying historical {}",
                               _action);
@@ -56,13 +101,23 @@ auto Replier::execute() -> void
 
 auto Replier::finished() const noexcept -> bool
 {
-    return m_pActionsScheduler->finished();
+    return m_pActionsScheduler->finished() &&
+           !m_pHistoricalProcessor->hasHeldRecords();
 }
 
 
 auto Replier::nextExecTimeout() const -> std::chrono::microseconds
 {
-    return m_pActionsScheduler->nextActionTimeout();
+    auto const actionTimeout = m_pActionsScheduler->nextActionTimeout();
+    if (!m_pHistoricalProcessor->hasHeldRecords()) {
+        return actionTimeout;
+    }
+    if (m_pClock->isMaxSpeed()) {
+        return Constant::Historical::HeldRecordsRetryInterval;
+    }
+    return std::min(
+        actionTimeout,
+        Constant::Historical::HeldRecordsRetryInterval);
 }
 
 
@@ -76,8 +131,20 @@ auto Replier::createProvider(Datasources const& _datasources)
         return nullptr;
     }
 
-    auto const& datasource = _datasources.front();
     auto pProviderFactory = std::make_unique<DataProvidersFactoryImpl>();
+    if (_datasources.size() > 1) {
+        try {
+            return pProviderFactory->createMergingProvider(_datasources);
+        } catch (std::exception const& _ex) {
+            simulator::log::warn(
+                "Failed to initialize a data provider for {} datasources: {}",
+                _datasources.size(),
+                _ex.what());
+        }
+        return nullptr;
+    }
+
+    auto const& datasource = _datasources.front();
     std::unique_ptr<DataProvider> pProvider{nullptr};
 
     try {
@@ -4,21 +4,40 @@
 #include <chrono>
 #include <exception>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include <fmt/chrono.h>
+#include <fmt/format.h>
 
 #include "ih/historical/data/provider.hpp"
 #include "ih/historical/data/record.hpp"
+#include "ih/historical/replay/replay_clock.hpp"
 #include "log/logging.hpp"
 
 namespace Simulator::Generator::Historical {
 
 ActionsScheduler::ActionsScheduler(std::unique_ptr<DataProvider> _pProvider) :
-    mDataProvider{std::move(_pProvider)}
+    ActionsScheduler(std::move(_pProvider), std::make_shared<ReplayClock>())
+{}
+
+ActionsScheduler::ActionsScheduler(
+    std::unique_ptr<DataProvider> _pProvider,
+    std::shared_ptr<ReplayClock> _pClock
+) :
+    mDataProvider{std::move(_pProvider)},
+    mClock{std::move(_pClock)}
 {
+    assert(mClock);
+    if (hasDataProvider()) {
+        mDataProvider->useClock(mClock);
+    }
+
     simulator::log::info(
-        "historical records scheduler initialized successfully");
+        "historical records scheduler initialized successfully, "
+        "replay speed: {}",
+        mClock->isMaxSpeed() ? std::string{"max"}
+                             : fmt::format("{}x", mClock->speed()));
 }
 
 auto ActionsScheduler::finished() const noexcept -> bool
@@ -37,7 +56,7 @@ auto ActionsScheduler::initialize() noexcept -> void
         mDataProvider->initializeTimeOffset();
     }
     if (hasPendingActions()) {
-        auto const newActionsTime = std::chrono::system_clock::now();
+        auto const newActionsTime = mClock->now();
         simulator::log::debug(
             "scheduler is resetting a base time to `{}' "
             "for previously cached actions",
@@ -64,6 +83,8 @@ auto ActionsScheduler::processNextAction(ActionProcessor const& _processor)
         assert(!mPendingActions.empty());
         auto nextAction = std::move(mPendingActions.front());
         mPendingActions.pop_front();
+        // In the max speed mode replay time jumps to each processed action.
+        mClock->advanceTo(nextAction.action_time());
         _processor(std::move(nextAction));
     }
 
@@ -72,21 +93,13 @@ auto ActionsScheduler::processNextAction(ActionProcessor const& _processor)
 
 auto ActionsScheduler::nextActionTimeout() const -> std::chrono::microseconds
 {
-    using std::chrono::system_clock;
-    using std::chrono::microseconds;
-    using std::chrono::duration_cast;
-    using std::chrono::time_point_cast;
-
-    constexpr microseconds immediately{0};
+    constexpr std::chrono::microseconds immediately{0};
 
     if (finished() || mPendingActions.empty()) {
         return immediately;
     }
 
-    auto const actionTime = mPendingActions.front().action_time();
-    auto const now = time_point_cast<Historical::Duration>(system_clock::now());
-    return now < actionTime ? duration_cast<microseconds>(actionTime - now)
-                            : immediately;
+    return mClock->timeUntil(mPendingActions.front().action_time());
 }
 
 auto ActionsScheduler::hasDataProvider() const noexcept -> bool
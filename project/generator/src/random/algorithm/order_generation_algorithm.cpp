@@ -1,6 +1,8 @@
 #include "ih/random/algorithm/order_generation_algorithm.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include <fmt/format.h>
 
@@ -33,6 +35,7 @@ OrderGenerationAlgorithm::OrderGenerationAlgorithm(
     ,   std::unique_ptr<RestingOrderActionGenerator> _pRestingActionGenerator
     ,   std::unique_ptr<PriceGenerator> _pPriceGenerator
     ,   std::unique_ptr<QuantityGenerator> _pQtyGenerator
+    ,   Trace::Sampler _traceSampler
 ) noexcept
     :   m_pContext{ std::move(_pAlgorithmContext) }
     ,   m_pEventGenerator{ std::move(_pEventGenerator) }
@@ -41,6 +44,7 @@ OrderGenerationAlgorithm::OrderGenerationAlgorithm(
     ,   m_pPriceGenerator { std::move(_pPriceGenerator) }
     ,   m_pQtyGenerator { std::move(_pQtyGenerator) }
     ,   quantity_params_selector_{ takeContext().getInstrument() }
+    ,   m_traceSampler { _traceSampler }
 {
     assert(m_pContext);
     assert(m_pEventGenerator);
@@ -52,13 +56,20 @@ OrderGenerationAlgorithm::OrderGenerationAlgorithm(
 
 
 std::unique_ptr<OrderGenerationAlgorithm> OrderGenerationAlgorithm::create(
-    std::shared_ptr<OrderGenerationContext> _pAlgorithmContext
+        std::shared_ptr<OrderGenerationContext> _pAlgorithmContext
+    ,   Trace::Sampler _traceSampler
+    ,   std::optional<std::uint64_t> _randomSeed
 )
 {
     assert(_pAlgorithmContext);
     auto const & targetVenue = _pAlgorithmContext->getVenue();
 
-    auto pValueGenerator = ValueGeneratorImpl::create();
+    auto pValueGenerator = _randomSeed.has_value()
+        ? ValueGeneratorImpl::create(
+                *_randomSeed
+            ,   _pAlgorithmContext->getInstrument().getListingId()
+          )
+        : ValueGeneratorImpl::create();
     auto pEventGenerator = EventGeneratorImpl::create(pValueGenerator);
     auto pPriceGenerator = PriceGeneratorImpl::create(pValueGenerator);
     auto pQtyGenerator = QuantityGeneratorImpl::create(pValueGenerator);
@@ -77,6 +88,7 @@ std::unique_ptr<OrderGenerationAlgorithm> OrderGenerationAlgorithm::create(
         ,   std::move(pRestingActionGenerator)
         ,   std::move(pPriceGenerator)
         ,   std::move(pQtyGenerator)
+        ,   _traceSampler
     );
 }
 
@@ -88,6 +100,7 @@ std::unique_ptr<OrderGenerationAlgorithm> OrderGenerationAlgorithm::create(
     ,   std::unique_ptr<RestingOrderActionGenerator> _pRestingActionGenerator
     ,   std::unique_ptr<PriceGenerator> _pPriceGenerator
     ,   std::unique_ptr<QuantityGenerator> _pQtyGenerator
+    ,   Trace::Sampler _traceSampler
 )
 {
     using Pointer = std::unique_ptr<OrderGenerationAlgorithm>;
@@ -98,6 +111,7 @@ std::unique_ptr<OrderGenerationAlgorithm> OrderGenerationAlgorithm::create(
         ,   std::move(_pRestingActionGenerator)
         ,   std::move(_pPriceGenerator)
         ,   std::move(_pQtyGenerator)
+        ,   _traceSampler
     } };
 }
 
@@ -109,7 +123,7 @@ bool OrderGenerationAlgorithm::generate(GeneratedMessage &_targetMessage)
         return launchOn(_targetMessage, _tracer);
     };
 
-    return Trace::trace(algorithm);
+    return Trace::trace(algorithm, m_traceSampler);
 }
 
 
@@ -240,15 +254,18 @@ void OrderGenerationAlgorithm::updateActiveRestingOrder(
 
     traceInput(step, makeValue("counterpartyId", ownerID.value()));
     traceInput(step, makeValue("orderID", orderID.value()));
-    traceInput(step, makeValue("orderSide",
-        fmt::format("{}", _existingOrder.getOrderSide())
-    ));
-    traceInput(step, makeValue("orderPrice",
-        fmt::format("{}", _existingOrder.getOrderPx())
-    ));
-    traceInput(step, makeValue("orderQty",
-        fmt::format("{}", _existingOrder.getOrderQty())
-    ));
+    if constexpr (IsRecording<GenerationTracer>)
+    {
+        traceInput(step, makeValue("orderSide",
+            fmt::format("{}", _existingOrder.getOrderSide())
+        ));
+        traceInput(step, makeValue("orderPrice",
+            fmt::format("{}", _existingOrder.getOrderPx())
+        ));
+        traceInput(step, makeValue("orderQty",
+            fmt::format("{}", _existingOrder.getOrderQty())
+        ));
+    }
 
     _msg.client_order_id = _existingOrder.getOrderID();
     _msg.orig_client_order_id =
@@ -281,14 +298,17 @@ void OrderGenerationAlgorithm::updateActiveRestingOrder(
 
     AttributesSetter::set(_msg, messageType, _tracer);
 
-    traceOutput(step,
-                makeValue("messageType", fmt::format("{}", _msg.message_type)));
-    if (!action.isCancellation())
+    if constexpr (IsRecording<GenerationTracer>)
     {
-      traceOutput(step,
-                  makeValue("price", fmt::format("{}", _msg.order_price)));
-      traceOutput(step,
-                  makeValue("quantity", fmt::format("{}", _msg.quantity)));
+        traceOutput(step,
+            makeValue("messageType", fmt::format("{}", _msg.message_type)));
+        if (!action.isCancellation())
+        {
+            traceOutput(step,
+                makeValue("price", fmt::format("{}", _msg.order_price)));
+            traceOutput(step,
+                makeValue("quantity", fmt::format("{}", _msg.quantity)));
+        }
     }
     traceStep(std::move(step), _tracer);
 }
@@ -469,8 +489,11 @@ bool OrderGenerationAlgorithm::isOppositeSideEmpty(
     auto const side = _event.targetSide();
     auto const opSide = Utils::opposite(side);
 
-    traceInput(step, makeValue("currentSide", fmt::format("{}", side)));
-    traceInput(step, makeValue("oppositeSide", fmt::format("{}", opSide)));
+    if constexpr (IsRecording<GenerationTracer>)
+    {
+        traceInput(step, makeValue("currentSide", fmt::format("{}", side)));
+        traceInput(step, makeValue("oppositeSide", fmt::format("{}", opSide)));
+    }
 
     auto const oppositePx = Utils::select_price(_mktState, opSide);
     traceInput(step,
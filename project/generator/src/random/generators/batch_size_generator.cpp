@@ -0,0 +1,121 @@
+#include "ih/random/generators/batch_size_generator.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "ih/random/generators/xoshiro_engine.hpp"
+
+namespace Simulator::Generator::Random {
+
+namespace {
+
+// Means below the threshold are sampled by multiplication,
+// which takes a number of draws proportional to the mean.
+constexpr double MultiplicationMeanLimit = 10.;
+
+// Advances a stream seed once, so that batch sizes and values
+// of the same instrument are drawn from unrelated sequences.
+std::uint64_t makeBatchSizeSeed(
+        std::uint64_t _seed
+    ,   std::uint64_t _streamId
+) noexcept
+{
+    std::uint64_t streamSeed = XoshiroEngine::streamSeed(_seed, _streamId);
+    return XoshiroEngine::splitMix(streamSeed);
+}
+
+} // namespace
+
+
+BatchSizeGenerator::BatchSizeGenerator()
+    :   m_engine { XoshiroEngine::makeRandomSeed() }
+{}
+
+
+BatchSizeGenerator::BatchSizeGenerator(
+        std::uint64_t _seed
+    ,   std::uint64_t _streamId
+) noexcept
+    :   m_engine { makeBatchSizeSeed(_seed, _streamId) }
+{}
+
+
+void BatchSizeGenerator::setExpectedSize(double _expectedSize)
+{
+    assert(_expectedSize >= 0.);
+
+    m_expectedSize = _expectedSize;
+    if (m_expectedSize < MultiplicationMeanLimit)
+    {
+        return;
+    }
+
+    double const b = 0.931 + 2.53 * std::sqrt(m_expectedSize);
+    m_rejection = RejectionParams {
+            .a = -0.059 + 0.02483 * b
+        ,   .b = b
+        ,   .logInvAlpha = std::log(1.1239 + 1.1328 / (b - 3.4))
+        ,   .vr = 0.9277 - 3.6224 / (b - 2.)
+        ,   .logMean = std::log(m_expectedSize)
+    };
+}
+
+
+std::size_t BatchSizeGenerator::generate()
+{
+    return m_expectedSize < MultiplicationMeanLimit
+        ? generateByMultiplication()
+        : generateByRejection();
+}
+
+
+std::size_t BatchSizeGenerator::generateByMultiplication()
+{
+    double const limit = std::exp(-m_expectedSize);
+
+    std::size_t size = 0;
+    double product = m_engine.generateCanonical();
+    while (product > limit)
+    {
+        ++size;
+        product *= m_engine.generateCanonical();
+    }
+    return size;
+}
+
+
+std::size_t BatchSizeGenerator::generateByRejection()
+{
+    RejectionParams const & params = m_rejection;
+    while (true)
+    {
+        double const u = m_engine.generateCanonical() - 0.5;
+        double const v = m_engine.generateCanonical();
+        double const us = 0.5 - std::fabs(u);
+        double const k = std::floor(
+            (2. * params.a / us + params.b) * u + m_expectedSize + 0.43
+        );
+
+        if (us >= 0.07 && v <= params.vr)
+        {
+            return static_cast<std::size_t>(k);
+        }
+        if (k < 0. || (us < 0.013 && v > us))
+        {
+            continue;
+        }
+
+        double const accepted = -m_expectedSize + k * params.logMean
+            - std::lgamma(k + 1.);
+        double const drawn = std::log(v) + params.logInvAlpha
+            - std::log(params.a / (us * us) + params.b);
+        if (drawn <= accepted)
+        {
+            return static_cast<std::size_t>(k);
+        }
+    }
+}
+
+} // namespace Simulator::Generator::Random
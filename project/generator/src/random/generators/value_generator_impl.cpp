@@ -1,15 +1,21 @@
 #include "ih/random/generators/value_generator_impl.hpp"
 
 #include <cassert>
+#include <cstdint>
 #include <memory>
-#include <random>
 
 #include "ih/random/generators/value_generator.hpp"
+#include "ih/random/generators/xoshiro_engine.hpp"
 
 namespace Simulator::Generator::Random {
 
 ValueGeneratorImpl::ValueGeneratorImpl()
-    :   m_engine { std::random_device {}() }
+    :   m_engine { XoshiroEngine::makeRandomSeed() }
+{}
+
+
+ValueGeneratorImpl::ValueGeneratorImpl(std::uint64_t _seed) noexcept
+    :   m_engine { _seed }
 {}
 
 
@@ -19,15 +25,35 @@ std::shared_ptr<ValueGeneratorImpl> ValueGeneratorImpl::create()
 }
 
 
+std::shared_ptr<ValueGeneratorImpl> ValueGeneratorImpl::create(
+    std::uint64_t _seed
+)
+{
+    return std::make_shared<ValueGeneratorImpl>(_seed);
+}
+
+
+std::shared_ptr<ValueGeneratorImpl> ValueGeneratorImpl::create(
+        std::uint64_t _seed
+    ,   std::uint64_t _streamId
+)
+{
+    return create(XoshiroEngine::streamSeed(_seed, _streamId));
+}
+
+
 ValueGeneratorImpl::RandomInt ValueGeneratorImpl::generateUniform(
         ValueGeneratorImpl::RandomInt _min
     ,   ValueGeneratorImpl::RandomInt _max
 )
 {
-    using Distribution = std::uniform_int_distribution<RandomInt>;
-
     assert(_min <= _max);
-    return Distribution { _min, _max }(m_engine);
+
+    // Computed in unsigned arithmetic, which wraps around instead of
+    // overflowing, a full range of values wraps to 0.
+    auto const min = static_cast<RandomUnsignedInt>(_min);
+    auto const range = static_cast<RandomUnsignedInt>(_max) - min + 1;
+    return static_cast<RandomInt>(min + generateBelow(range));
 }
 
 
@@ -37,20 +63,47 @@ ValueGeneratorImpl::generateUniform(
     ,   RandomUnsignedInt _max
 )
 {
-    using Distribution = std::uniform_int_distribution<RandomUnsignedInt>;
-
     assert(_min <= _max);
-    return Distribution { _min, _max }(m_engine);
+    return _min + generateBelow(_max - _min + 1);
 }
 
 
 ValueGeneratorImpl::RandomFloat
 ValueGeneratorImpl::generateUniform(RandomFloat _min, RandomFloat _max)
 {
-    using Distribution = std::uniform_real_distribution<RandomFloat>;
-
     assert(_min <= _max);
-    return Distribution { _min, _max }(m_engine);
+
+    return _min + m_engine.generateCanonical() * (_max - _min);
+}
+
+
+ValueGeneratorImpl::RandomUnsignedInt
+ValueGeneratorImpl::generateBelow(RandomUnsignedInt _range) noexcept
+{
+    // Supported by GCC and Clang, marked as an extension for -Wpedantic
+    __extension__ using Product = unsigned __int128;
+
+    if (_range == 0)
+    {
+        return m_engine();
+    }
+
+    // D. Lemire's multiply-shift method: the upper half of a 128-bit
+    // product is uniform in [0, _range), unless the lower half falls below
+    // 2^64 % _range. That is rare, so only a few draws need a division.
+    Product product = static_cast<Product>(m_engine()) * _range;
+    auto lower = static_cast<RandomUnsignedInt>(product);
+    if (lower < _range)
+    {
+        RandomUnsignedInt const threshold = (0 - _range) % _range;
+        while (lower < threshold)
+        {
+            product = static_cast<Product>(m_engine()) * _range;
+            lower = static_cast<RandomUnsignedInt>(product);
+        }
+    }
+
+    return static_cast<RandomUnsignedInt>(product >> 64);
 }
 
 } // namespace Simulator::Generator::Random
@@ -2,33 +2,43 @@
 
 #include <fmt/chrono.h>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <ratio>
+#include <string>
+#include <utility>
 
 #include "ih/adaptation/protocol_conversion.hpp"
+#include "ih/adaptation/request_prototypes.hpp"
 #include "ih/constants.hpp"
 #include "log/logging.hpp"
 #include "middleware/routing/trading_request_channel.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 
 namespace Simulator::Generator::Random {
 namespace {
 
 auto send_message(const GeneratedMessage& message,
-                  const simulator::InstrumentDescriptor& instrument) -> void {
+                  const RequestPrototypes& prototypes) -> void {
   try {
     if (message.message_type == MessageType::NewOrderSingle) {
       simulator::middleware::send_trading_request(
-          convert_to_order_placement_request(message, instrument));
+          convert_to_order_placement_request(message, prototypes));
     } else if (message.message_type ==
                MessageType::OrderCancelReplaceRequest) {
       simulator::middleware::send_trading_request(
-          convert_to_order_modification_request(message, instrument));
+          convert_to_order_modification_request(message, prototypes));
     } else if (message.message_type == MessageType::OrderCancelRequest) {
       simulator::middleware::send_trading_request(
-          convert_to_order_cancellation_request(message, instrument));
+          convert_to_order_cancellation_request(message, prototypes));
     }
   } catch (const simulator::middleware::ChannelUnboundError&) {
       simulator::log::err(
@@ -37,14 +47,85 @@ auto send_message(const GeneratedMessage& message,
   }
 }
 
+auto make_request(const GeneratedMessage& message,
+                  const RequestPrototypes& prototypes)
+    -> std::optional<simulator::protocol::OrderRequest> {
+  if (message.message_type == MessageType::NewOrderSingle) {
+    return convert_to_order_placement_request(message, prototypes);
+  }
+  if (message.message_type == MessageType::OrderCancelReplaceRequest) {
+    return convert_to_order_modification_request(message, prototypes);
+  }
+  if (message.message_type == MessageType::OrderCancelRequest) {
+    return convert_to_order_cancellation_request(message, prototypes);
+  }
+  return std::nullopt;
+}
+
+auto send_batch(simulator::protocol::OrderRequestBatch batch) -> void {
+  try {
+    simulator::middleware::send_trading_request(std::move(batch));
+  } catch (const simulator::middleware::ChannelUnboundError&) {
+    simulator::log::err(
+        "failed to send messages batch from random generator - trading "
+        "request channel is not bound");
+  }
+}
+
+auto send_resolved(simulator::protocol::ResolvedOrderRequests requests)
+    -> void {
+  const auto instrument = requests.instrument;
+  try {
+    simulator::middleware::send_trading_request(std::move(requests));
+  } catch (const simulator::middleware::ChannelUnboundError&) {
+    simulator::log::err(
+        "failed to send messages to resolved instrument from random "
+        "generator - trading request channel is not bound");
+  } catch (const std::exception& ex) {
+    simulator::log::err(
+        "failed to send messages to resolved instrument {} from random "
+        "generator: {}",
+        instrument.value,
+        ex.what());
+  }
+}
+
+auto send_resolved(simulator::protocol::ResolvedOrderRequest request) -> void {
+  const auto instrument = request.instrument;
+  try {
+    simulator::middleware::send_trading_request(std::move(request));
+  } catch (const simulator::middleware::ChannelUnboundError&) {
+    simulator::log::err(
+        "failed to send message to resolved instrument from random "
+        "generator - trading request channel is not bound");
+  } catch (const std::exception& ex) {
+    simulator::log::err(
+        "failed to send message to resolved instrument {} from random "
+        "generator: {}",
+        instrument.value,
+        ex.what());
+  }
+}
+
 }  // namespace
 
 OrderGenerator::OrderGenerator(
         std::shared_ptr<OrderInstrumentContext> _pInstrumentContext
     ,   std::unique_ptr<GenerationAlgorithm> _pRandomGenerationAlgorithm
+    ,   std::chrono::microseconds _batchInterval
+    ,   std::optional<std::uint64_t> _randomSeed
 )
     :   m_pInstrumentContext { std::move(_pInstrumentContext) }
     ,   m_pGenerationAlgorithm { std::move(_pRandomGenerationAlgorithm) }
+    ,   m_batchInterval { std::max(_batchInterval, std::chrono::microseconds::zero()) }
+    ,   m_batchSizeGenerator {
+            _randomSeed.has_value()
+                ? BatchSizeGenerator {
+                        *_randomSeed
+                    ,   m_pInstrumentContext->getInstrument().getListingId()
+                  }
+                : BatchSizeGenerator {}
+        }
 {
     assert(m_pInstrumentContext);
     assert(m_pGenerationAlgorithm);
@@ -54,10 +135,14 @@ OrderGenerator::OrderGenerator(
     auto const & listing = m_pInstrumentContext->getInstrument();
     simulator::log::info(
         "successfully initialized random orders generator for `{}' instrument "
-        "(id: {}), execution rate is set to {}",
+        "(id: {}), execution rate is set to {}{}",
         listing.getSymbol(),
         listing.getListingId(),
-        m_executionRate);
+        m_executionRate,
+        batched()
+            ? fmt::format(", messages are emitted in batches every {}",
+                          m_batchInterval)
+            : std::string{});
 }
 
 
@@ -69,7 +154,27 @@ bool OrderGenerator::finished() const noexcept
 
 
 void OrderGenerator::prepare() noexcept
-{}
+{
+    auto const & listing = m_pInstrumentContext->getInstrument();
+    m_instrumentHandle = resolve_instrument_handle(
+        m_pInstrumentContext->getRequestPrototypes());
+
+    if (m_instrumentHandle.has_value()) {
+      simulator::log::debug(
+          "random orders generator for `{}' instrument (id: {}) sends "
+          "requests to resolved instrument (handle: {})",
+          listing.getSymbol(),
+          listing.getListingId(),
+          m_instrumentHandle->value);
+    } else {
+      simulator::log::warn(
+          "random orders generator for `{}' instrument (id: {}) is unable "
+          "to resolve the instrument, requests are resolved by the trading "
+          "system one by one",
+          listing.getSymbol(),
+          listing.getListingId());
+    }
+}
 
 
 void OrderGenerator::execute()
@@ -80,19 +185,36 @@ void OrderGenerator::execute()
         listing.getSymbol(),
         listing.getListingId());
 
+    if (!admitGeneration()) {
+      return;
+    }
+
+    if (batched()) {
+      executeBatch();
+      return;
+    }
+
     bool const publish = m_pGenerationAlgorithm->generate(m_generatedMessage);
     if (!publish) {
       return;
     }
 
-    send_message(m_generatedMessage,
-                 m_pInstrumentContext->getInstrumentDescriptor());
+    auto const & prototypes = m_pInstrumentContext->getRequestPrototypes();
+    if (!m_instrumentHandle.has_value()) {
+      send_message(m_generatedMessage, prototypes);
+      return;
+    }
+
+    if (auto request = make_request(m_generatedMessage, prototypes)) {
+      send_resolved(simulator::protocol::ResolvedOrderRequest{
+          *m_instrumentHandle, std::move(*request)});
+    }
 }
 
 
 std::chrono::microseconds OrderGenerator::nextExecTimeout() const
 {
-    return m_executionRate;
+    return m_enginePacer.pace(batched() ? m_batchInterval : m_executionRate);
 }
 
 
@@ -126,6 +248,92 @@ void OrderGenerator::initExecutionRate()
         normalizeCoefficient);
 
     m_executionRate = normalizedRate;
+
+    if (batched()) {
+      using Seconds = std::chrono::duration<double>;
+      double const expectedBatchSize =
+          normalizeCoefficient * Seconds{m_batchInterval}.count();
+      m_batchSizeGenerator.setExpectedSize(expectedBatchSize);
+
+      simulator::log::debug(
+          "random generator for `{}' instrument (id: {}) expects {} "
+          "message(s) per {} batch interval",
+          instrument.getSymbol(),
+          instrument.getListingId(),
+          expectedBatchSize,
+          m_batchInterval);
+    }
+}
+
+
+bool OrderGenerator::admitGeneration()
+{
+    // The load of an instrument, which is not resolved, can not be queried.
+    if (!m_instrumentHandle.has_value()) {
+      return true;
+    }
+
+    if (m_enginePacer.admit(*m_instrumentHandle, EnginePacer::Clock::now())) {
+      return true;
+    }
+
+    auto const & load = m_enginePacer.lastLoad();
+    auto const & listing = m_pInstrumentContext->getInstrument();
+    simulator::log::debug(
+        "trading engine of `{}' instrument (id: {}) is saturated with {} "
+        "pending commands, the oldest one waits for {}, random generation "
+        "is skipped and slowed down {} times",
+        listing.getSymbol(),
+        listing.getListingId(),
+        load->queue_depth,
+        load->oldest_request_age,
+        m_enginePacer.slowdown());
+    return false;
+}
+
+
+bool OrderGenerator::batched() const noexcept
+{
+    return m_batchInterval > std::chrono::microseconds::zero();
+}
+
+
+void OrderGenerator::executeBatch()
+{
+    std::size_t const batchSize = m_batchSizeGenerator.generate();
+    if (batchSize == 0) {
+      return;
+    }
+
+    auto const & prototypes = m_pInstrumentContext->getRequestPrototypes();
+
+    simulator::protocol::OrderRequestBatch batch;
+    batch.reserve(batchSize);
+    for (std::size_t generated = 0; generated < batchSize; ++generated) {
+      // Messages are generated one by one, as each generated message
+      // affects the registry the next message is generated against.
+      if (!m_pGenerationAlgorithm->generate(m_generatedMessage)) {
+        continue;
+      }
+      if (auto request = make_request(m_generatedMessage, prototypes)) {
+        batch.emplace_back(std::move(*request));
+      }
+    }
+
+    if (!batch.empty()) {
+      send(std::move(batch));
+    }
+}
+
+
+void OrderGenerator::send(simulator::protocol::OrderRequestBatch _batch)
+{
+    if (m_instrumentHandle.has_value()) {
+      send_resolved(simulator::protocol::ResolvedOrderRequests{
+          *m_instrumentHandle, std::move(_batch)});
+    } else {
+      send_batch(std::move(_batch));
+    }
 }
 
 } // namespace Simulator::Generator::Random
@@ -1,9 +1,16 @@
 #include "ih/registry/generated_orders_registry_impl.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <optional>
-#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "ih/registry/generated_order_data.hpp"
@@ -11,69 +18,324 @@
 
 namespace Simulator::Generator {
 
-std::optional<GeneratedOrdersRegistryImpl::OrderData>
-GeneratedOrdersRegistryImpl::findByOwner(
-    std::string_view _ownerID
-) const
+namespace {
+
+// A power of two, large enough for orders of a single instrument
+// to be indexed without growing in most cases.
+constexpr std::size_t InitialIndexCapacity = 64;
+
+// Slot numbers of stored orders are kept below index entry markers.
+constexpr std::size_t MaxStoredOrdersCount =
+    std::numeric_limits<std::uint32_t>::max() - 1;
+
+// Empty slots are not compacted in small storages.
+constexpr std::size_t MinCompactedStorageSize = 64;
+
+std::size_t hashOf(std::string_view _key) noexcept
 {
-    std::shared_lock<decltype(m_mutex)> const lock { m_mutex };
+    return std::hash<std::string_view>{}(_key);
+}
 
-    if (auto optStoredIt = lookupIn(m_byOwnerAssoc, _ownerID))
+} // namespace
+
+
+GeneratedOrdersRegistryImpl::HashIndex::HashIndex(KeyOf _keyOf) noexcept
+    :   m_keyOf { _keyOf }
+{}
+
+
+std::optional<GeneratedOrdersRegistryImpl::SlotIdx>
+GeneratedOrdersRegistryImpl::HashIndex::find(
+        Storage const & _storage
+    ,   std::string_view _key
+) const noexcept
+{
+    if (m_entries.empty())
     {
-        auto storedIt = *optStoredIt;
-        return std::make_optional(*storedIt);
+        return std::nullopt;
     }
 
-    return std::nullopt;
+    std::size_t const hash = hashOf(_key);
+    for (std::size_t pos = hash & mask();; pos = (pos + 1) & mask())
+    {
+        Entry const & entry = m_entries[pos];
+        if (entry.slot == NoSlot)
+        {
+            return std::nullopt;
+        }
+        if (entry.slot != ErasedSlot && entry.hash == hash &&
+            m_keyOf(*_storage[entry.slot]) == _key)
+        {
+            return entry.slot;
+        }
+    }
 }
 
 
-std::optional<GeneratedOrdersRegistryImpl::OrderData>
-GeneratedOrdersRegistryImpl::findByIdentifier(
-    std::string_view _identifier
-) const
+void GeneratedOrdersRegistryImpl::HashIndex::insert(
+        Storage const & _storage
+    ,   SlotIdx _slot
+)
 {
-    std::shared_lock<decltype(m_mutex)> const lock { m_mutex };
+    // The load factor, including erased entries, is kept under a half,
+    // thus every probe chain ends with an empty entry.
+    if ((m_occupied + 1) * 2 > m_entries.size())
+    {
+        grow();
+    }
+
+    place(hashOf(m_keyOf(*_storage[_slot])), _slot);
+    ++m_occupied;
+}
 
-    if (auto optStoredIt = lookupIn(m_byIdentifierAssoc, _identifier))
+
+void GeneratedOrdersRegistryImpl::HashIndex::erase(
+        Storage const & _storage
+    ,   SlotIdx _slot
+) noexcept
+{
+    std::size_t const hash = hashOf(m_keyOf(*_storage[_slot]));
+    for (std::size_t pos = hash & mask();; pos = (pos + 1) & mask())
     {
-        auto storedIt = *optStoredIt;
-        return std::make_optional(*storedIt);
+        Entry & entry = m_entries[pos];
+        assert(entry.slot != NoSlot);
+        if (entry.slot == _slot)
+        {
+            entry.slot = ErasedSlot;
+            return;
+        }
     }
+}
 
-    return std::nullopt;
+
+void GeneratedOrdersRegistryImpl::HashIndex::rebuild(Storage const & _storage)
+{
+    std::fill(std::begin(m_entries), std::end(m_entries), Entry{});
+    m_occupied = 0;
+
+    for (std::size_t slot = 0; slot < _storage.size(); ++slot)
+    {
+        if (_storage[slot] != nullptr)
+        {
+            insert(_storage, static_cast<SlotIdx>(slot));
+        }
+    }
 }
 
 
-bool GeneratedOrdersRegistryImpl::add(OrderData && _newOrderData)
+void GeneratedOrdersRegistryImpl::HashIndex::place(
+        std::size_t _hash
+    ,   SlotIdx _slot
+) noexcept
+{
+    std::size_t pos = _hash & mask();
+    while (m_entries[pos].slot != NoSlot)
+    {
+        pos = (pos + 1) & mask();
+    }
+    m_entries[pos] = Entry { _hash, _slot };
+}
+
+
+void GeneratedOrdersRegistryImpl::HashIndex::grow()
 {
-    std::unique_lock<decltype(m_mutex)> const lock { m_mutex };
+    std::vector<Entry> previous = std::move(m_entries);
 
-    if (violatesUniqueConstraints(_newOrderData))
+    // Erased entries are dropped, so the index grows only
+    // when it is filled with present entries.
+    std::size_t present = 0;
+    for (Entry const & entry : previous)
     {
-        return false;
+        present += entry.slot != NoSlot && entry.slot != ErasedSlot ? 1 : 0;
     }
 
-    insert(std::move(_newOrderData));
-    return true;
+    std::size_t capacity = std::max(previous.size(), InitialIndexCapacity);
+    while ((present + 1) * 4 > capacity)
+    {
+        capacity *= 2;
+    }
+
+    m_entries.assign(capacity, Entry{});
+    m_occupied = present;
+    for (Entry const & entry : previous)
+    {
+        if (entry.slot != NoSlot && entry.slot != ErasedSlot)
+        {
+            place(entry.hash, entry.slot);
+        }
+    }
 }
 
 
-bool GeneratedOrdersRegistryImpl::updateByOwner(
+std::size_t GeneratedOrdersRegistryImpl::HashIndex::mask() const noexcept
+{
+    return m_entries.size() - 1;
+}
+
+
+GeneratedOrdersRegistryImpl::Snapshot::Snapshot() noexcept
+    :   byOwnerIndex { &GeneratedOrdersRegistryImpl::ownerKey }
+    ,   byIdentifierIndex { &GeneratedOrdersRegistryImpl::identifierKey }
+{}
+
+
+GeneratedOrdersRegistryImpl::TransactionView::TransactionView(
+    Snapshot & _snapshot
+) noexcept
+    :   m_snapshot { _snapshot }
+{}
+
+
+std::optional<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::TransactionView::findByOwner(
+    std::string_view _ownerID
+) const
+{
+    return find(m_snapshot, m_snapshot.byOwnerIndex, _ownerID);
+}
+
+
+std::optional<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::TransactionView::findByIdentifier(
+    std::string_view _identifier
+) const
+{
+    return find(m_snapshot, m_snapshot.byIdentifierIndex, _identifier);
+}
+
+
+bool GeneratedOrdersRegistryImpl::TransactionView::add(
+    OrderData && _newOrderData
+)
+{
+    return GeneratedOrdersRegistryImpl::add(
+        m_snapshot, std::move(_newOrderData));
+}
+
+
+bool GeneratedOrdersRegistryImpl::TransactionView::updateByOwner(
         std::string_view _ownerID
     ,   OrderData::Patch && _patch
 )
 {
-    std::unique_lock<decltype(m_mutex)> const lock { m_mutex };
+    return update(
+        m_snapshot, m_snapshot.byOwnerIndex, _ownerID, std::move(_patch));
+}
 
-    auto optStoredIt = lookupIn(m_byOwnerAssoc, _ownerID);
-    if (!optStoredIt.has_value())
-    {
-        return false;
-    }
 
-    update(*optStoredIt, std::move(_patch));
-    return true;
+bool GeneratedOrdersRegistryImpl::TransactionView::updateByIdentifier(
+        std::string_view _identifier
+    ,   OrderData::Patch && _patch
+)
+{
+    return update(
+            m_snapshot
+        ,   m_snapshot.byIdentifierIndex
+        ,   _identifier
+        ,   std::move(_patch)
+    );
+}
+
+
+bool GeneratedOrdersRegistryImpl::TransactionView::removeByOwner(
+    std::string_view _ownerID
+)
+{
+    return remove(m_snapshot, m_snapshot.byOwnerIndex, _ownerID);
+}
+
+
+bool GeneratedOrdersRegistryImpl::TransactionView::removeByIdentifier(
+    std::string_view _identifier
+)
+{
+    return remove(m_snapshot, m_snapshot.byIdentifierIndex, _identifier);
+}
+
+
+void GeneratedOrdersRegistryImpl::TransactionView::forEach(
+    Visitor const & _visitor
+) const
+{
+    GeneratedOrdersRegistryImpl::forEach(m_snapshot, _visitor);
+}
+
+
+std::vector<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::TransactionView::selectBy(
+    Predicate const & _predicate
+) const
+{
+    return GeneratedOrdersRegistryImpl::selectBy(m_snapshot, _predicate);
+}
+
+
+std::uint64_t
+GeneratedOrdersRegistryImpl::TransactionView::revision() const noexcept
+{
+    return m_snapshot.revision;
+}
+
+
+void GeneratedOrdersRegistryImpl::TransactionView::transact(
+    Transaction const & _transaction
+)
+{
+    _transaction(*this);
+}
+
+
+GeneratedOrdersRegistryImpl::GeneratedOrdersRegistryImpl()
+    :   m_current { std::make_shared<Snapshot>() }
+{
+    m_published.store(m_current);
+}
+
+
+std::optional<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::findByOwner(
+    std::string_view _ownerID
+) const
+{
+    auto const snapshot = acquire();
+    return find(*snapshot, snapshot->byOwnerIndex, _ownerID);
+}
+
+
+std::optional<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::findByIdentifier(
+    std::string_view _identifier
+) const
+{
+    auto const snapshot = acquire();
+    return find(*snapshot, snapshot->byIdentifierIndex, _identifier);
+}
+
+
+bool GeneratedOrdersRegistryImpl::add(OrderData && _newOrderData)
+{
+    // A violation is detected on the current snapshot, so that
+    // a rejected order does not cost a copy of the registry.
+    return write([&](Snapshot const & _current) {
+        return !violatesUniqueConstraints(_current, _newOrderData);
+    }, [&](Snapshot & _next) {
+        insert(_next, std::move(_newOrderData));
+        return true;
+    });
+}
+
+
+bool GeneratedOrdersRegistryImpl::updateByOwner(
+        std::string_view _ownerID
+    ,   OrderData::Patch && _patch
+)
+{
+    return write([&](Snapshot const & _current) {
+        return _current.byOwnerIndex.find(_current.storage, _ownerID)
+            .has_value();
+    }, [&](Snapshot & _next) {
+        return update(_next, _next.byOwnerIndex, _ownerID, std::move(_patch));
+    });
 }
 
 
@@ -82,76 +344,224 @@ bool GeneratedOrdersRegistryImpl::updateByIdentifier(
     ,   OrderData::Patch && _patch
 )
 {
-    std::unique_lock<decltype(m_mutex)> const lock { m_mutex };
+    return write([&](Snapshot const & _current) {
+        return _current.byIdentifierIndex.find(_current.storage, _identifier)
+            .has_value();
+    }, [&](Snapshot & _next) {
+        return update(
+                _next
+            ,   _next.byIdentifierIndex
+            ,   _identifier
+            ,   std::move(_patch)
+        );
+    });
+}
+
 
-    auto optStoredIt = lookupIn(m_byIdentifierAssoc, _identifier);
-    if (!optStoredIt.has_value())
+bool GeneratedOrdersRegistryImpl::removeByOwner(std::string_view _ownerID)
+{
+    return write([&](Snapshot const & _current) {
+        return _current.byOwnerIndex.find(_current.storage, _ownerID)
+            .has_value();
+    }, [&](Snapshot & _next) {
+        return remove(_next, _next.byOwnerIndex, _ownerID);
+    });
+}
+
+
+bool GeneratedOrdersRegistryImpl::removeByIdentifier(
+    std::string_view _identifier
+)
+{
+    return write([&](Snapshot const & _current) {
+        return _current.byIdentifierIndex.find(_current.storage, _identifier)
+            .has_value();
+    }, [&](Snapshot & _next) {
+        return remove(_next, _next.byIdentifierIndex, _identifier);
+    });
+}
+
+
+void GeneratedOrdersRegistryImpl::forEach(Visitor const & _visitor) const
+{
+    forEach(*acquire(), _visitor);
+}
+
+
+std::vector<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::selectBy(Predicate const & _predicate) const
+{
+    return selectBy(*acquire(), _predicate);
+}
+
+
+std::uint64_t GeneratedOrdersRegistryImpl::revision() const noexcept
+{
+    return acquire()->revision;
+}
+
+
+void GeneratedOrdersRegistryImpl::transact(Transaction const & _transaction)
+{
+    std::lock_guard<decltype(m_writersMutex)> const lock { m_writersMutex };
+
+    // Changes made by a throwing transaction are never published.
+    std::shared_ptr<Snapshot> next = makeWritableCopy();
+    TransactionView view { *next };
+    _transaction(view);
+
+    publish(std::move(next));
+}
+
+
+template<typename Precondition, typename WriteOp>
+bool GeneratedOrdersRegistryImpl::write(
+        Precondition && _precondition
+    ,   WriteOp && _write
+)
+{
+    std::lock_guard<decltype(m_writersMutex)> const lock { m_writersMutex };
+    if (!_precondition(std::as_const(*m_current)))
     {
         return false;
     }
 
-    update(*optStoredIt, std::move(_patch));
+    std::shared_ptr<Snapshot> next = makeWritableCopy();
+    if (!_write(*next))
+    {
+        m_spare = std::move(next);
+        return false;
+    }
+
+    publish(std::move(next));
     return true;
 }
 
 
-bool GeneratedOrdersRegistryImpl::removeByOwner(std::string_view _ownerID)
+std::shared_ptr<GeneratedOrdersRegistryImpl::Snapshot const>
+GeneratedOrdersRegistryImpl::acquire() const noexcept
+{
+    return m_published.load(std::memory_order_acquire);
+}
+
+
+std::shared_ptr<GeneratedOrdersRegistryImpl::Snapshot>
+GeneratedOrdersRegistryImpl::makeWritableCopy()
 {
-    std::unique_lock<decltype(m_mutex)> const lock { m_mutex };
+    // A spare snapshot is not published anymore, so once it is released
+    // by readers, nobody may acquire it again and it can be overwritten
+    // in place, keeping the capacity of its storage and indexes.
+    std::shared_ptr<Snapshot> next = std::exchange(m_spare, nullptr);
+    if (next != nullptr && next.use_count() == 1)
+    {
+        *next = *m_current;
+        return next;
+    }
+
+    return std::make_shared<Snapshot>(*m_current);
+}
+
+
+void GeneratedOrdersRegistryImpl::publish(std::shared_ptr<Snapshot> _snapshot)
+{
+    _snapshot->revision = m_current->revision + 1;
+    m_published.store(_snapshot, std::memory_order_release);
+    m_spare = std::exchange(m_current, std::move(_snapshot));
+}
+
 
-    auto optStoredIt = lookupIn(m_byOwnerAssoc, _ownerID);
-    if (!optStoredIt.has_value())
+std::optional<GeneratedOrdersRegistryImpl::OrderData>
+GeneratedOrdersRegistryImpl::find(
+        Snapshot const & _snapshot
+    ,   HashIndex const & _index
+    ,   std::string_view _key
+)
+{
+    if (auto const slot = _index.find(_snapshot.storage, _key))
+    {
+        return *_snapshot.storage[*slot];
+    }
+
+    return std::nullopt;
+}
+
+
+bool GeneratedOrdersRegistryImpl::add(
+        Snapshot & _snapshot
+    ,   OrderData && _newOrderData
+)
+{
+    if (violatesUniqueConstraints(_snapshot, _newOrderData))
     {
         return false;
     }
 
-    remove(*optStoredIt);
+    insert(_snapshot, std::move(_newOrderData));
     return true;
 }
 
 
-bool GeneratedOrdersRegistryImpl::removeByIdentifier(
-    std::string_view _identifier
+bool GeneratedOrdersRegistryImpl::update(
+        Snapshot & _snapshot
+    ,   HashIndex const & _index
+    ,   std::string_view _key
+    ,   OrderData::Patch && _patch
 )
 {
-    std::unique_lock<decltype(m_mutex)> const lock { m_mutex };
+    auto const slot = _index.find(_snapshot.storage, _key);
+    if (!slot.has_value())
+    {
+        return false;
+    }
+
+    return update(_snapshot, *slot, std::move(_patch));
+}
 
-    auto optStoredIt = lookupIn(m_byIdentifierAssoc, _identifier);
-    if (!optStoredIt.has_value())
+
+bool GeneratedOrdersRegistryImpl::remove(
+        Snapshot & _snapshot
+    ,   HashIndex const & _index
+    ,   std::string_view _key
+)
+{
+    auto const slot = _index.find(_snapshot.storage, _key);
+    if (!slot.has_value())
     {
         return false;
     }
 
-    remove(*optStoredIt);
+    remove(_snapshot, *slot);
     return true;
 }
 
 
-void GeneratedOrdersRegistryImpl::forEach(Visitor const & _visitor) const
+void GeneratedOrdersRegistryImpl::forEach(
+        Snapshot const & _snapshot
+    ,   Visitor const & _visitor
+)
 {
-    std::shared_lock<decltype(m_mutex)> const lock { m_mutex };
-
-    for (auto const & storedOrder : m_storage)
+    for (auto const & storedOrder : _snapshot.storage)
     {
-        _visitor(storedOrder);
+        if (storedOrder != nullptr)
+        {
+            _visitor(*storedOrder);
+        }
     }
 }
 
 
 std::vector<GeneratedOrdersRegistryImpl::OrderData>
-GeneratedOrdersRegistryImpl::selectBy(Predicate const & _predicate) const
+GeneratedOrdersRegistryImpl::selectBy(
+        Snapshot const & _snapshot
+    ,   Predicate const & _predicate
+)
 {
     std::vector<OrderData> selected {};
-
+    for (auto const & storedOrder : _snapshot.storage)
     {
-        std::shared_lock<decltype(m_mutex)> const lock { m_mutex };
-
-        for (auto const & storedOrder : m_storage)
+        if (storedOrder != nullptr && _predicate(*storedOrder))
         {
-            if (_predicate(storedOrder))
-            {
-                selected.emplace_back(storedOrder);
-            }
+            selected.emplace_back(*storedOrder);
         }
     }
 
@@ -159,98 +569,118 @@ GeneratedOrdersRegistryImpl::selectBy(Predicate const & _predicate) const
 }
 
 
-bool GeneratedOrdersRegistryImpl::violatesUniqueConstraints(
+std::string_view GeneratedOrdersRegistryImpl::ownerKey(
     OrderData const & _orderData
-) const
+) noexcept
 {
-    auto byOwnerIt = m_byOwnerAssoc.find(_orderData.getOwnerID().value());
-    auto byOrderIDIt = m_byIdentifierAssoc.find(_orderData.getOrderID().value());
-
-    const bool byOwnerIdxExists = byOwnerIt != std::end(m_byOwnerAssoc);
-    const bool byIdIdxExists = byOrderIDIt != std::end(m_byIdentifierAssoc);
-    return byOwnerIdxExists || byIdIdxExists;
+    return _orderData.getOwnerID().value();
 }
 
 
-void GeneratedOrdersRegistryImpl::insert(OrderData && _orderData)
+std::string_view GeneratedOrdersRegistryImpl::identifierKey(
+    OrderData const & _orderData
+) noexcept
 {
-    auto & inserted = m_storage.emplace_back(std::move(_orderData));
-    assert(!m_storage.empty());
-    auto insertedIt = std::prev(std::end(m_storage));
+    return _orderData.getOrderID().value();
+}
 
-    // It's critical to ensure that we create a string_views keys
-    // that are pointing to strings in inserted element
-    std::string_view const ownerKey { inserted.getOwnerID().value() };
-    auto ownerAssoc = std::make_pair(ownerKey, insertedIt);
-    [[maybe_unused]]
-    auto const ownerAssocRes = m_byOwnerAssoc.emplace(std::move(ownerAssoc));
-    assert(ownerAssocRes.second);
 
-    std::string_view const idKey { inserted.getOrderID().value() };
-    auto idAssoc = std::make_pair(idKey, insertedIt);
-    [[maybe_unused]]
-    auto const idAssocRes = m_byIdentifierAssoc.emplace(std::move(idAssoc));
-    assert(idAssocRes.second);
+bool GeneratedOrdersRegistryImpl::violatesUniqueConstraints(
+        Snapshot const & _snapshot
+    ,   OrderData const & _orderData
+)
+{
+    auto const byOwner = _snapshot.byOwnerIndex.find(
+        _snapshot.storage, ownerKey(_orderData));
+    auto const byOrderID = _snapshot.byIdentifierIndex.find(
+        _snapshot.storage, identifierKey(_orderData));
+    return byOwner.has_value() || byOrderID.has_value();
 }
 
 
-void GeneratedOrdersRegistryImpl::update(
-        Storage::iterator _storedIt
-    ,   OrderData::Patch && _patch
+void GeneratedOrdersRegistryImpl::insert(
+        Snapshot & _snapshot
+    ,   OrderData && _orderData
 )
 {
-    assert(_storedIt != std::end(m_storage));
+    if (_snapshot.storage.size() >= MaxStoredOrdersCount)
+    {
+        throw std::length_error {
+            "too many orders are stored in a generated orders registry"
+        };
+    }
 
-    // Remove existent by-owner association
-    auto byOwnerAssocIt = m_byOwnerAssoc.find(_storedIt->getOwnerID().value());
-    assert(byOwnerAssocIt != std::end(m_byOwnerAssoc));
-    m_byOwnerAssoc.erase(byOwnerAssocIt);
+    auto const slot = static_cast<SlotIdx>(_snapshot.storage.size());
+    _snapshot.storage.emplace_back(
+        std::make_shared<OrderData const>(std::move(_orderData)));
+    ++_snapshot.storedCount;
 
-    // Remove existent by-id association
-    auto byIDAssocIt = m_byIdentifierAssoc.find(_storedIt->getOrderID().value());
-    assert(byIDAssocIt != std::end(m_byIdentifierAssoc));
-    m_byIdentifierAssoc.erase(byIDAssocIt);
+    _snapshot.byOwnerIndex.insert(_snapshot.storage, slot);
+    _snapshot.byIdentifierIndex.insert(_snapshot.storage, slot);
+}
 
-    _storedIt->apply(std::move(_patch));
 
-    // Re-associate updated order data with an owner id
-    std::string_view const ownerKey { _storedIt->getOwnerID().value() };
-    auto ownerAssoc = std::make_pair(ownerKey, _storedIt);
-    [[maybe_unused]]
-    auto byOwnerAssocRes = m_byOwnerAssoc.emplace(std::move(ownerAssoc));
-    assert(byOwnerAssocRes.second);
+bool GeneratedOrdersRegistryImpl::update(
+        Snapshot & _snapshot
+    ,   SlotIdx _slot
+    ,   OrderData::Patch && _patch
+)
+{
+    Storage & storage = _snapshot.storage;
+    assert(_slot < storage.size() && storage[_slot] != nullptr);
+
+    // A stored order may be shared with published snapshots,
+    // so it is replaced with a patched copy.
+    OrderData updated = *storage[_slot];
+    updated.apply(std::move(_patch));
+
+    // An owner is never changed by a patch, while an order id may be,
+    // and it must not be taken by another stored order.
+    auto const sameIdentifier =
+        _snapshot.byIdentifierIndex.find(storage, identifierKey(updated));
+    if (sameIdentifier.has_value() && *sameIdentifier != _slot)
+    {
+        return false;
+    }
 
-    // Re-associate updated order data with an order id
-    std::string_view const idKey { _storedIt->getOrderID().value() };
-    auto idAssoc = std::make_pair(idKey, _storedIt);
-    [[maybe_unused]]
-    auto byIDAssocRes = m_byIdentifierAssoc.emplace(std::move(idAssoc));
-    assert(byIDAssocRes.second);
+    _snapshot.byIdentifierIndex.erase(storage, _slot);
+    storage[_slot] = std::make_shared<OrderData const>(std::move(updated));
+    _snapshot.byIdentifierIndex.insert(storage, _slot);
+    return true;
 }
 
 
-void GeneratedOrdersRegistryImpl::remove(Storage::iterator _storedIt)
+void GeneratedOrdersRegistryImpl::remove(Snapshot & _snapshot, SlotIdx _slot)
 {
-    assert(_storedIt != std::end(m_storage));
+    Storage & storage = _snapshot.storage;
+    assert(_slot < storage.size() && storage[_slot] != nullptr);
 
-    // Remove association firstly by accessing valid _storedIt
-    m_byIdentifierAssoc.erase(_storedIt->getOrderID().value());
-    m_byOwnerAssoc.erase(_storedIt->getOwnerID().value());
+    // Remove associations firstly, as they read keys from the stored order
+    _snapshot.byIdentifierIndex.erase(storage, _slot);
+    _snapshot.byOwnerIndex.erase(storage, _slot);
 
-    m_storage.erase(_storedIt);
+    storage[_slot].reset();
+    --_snapshot.storedCount;
+
+    compactIfSparse(_snapshot);
 }
 
 
-std::optional<GeneratedOrdersRegistryImpl::Storage::iterator>
-GeneratedOrdersRegistryImpl::lookupIn(
-        GeneratedOrdersRegistryImpl::HashTable const & _hashtable
-    ,   std::string_view _key
-)
+void GeneratedOrdersRegistryImpl::compactIfSparse(Snapshot & _snapshot)
 {
-    auto targetIt = _hashtable.find(_key);
-    return targetIt == std::end(_hashtable)
-        ?   std::nullopt
-        :   std::make_optional(targetIt->second);
+    Storage & storage = _snapshot.storage;
+    if (storage.size() < MinCompactedStorageSize ||
+        _snapshot.storedCount * 2 > storage.size())
+    {
+        return;
+    }
+
+    // Stored orders keep the order of insertion, slots are re-indexed.
+    std::erase_if(storage, [](auto const & _storedOrder) {
+        return _storedOrder == nullptr;
+    });
+    _snapshot.byOwnerIndex.rebuild(storage);
+    _snapshot.byIdentifierIndex.rebuild(storage);
 }
 
 } // namespace Simulator::Generator
@@ -1,6 +1,8 @@
 #include "ih/registry/registry_updater.hpp"
 
 #include <cassert>
+#include <exception>
+#include <span>
 #include <stdexcept>
 #include <utility>
 
@@ -65,6 +67,32 @@ void OrderRegistryUpdater::update(
 }
 
 
+void OrderRegistryUpdater::update(
+        GeneratedOrdersRegistry & _registry
+    ,   std::span<GeneratedMessage const> _messages
+)
+{
+    _registry.transact([_messages](GeneratedOrdersRegistry & _locked) {
+        OrderRegistryUpdater updater { _locked };
+        for (GeneratedMessage const & message : _messages)
+        {
+            try
+            {
+                updater.update(message);
+            }
+            catch (std::exception const & _ex)
+            {
+                simulator::log::warn(
+                    "generated orders registry updater failed to apply "
+                    "a `{}' message: {}",
+                    message.message_type,
+                    _ex.what());
+            }
+        }
+    });
+}
+
+
 void OrderRegistryUpdater::update(GeneratedMessage const & _message)
 {
     // Reject is not handled in this implementation:
@@ -0,0 +1,119 @@
+#include "ih/utils/engine_pacer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <optional>
+
+#include "ih/constants.hpp"
+#include "log/logging.hpp"
+#include "middleware/routing/trading_request_channel.hpp"
+
+namespace Simulator::Generator {
+
+EnginePacer::EnginePacer() noexcept
+    :   EnginePacer { defaultLimits() }
+{}
+
+EnginePacer::EnginePacer(Limits _limits) noexcept
+    :   m_limits { _limits }
+{
+    m_limits.maxSlowdown = std::max<std::uint32_t>(m_limits.maxSlowdown, 1);
+}
+
+
+EnginePacer::Limits EnginePacer::defaultLimits() noexcept
+{
+    return Limits {
+            Constant::EngineSaturationQueueDepth
+        ,   Constant::EngineSaturationRequestAge
+        ,   Constant::MaxGenerationSlowdown
+        ,   Constant::EngineLoadProbeInterval
+    };
+}
+
+
+bool EnginePacer::admit(simulator::protocol::EngineLoad const & _load) noexcept
+{
+    if (!isSaturated(_load))
+    {
+        m_slowdown = 1;
+        return true;
+    }
+
+    m_slowdown = std::min(m_slowdown * 2, m_limits.maxSlowdown);
+    return false;
+}
+
+
+bool EnginePacer::admit(
+        simulator::protocol::InstrumentHandle _instrument
+    ,   Clock::time_point _now
+) noexcept
+{
+    if (m_lastProbe.has_value() && _now - *m_lastProbe < m_limits.probeInterval)
+    {
+        return m_admitted;
+    }
+
+    m_lastProbe = _now;
+    m_lastLoad = queryEngineLoad(_instrument);
+    m_admitted = !m_lastLoad.has_value() || admit(*m_lastLoad);
+    return m_admitted;
+}
+
+
+std::optional<simulator::protocol::EngineLoad> const &
+EnginePacer::lastLoad() const noexcept
+{
+    return m_lastLoad;
+}
+
+
+bool EnginePacer::isSaturated(
+    simulator::protocol::EngineLoad const & _load
+) const noexcept
+{
+    return _load.queue_depth > m_limits.maxQueueDepth
+        || _load.oldest_request_age > m_limits.maxRequestAge;
+}
+
+
+std::uint32_t EnginePacer::slowdown() const noexcept
+{
+    return m_slowdown;
+}
+
+
+std::chrono::microseconds EnginePacer::pace(
+    std::chrono::microseconds _interval
+) const noexcept
+{
+    return _interval * m_slowdown;
+}
+
+
+std::optional<simulator::protocol::EngineLoad> queryEngineLoad(
+    simulator::protocol::InstrumentHandle _instrument
+) noexcept
+{
+    simulator::protocol::EngineLoadRequest const request { _instrument };
+    simulator::protocol::EngineLoadReply reply;
+    try {
+        simulator::middleware::send_trading_request(request, reply);
+    } catch (simulator::middleware::ChannelUnboundError const &) {
+        simulator::log::warn(
+            "failed to query engine load of the resolved instrument {} - "
+            "trading request channel is not bound",
+            _instrument.value);
+    } catch (std::exception const & _ex) {
+        simulator::log::warn(
+            "failed to query engine load of the resolved instrument {}: {}",
+            _instrument.value,
+            _ex.what());
+    }
+    return reply.load;
+}
+
+} // namespace Simulator::Generator
@@ -0,0 +1,365 @@
+#include "ih/utils/generation_scheduler.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "ih/context/component_context.hpp"
+#include "ih/utils/executable.hpp"
+#include "log/logging.hpp"
+
+namespace Simulator::Generator {
+
+GenerationScheduler::GenerationScheduler(
+        std::size_t _workersCount
+    ,   std::shared_ptr<ComponentContext> _pGlobalContext
+) noexcept
+    :   m_pGlobalContext{ std::move(_pGlobalContext) }
+    ,   m_workersCount{ _workersCount }
+{
+    assert(m_pGlobalContext);
+}
+
+
+GenerationScheduler::~GenerationScheduler() noexcept
+{
+    terminate();
+}
+
+
+std::unique_ptr<GenerationScheduler> GenerationScheduler::create(
+        std::size_t _workersCount
+    ,   std::shared_ptr<ComponentContext> _pGlobalContext
+)
+{
+    return std::make_unique<GenerationScheduler>(
+            _workersCount
+        ,   std::move(_pGlobalContext)
+    );
+}
+
+
+std::size_t GenerationScheduler::defaultWorkersCount(
+    std::size_t _executablesCount
+) noexcept
+{
+    std::size_t const concurrency =
+        std::max(std::thread::hardware_concurrency(), 1U);
+    return std::clamp<std::size_t>(_executablesCount, 1, concurrency);
+}
+
+
+void GenerationScheduler::add(std::unique_ptr<Executable> _pExecutable)
+{
+    assert(_pExecutable);
+
+    std::unique_lock<std::mutex> const lock { m_mutex };
+    // Workers access executables without locking,
+    // so the set of executables is fixed once the scheduler is launched.
+    assert(!m_launched);
+    m_executables.emplace_back(std::move(_pExecutable));
+}
+
+
+std::size_t GenerationScheduler::size() const noexcept
+{
+    std::unique_lock<std::mutex> const lock { m_mutex };
+    return m_executables.size();
+}
+
+
+void GenerationScheduler::launch()
+{
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        if (m_terminated)
+        {
+            simulator::log::warn(
+              "unable to launch a generation scheduler as it was terminated "
+              "previously");
+            return;
+        }
+
+        if (m_launched)
+        {
+            simulator::log::warn(
+              "unable to launch a generation scheduler as it is in executing "
+              "state already");
+            return;
+        }
+    }
+
+    if (!m_pGlobalContext->isComponentRunning())
+    {
+        m_pGlobalContext->callOnLaunch([this] { launch(); });
+        simulator::log::info("postponed launching of generation scheduler");
+        return;
+    }
+
+    start();
+    simulator::log::info(
+      "generation scheduler was launched successfully with {} worker(s) "
+      "serving {} executable(s)",
+      m_workersCount,
+      size());
+}
+
+
+void GenerationScheduler::terminate() noexcept
+{
+    std::vector<std::jthread> workers {};
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        if (m_terminated)
+        {
+            return;
+        }
+        m_terminated = true;
+        workers = std::move(m_workers);
+    }
+
+    simulator::log::debug("joining generation scheduler's workers");
+    for (auto & worker : workers)
+    {
+        worker.request_stop();
+    }
+    // Workers are joined by std::jthread destructors.
+    workers.clear();
+
+    simulator::log::info("generation scheduler was terminated successfully");
+}
+
+
+std::size_t GenerationScheduler::runDue(Clock::time_point _now)
+{
+    std::vector<std::size_t> due {};
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        while (!m_terminated && !m_deadlines.empty() &&
+               m_deadlines.top().time <= _now)
+        {
+            due.push_back(m_deadlines.top().executableIndex);
+            m_deadlines.pop();
+        }
+    }
+
+    for (auto const index : due)
+    {
+        if (process(index))
+        {
+            schedule(index, _now + m_executables[index]->nextExecTimeout());
+        }
+    }
+    return due.size();
+}
+
+
+void GenerationScheduler::start()
+{
+    std::unique_lock<std::mutex> const lock { m_mutex };
+    if (m_terminated || m_launched)
+    {
+        return;
+    }
+    m_launched = true;
+
+    // Prepared executables are due at once.
+    for (std::size_t index = 0; index < m_executables.size(); ++index)
+    {
+        m_executables[index]->prepare();
+        m_deadlines.push({ Clock::time_point::min(), index });
+    }
+
+    m_workers.reserve(m_workersCount);
+    for (std::size_t worker = 0; worker < m_workersCount; ++worker)
+    {
+        m_workers.emplace_back([this](std::stop_token const & _stopToken) {
+            work(_stopToken);
+        });
+    }
+}
+
+
+void GenerationScheduler::resume()
+{
+    std::vector<std::size_t> parked {};
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        if (m_terminated)
+        {
+            return;
+        }
+        m_resumptionRequested = false;
+        parked = std::move(m_parked);
+        m_parked.clear();
+    }
+
+    for (auto const index : parked)
+    {
+        m_executables[index]->prepare();
+    }
+
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        for (auto const index : parked)
+        {
+            m_deadlines.push({ Clock::time_point::min(), index });
+        }
+    }
+    m_deadlineCondition.notify_all();
+
+    simulator::log::debug(
+      "generation scheduler resumed {} suspended executable(s)",
+      parked.size());
+}
+
+
+void GenerationScheduler::park(std::size_t _executableIndex)
+{
+    bool requestResumption = false;
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        m_parked.push_back(_executableIndex);
+        if (!m_resumptionRequested && !m_terminated)
+        {
+            m_resumptionRequested = true;
+            requestResumption = true;
+        }
+    }
+
+    if (!requestResumption)
+    {
+        return;
+    }
+
+    try
+    {
+        m_pGlobalContext->callOnLaunch([this] { resume(); });
+        simulator::log::debug(
+          "generation scheduler has been suspended till "
+          "next launch notification from the generation context");
+    }
+    catch (std::exception const & _ex)
+    {
+        simulator::log::err(
+          "an error occurred while postponing generation scheduler "
+          "resumption on next generator launch event: {}",
+          _ex.what());
+    }
+}
+
+
+void GenerationScheduler::schedule(
+        std::size_t _executableIndex
+    ,   Clock::time_point _time
+)
+{
+    {
+        std::unique_lock<std::mutex> const lock { m_mutex };
+        m_deadlines.push({ _time, _executableIndex });
+    }
+    m_deadlineCondition.notify_one();
+}
+
+
+void GenerationScheduler::work(std::stop_token const & _stopToken) noexcept
+{
+    std::unique_lock<std::mutex> lock { m_mutex };
+    while (!_stopToken.stop_requested())
+    {
+        if (m_deadlines.empty())
+        {
+            m_deadlineCondition.wait(lock, _stopToken, [this] {
+                return !m_deadlines.empty();
+            });
+            continue;
+        }
+
+        auto const due = m_deadlines.top().time;
+        if (due > Clock::now())
+        {
+            // Wakes up earlier when a closer deadline is scheduled.
+            m_deadlineCondition.wait_until(lock, _stopToken, due, [this, due] {
+                return m_deadlines.empty() || m_deadlines.top().time < due;
+            });
+            continue;
+        }
+
+        auto const executableIndex = m_deadlines.top().executableIndex;
+        m_deadlines.pop();
+
+        lock.unlock();
+        if (process(executableIndex))
+        {
+            try
+            {
+                schedule(
+                        executableIndex
+                    ,   Clock::now() +
+                        m_executables[executableIndex]->nextExecTimeout()
+                );
+            }
+            catch (std::exception const & _ex)
+            {
+                simulator::log::err(
+                  "failed to schedule a generation executable: {}",
+                  _ex.what());
+            }
+        }
+        lock.lock();
+    }
+}
+
+
+bool GenerationScheduler::process(std::size_t _executableIndex) noexcept
+{
+    auto & executable = *m_executables[_executableIndex];
+
+    try
+    {
+        if (!m_pGlobalContext->isComponentRunning())
+        {
+            park(_executableIndex);
+
+            // The component might have been launched before the callback
+            // was registered, in which case the notification has been missed.
+            if (m_pGlobalContext->isComponentRunning())
+            {
+                resume();
+            }
+            return false;
+        }
+
+        executable.execute();
+        if (executable.finished())
+        {
+            simulator::log::debug("generation executable has finished");
+            return false;
+        }
+        return true;
+    }
+    catch (std::exception const & _ex)
+    {
+        simulator::log::err(
+          "error occurred in the generation scheduler's worker: {}",
+          _ex.what());
+
+        // The failed executable is restarted on the next generator launch,
+        // as it was done for an executable running on a dedicated thread.
+        try
+        {
+            park(_executableIndex);
+        }
+        catch (...)
+        {
+            simulator::log::err(
+              "failed to suspend a generation executable after an error");
+        }
+    }
+    return false;
+}
+
+} // namespace Simulator::Generator
@@ -0,0 +1,47 @@
+#include "ih/utils/parallel.hpp"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace Simulator::Generator {
+
+auto forEachIndexInParallel(
+    std::size_t _count,
+    std::function<void(std::size_t)> const& _function
+) -> void
+{
+    std::size_t const concurrency =
+        std::max(std::thread::hardware_concurrency(), 1U);
+    std::size_t const tasksCount = std::min(_count, concurrency);
+    if (tasksCount <= 1) {
+        for (std::size_t idx = 0; idx < _count; ++idx) {
+            _function(idx);
+        }
+        return;
+    }
+
+    std::size_t const chunkSize = (_count + tasksCount - 1) / tasksCount;
+    std::vector<std::future<void>> pendingChunks;
+    pendingChunks.reserve(tasksCount);
+    for (std::size_t begin = 0; begin < _count; begin += chunkSize) {
+        std::size_t const end = std::min(begin + chunkSize, _count);
+        pendingChunks.push_back(std::async(std::launch::async, [&, begin, end] {
+            for (std::size_t idx = begin; idx < end; ++idx) {
+                _function(idx);
+            }
+        }));
+    }
+
+    // All chunks are awaited before an exception leaves the function,
+    // as they refer to the caller's state.
+    for (auto& pendingChunk : pendingChunks) {
+        pendingChunk.wait();
+    }
+    for (auto& pendingChunk : pendingChunks) {
+        pendingChunk.get();
+    }
+}
+
+} // namespace Simulator::Generator
@@ -0,0 +1,40 @@
+#include "ih/utils/price_seeds_index.hpp"
+
+#include <string>
+#include <utility>
+
+namespace Simulator::Generator {
+
+PriceSeedsIndex::PriceSeedsIndex(std::vector<DataLayer::PriceSeed> _seeds)
+{
+    for (auto& seed : _seeds) {
+        if (!seed.getSymbol().has_value()) {
+            continue;
+        }
+
+        std::string symbol = *seed.getSymbol();
+        auto const [seedIt, inserted] =
+            mSeedsBySymbol.try_emplace(std::move(symbol), std::move(seed));
+        if (!inserted) {
+            seedIt->second.reset();
+        }
+    }
+}
+
+auto PriceSeedsIndex::find(std::string const& _symbol) const
+    -> DataLayer::PriceSeed const*
+{
+    auto const seedIt = mSeedsBySymbol.find(_symbol);
+    if (seedIt == mSeedsBySymbol.end() || !seedIt->second.has_value()) {
+        return nullptr;
+    }
+    return &*seedIt->second;
+}
+
+auto PriceSeedsIndex::isAmbiguous(std::string const& _symbol) const -> bool
+{
+    auto const seedIt = mSeedsBySymbol.find(_symbol);
+    return seedIt != mSeedsBySymbol.end() && !seedIt->second.has_value();
+}
+
+} // namespace Simulator::Generator
@@ -26,6 +26,8 @@ public:
 
     MOCK_METHOD(simulator::InstrumentDescriptor const &, getInstrumentDescriptor, (), (const, noexcept, override));
 
+    MOCK_METHOD(Generator::RequestPrototypes const &, getRequestPrototypes, (), (const, noexcept, override));
+
     MOCK_METHOD(std::size_t, nextMessageNumber, (), (noexcept, override));
 
     MOCK_METHOD(Generator::GeneratedOrdersRegistry &, takeRegistry, (), (noexcept, override));
@@ -44,6 +46,8 @@ public:
 
     MOCK_METHOD(simulator::InstrumentDescriptor const &, getInstrumentDescriptor, (), (const, noexcept, override));
 
+    MOCK_METHOD(Generator::RequestPrototypes const &, getRequestPrototypes, (), (const, noexcept, override));
+
     MOCK_METHOD(std::size_t, nextMessageNumber, (), (noexcept, override));
 
     MOCK_METHOD(Generator::GeneratedOrdersRegistry &, takeRegistry, (), (noexcept, override));
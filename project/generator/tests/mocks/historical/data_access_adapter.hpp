@@ -33,12 +33,16 @@ public:
     [[nodiscard]]
     bool hasNextRecord() const noexcept override
     {
-        return !m_assignedRecords.empty();
+        return !m_assignedRecords.empty() || m_failsReading;
     }
 
     void parseNextRecord(Historical::Record::Builder & _builder) override
     {
         assert(hasNextRecord());
+        if (m_assignedRecords.empty()) {
+            m_failsReading = false;
+            throw Historical::DataSourceReadError{"fake read error"};
+        }
         _builder = std::move(m_assignedRecords.front());
         m_assignedRecords.pop_front();
     }
@@ -48,9 +52,16 @@ public:
         m_assignedRecords.emplace_back(std::move(_builder));
     }
 
+    // Fails to read the datasource after the assigned records are parsed.
+    void failReadingAfterRecords()
+    {
+        m_failsReading = true;
+    }
+
 private:
 
     std::deque<Historical::Record::Builder> m_assignedRecords;
+    bool m_failsReading{false};
 };
 
 } // namespace Simulator::Generator::Fake
@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_GENERATOR_TESTS_MOCKS_GENERATED_ORDERS_REGISTRY_HPP_
 #define SIMULATOR_GENERATOR_TESTS_MOCKS_GENERATED_ORDERS_REGISTRY_HPP_
 
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -34,6 +35,10 @@ public:
     MOCK_METHOD(void, forEach, (Visitor const &), (const, override));
 
     MOCK_METHOD(std::vector<OrderData>, selectBy, (Predicate const &), (const, override));
+
+    MOCK_METHOD(std::uint64_t, revision, (), (const, noexcept, override));
+
+    MOCK_METHOD(void, transact, (Transaction const &), (override));
 };
 
 } // Simulator::Generator::Mock
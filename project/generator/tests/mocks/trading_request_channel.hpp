@@ -15,7 +15,12 @@ struct TradingRequestReceiver
   MOCK_METHOD(void, process, (simulator::protocol::OrderCancellationRequest));
   MOCK_METHOD(void, process, (simulator::protocol::MarketDataRequest));
   MOCK_METHOD(void, process, (simulator::protocol::SecurityStatusRequest));
+  MOCK_METHOD(void, process, (simulator::protocol::OrderRequestBatch));
   MOCK_METHOD(void, process, (const simulator::protocol::InstrumentStateRequest&, simulator::protocol::InstrumentState&));
+  MOCK_METHOD(void, process, (const simulator::protocol::InstrumentHandleRequest&, simulator::protocol::InstrumentHandleReply&));
+  MOCK_METHOD(void, process, (simulator::protocol::ResolvedOrderRequests));
+  MOCK_METHOD(void, process, (simulator::protocol::ResolvedOrderRequest));
+  MOCK_METHOD(void, process, (const simulator::protocol::EngineLoadRequest&, simulator::protocol::EngineLoadReply&));
   // clang-format on
 };
 
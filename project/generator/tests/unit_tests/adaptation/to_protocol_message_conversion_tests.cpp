@@ -1,5 +1,6 @@
 #include <gmock/gmock.h>
 
+#include <memory>
 #include <optional>
 
 #include "ih/adaptation/protocol_conversion.hpp"
@@ -13,11 +14,11 @@ using namespace testing;  // NOLINT
 
 struct GeneratorOrderPlacementRequestConversion : Test {
   GeneratedMessage message;
-  simulator::InstrumentDescriptor instrument;
+  RequestPrototypes prototypes{simulator::InstrumentDescriptor{}};
 };
 
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsGeneratorSession) {
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.session.value,
               VariantWith<simulator::protocol::generator::Session>(_));
@@ -26,7 +27,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsGeneratorSession) {
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsOrderType) {
   message.order_type = simulator::OrderType::Option::Limit;
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.order_type,
               Optional(Eq(simulator::OrderType::Option::Limit)));
@@ -36,7 +37,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsPriceForLimitOrder) {
   message.order_type = simulator::OrderType::Option::Limit;
   message.order_price = simulator::OrderPrice{42.42};
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.order_price, Optional(Eq(simulator::Price{42.42})));
 }
@@ -45,7 +46,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, IgnoresPriceForMarketOrders) {
   message.order_type = simulator::OrderType::Option::Market;
   message.order_price = simulator::OrderPrice{42.42};
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.order_price, Eq(std::nullopt));
 }
@@ -53,7 +54,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, IgnoresPriceForMarketOrders) {
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsQuantity) {
   message.quantity = simulator::Quantity{42.42};
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.order_quantity,
               Optional(Eq(simulator::OrderQuantity{42.42})));
@@ -62,7 +63,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsQuantity) {
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsTimeInForce) {
   message.time_in_force = simulator::TimeInForce::Option::Day;
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.time_in_force,
               Optional(Eq(simulator::TimeInForce::Option::Day)));
@@ -71,7 +72,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsTimeInForce) {
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsSide) {
   message.side = simulator::Side::Option::Sell;
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.side, Optional(Eq(simulator::Side::Option::Sell)));
 }
@@ -79,7 +80,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsSide) {
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsClientOrderId) {
   message.client_order_id = simulator::ClientOrderId{"GeneratorOrdID"};
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.client_order_id,
               Optional(Eq(simulator::ClientOrderId{"GeneratorOrdID"})));
@@ -88,7 +89,7 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsClientOrderId) {
 TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsParties) {
   message.party_id = simulator::PartyId{"CP1"};
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(
       request.parties,
@@ -102,12 +103,12 @@ TEST_F(GeneratorOrderPlacementRequestConversion, ConvertsParties) {
 
 struct GeneratorOrderModificationRequestConversion : Test {
   GeneratedMessage message;
-  simulator::InstrumentDescriptor instrument;
+  RequestPrototypes prototypes{simulator::InstrumentDescriptor{}};
 };
 
 TEST_F(GeneratorOrderModificationRequestConversion, ConvertsGeneratorSession) {
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.session.value,
               VariantWith<simulator::protocol::generator::Session>(_));
@@ -117,7 +118,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsOrderType) {
   message.order_type = simulator::OrderType::Option::Limit;
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.order_type,
               Optional(Eq(simulator::OrderType::Option::Limit)));
@@ -128,7 +129,7 @@ TEST_F(GeneratorOrderModificationRequestConversion,
   message.order_type = simulator::OrderType::Option::Limit;
   message.order_price = simulator::OrderPrice{42.42};
 
-  const auto request = convert_to_order_placement_request(message, instrument);
+  const auto request = convert_to_order_placement_request(message, prototypes);
 
   ASSERT_THAT(request.order_price, Optional(Eq(simulator::Price{42.42})));
 }
@@ -139,7 +140,7 @@ TEST_F(GeneratorOrderModificationRequestConversion,
   message.order_price = simulator::OrderPrice{42.42};
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.order_price, Eq(std::nullopt));
 }
@@ -148,7 +149,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsQuantity) {
   message.quantity = simulator::Quantity{42.42};
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.order_quantity,
               Optional(Eq(simulator::OrderQuantity{42.42})));
@@ -158,7 +159,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsTimeInForce) {
   message.time_in_force = simulator::TimeInForce::Option::Day;
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.time_in_force,
               Optional(Eq(simulator::TimeInForce::Option::Day)));
@@ -168,7 +169,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsSide) {
   message.side = simulator::Side::Option::Sell;
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.side, Optional(Eq(simulator::Side::Option::Sell)));
 }
@@ -177,7 +178,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsClientOrderId) {
   message.client_order_id = simulator::ClientOrderId{"GeneratorOrdID"};
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.client_order_id,
               Optional(Eq(simulator::ClientOrderId{"GeneratorOrdID"})));
@@ -187,7 +188,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsOrigClientOrderId) {
   message.orig_client_order_id = simulator::OrigClientOrderId{"GeneratorOrdID"};
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(request.orig_client_order_id,
               Optional(Eq(simulator::OrigClientOrderId{"GeneratorOrdID"})));
@@ -197,7 +198,7 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsParties) {
   message.party_id = simulator::PartyId{"CP1"};
 
   const auto request =
-      convert_to_order_modification_request(message, instrument);
+      convert_to_order_modification_request(message, prototypes);
 
   ASSERT_THAT(
       request.parties,
@@ -211,12 +212,12 @@ TEST_F(GeneratorOrderModificationRequestConversion, ConvertsParties) {
 
 struct GeneratorOrderCancellationRequestConversion : Test {
   GeneratedMessage message;
-  simulator::InstrumentDescriptor instrument;
+  RequestPrototypes prototypes{simulator::InstrumentDescriptor{}};
 };
 
 TEST_F(GeneratorOrderCancellationRequestConversion, ConvertsGeneratorSession) {
   const auto request =
-      convert_to_order_cancellation_request(message, instrument);
+      convert_to_order_cancellation_request(message, prototypes);
 
   ASSERT_THAT(request.session.value,
               VariantWith<simulator::protocol::generator::Session>(_));
@@ -226,7 +227,7 @@ TEST_F(GeneratorOrderCancellationRequestConversion, ConvertsSide) {
   message.side = simulator::Side::Option::Buy;
 
   const auto request =
-      convert_to_order_cancellation_request(message, instrument);
+      convert_to_order_cancellation_request(message, prototypes);
 
   ASSERT_THAT(request.side, Optional(Eq(simulator::Side::Option::Buy)));
 }
@@ -235,7 +236,7 @@ TEST_F(GeneratorOrderCancellationRequestConversion, ConvertsClientOrderId) {
   message.client_order_id = simulator::ClientOrderId{"GeneratorOrdID"};
 
   const auto request =
-      convert_to_order_cancellation_request(message, instrument);
+      convert_to_order_cancellation_request(message, prototypes);
 
   ASSERT_THAT(request.client_order_id,
               Optional(Eq(simulator::ClientOrderId{"GeneratorOrdID"})));
@@ -245,12 +246,102 @@ TEST_F(GeneratorOrderCancellationRequestConversion, ConvertsOrigClientOrderId) {
   message.orig_client_order_id = simulator::OrigClientOrderId{"GeneratorOrdID"};
 
   const auto request =
-      convert_to_order_cancellation_request(message, instrument);
+      convert_to_order_cancellation_request(message, prototypes);
 
   ASSERT_THAT(request.orig_client_order_id,
               Optional(Eq(simulator::OrigClientOrderId{"GeneratorOrdID"})));
 }
 
+struct GeneratorPrototypeRequestConversion : Test {
+  static auto make_instrument() -> simulator::InstrumentDescriptor {
+    simulator::InstrumentDescriptor instrument;
+    instrument.symbol = simulator::Symbol{"AAPL"};
+    return instrument;
+  }
+
+  GeneratedMessage message;
+  RequestPrototypes prototypes{make_instrument()};
+};
+
+TEST_F(GeneratorPrototypeRequestConversion, KeepsInstrumentDescriptor) {
+  ASSERT_THAT(prototypes.instrument().symbol,
+              Optional(Eq(simulator::Symbol{"AAPL"})));
+}
+
+TEST_F(GeneratorPrototypeRequestConversion, ConvertsPlacementRequest) {
+  message.order_type = simulator::OrderType::Option::Limit;
+  message.order_price = simulator::OrderPrice{42.42};
+  message.party_id = simulator::PartyId{"CP1"};
+
+  const auto request = convert_to_order_placement_request(message, prototypes);
+
+  ASSERT_THAT(request.session.value,
+              VariantWith<simulator::protocol::generator::Session>(_));
+  ASSERT_EQ(request.instrument, prototypes.instrument());
+  ASSERT_THAT(request.order_price, Optional(Eq(simulator::Price{42.42})));
+  ASSERT_THAT(request.parties, SizeIs(1));
+}
+
+TEST_F(GeneratorPrototypeRequestConversion, ConvertsModificationRequest) {
+  message.orig_client_order_id = simulator::OrigClientOrderId{"GeneratorOrdID"};
+
+  const auto request =
+      convert_to_order_modification_request(message, prototypes);
+
+  ASSERT_EQ(request.instrument, prototypes.instrument());
+  ASSERT_THAT(request.orig_client_order_id,
+              Optional(Eq(simulator::OrigClientOrderId{"GeneratorOrdID"})));
+}
+
+TEST_F(GeneratorPrototypeRequestConversion, ConvertsCancellationRequest) {
+  message.side = simulator::Side::Option::Buy;
+
+  const auto request =
+      convert_to_order_cancellation_request(message, prototypes);
+
+  ASSERT_EQ(request.instrument, prototypes.instrument());
+  ASSERT_THAT(request.side, Optional(Eq(simulator::Side::Option::Buy)));
+}
+
+TEST_F(GeneratorPrototypeRequestConversion, DoesNotChangePrototypes) {
+  message.party_id = simulator::PartyId{"CP1"};
+  message.client_order_id = simulator::ClientOrderId{"GeneratorOrdID"};
+
+  const auto request = convert_to_order_placement_request(message, prototypes);
+
+  ASSERT_THAT(prototypes.placement().parties, IsEmpty());
+  ASSERT_EQ(prototypes.placement().client_order_id, std::nullopt);
+}
+
+TEST_F(GeneratorPrototypeRequestConversion, SharesInstrumentDescriptor) {
+  const auto instrument =
+      std::make_shared<const simulator::InstrumentDescriptor>(
+          make_instrument());
+
+  const RequestPrototypes shared_prototypes{instrument};
+
+  ASSERT_EQ(shared_prototypes.shared_instrument(), instrument);
+  ASSERT_EQ(&shared_prototypes.instrument(), instrument.get());
+}
+
+TEST_F(GeneratorPrototypeRequestConversion, ConvertsOrderPartiesOnce) {
+  const auto& first = prototypes.order_parties(simulator::PartyId{"CP1"});
+  const auto& second = prototypes.order_parties(simulator::PartyId{"CP1"});
+
+  ASSERT_EQ(&first, &second);
+  ASSERT_THAT(first, SizeIs(1));
+  ASSERT_EQ(first.front().role(), simulator::PartyRole::Option::ExecutingFirm);
+}
+
+TEST_F(GeneratorPrototypeRequestConversion,
+       ConvertsOrderPartiesPerCounterparty) {
+  const auto& first = prototypes.order_parties(simulator::PartyId{"CP1"});
+  const auto& second = prototypes.order_parties(simulator::PartyId{"CP2"});
+
+  ASSERT_NE(&first, &second);
+  ASSERT_EQ(second.front().identifier().party_id(), simulator::PartyId{"CP2"});
+}
+
 // NOLINTEND(*magic-numbers*)
 
 }  // namespace
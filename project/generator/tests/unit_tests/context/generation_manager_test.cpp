@@ -220,6 +220,31 @@ TEST_F(Generator_IdentifierGenerator, CreateIdentifier)
     EXPECT_TRUE(numberPart > minNumber);
 }
 
+TEST_F(Generator_IdentifierGenerator, CreateSameIdentifiersForSameSeed)
+{
+    IdentifierGenerator first{ 42, 7 };
+    IdentifierGenerator second{ 42, 7 };
+
+    for (int generated = 0; generated < 10; ++generated) {
+        EXPECT_EQ(first.generateIdentifier(), second.generateIdentifier());
+    }
+}
+
+TEST_F(Generator_IdentifierGenerator, CreateDifferentIdentifiersForSeeds)
+{
+    IdentifierGenerator first{ 42, 7 };
+    IdentifierGenerator second{ 43, 7 };
+
+    EXPECT_NE(first.generateIdentifier(), second.generateIdentifier());
+}
+
+TEST_F(Generator_IdentifierGenerator, CreateIdentifiersOfStream)
+{
+    IdentifierGenerator generator{ 42, 7 };
+
+    EXPECT_THAT(generator.generateIdentifier(), testing::StartsWith("SIM-7-"));
+}
+
 TEST_F(Generator_IdentifierGenerator, CreateIdentifierConcurently)
 {
     using std::chrono::system_clock;
@@ -3,9 +3,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
+#include "middleware/mirror/market_state_mirror.hpp"
 #include "mocks/trading_request_channel.hpp"
 
 using namespace Simulator;
@@ -17,6 +19,7 @@ using ::testing::Eq;
 using ::testing::Optional;
 using ::testing::Return;
 using ::testing::SaveArg;
+using ::testing::SetArgReferee;
 
 class Generator_OrderMarketDataProvider : public testing::Test {
  public:
@@ -27,11 +30,64 @@ class Generator_OrderMarketDataProvider : public testing::Test {
     simulator::middleware::bind_trading_request_channel(receiver_pointer);
   }
 
+  static auto make_descriptor(std::uint64_t listing_id)
+      -> simulator::InstrumentDescriptor {
+    simulator::InstrumentDescriptor descriptor;
+    descriptor.requester_instrument_id =
+        simulator::RequesterInstrumentId{listing_id};
+    return descriptor;
+  }
+
   Mock::TradingRequestReceiver request_receiver;
-  OrderMarketDataProvider market_data_provider;
+  OrderMarketDataProvider market_data_provider{make_descriptor(1001)};
 
  private:
   auto TearDown() -> void override {
     simulator::middleware::release_trading_request_channel();
   }
-};
\ No newline at end of file
+};
+
+// NOLINTBEGIN(*magic-numbers*)
+
+TEST_F(Generator_OrderMarketDataProvider,
+       RequestsMarketStateUntilMirrorIsPublished) {
+  bind_trading_request_channel();
+  simulator::protocol::InstrumentState reply;
+  reply.best_bid_price = simulator::BestBidPrice{10.};
+  reply.current_bid_depth = simulator::CurrentBidDepth{2};
+  reply.current_offer_depth = simulator::CurrentOfferDepth{0};
+  EXPECT_CALL(request_receiver,
+              process(A<const simulator::protocol::InstrumentStateRequest&>(),
+                      A<simulator::protocol::InstrumentState&>()))
+      .WillOnce(SetArgReferee<1>(reply));
+
+  const MarketState state = market_data_provider.getMarketState();
+
+  EXPECT_THAT(state.bestBidPrice, Optional(Eq(10.)));
+  EXPECT_EQ(state.bestOfferPrice, std::nullopt);
+  EXPECT_THAT(state.bidDepthLevels, Optional(Eq(2U)));
+  EXPECT_THAT(state.offerDepthLevels, Optional(Eq(0U)));
+}
+
+TEST_F(Generator_OrderMarketDataProvider, ReadsMirroredMarketState) {
+  bind_trading_request_channel();
+  EXPECT_CALL(request_receiver,
+              process(A<const simulator::protocol::InstrumentStateRequest&>(),
+                      A<simulator::protocol::InstrumentState&>()))
+      .Times(0);
+  const OrderMarketDataProvider provider{make_descriptor(1002)};
+  simulator::middleware::market_state_mirror(1002).publish(
+      {.best_bid_price = std::nullopt,
+       .best_offer_price = 11.5,
+       .bid_depth_levels = 0,
+       .offer_depth_levels = 4});
+
+  const MarketState state = provider.getMarketState();
+
+  EXPECT_EQ(state.bestBidPrice, std::nullopt);
+  EXPECT_THAT(state.bestOfferPrice, Optional(Eq(11.5)));
+  EXPECT_THAT(state.bidDepthLevels, Optional(Eq(0U)));
+  EXPECT_THAT(state.offerDepthLevels, Optional(Eq(4U)));
+}
+
+// NOLINTEND(*magic-numbers*)
\ No newline at end of file
@@ -1,4 +1,6 @@
+#include <memory>
 #include <string>
+#include <utility>
 
 #include <csv.hpp>
 #include <gmock/gmock.h>
@@ -46,10 +48,11 @@ class Generator_Historical_CsvReader : public testing::Test {
     }
 
     static auto parseCsv(std::string_view _content, CsvParsingParams _params)
-        -> csv::CSVReader
+        -> std::unique_ptr<csv::CSVReader>
     {
         csv::CSVFormat const csvFormat = CsvReader::makeFormat(_params);
-        return csv::parse(_content, csvFormat);
+        return std::make_unique<csv::CSVReader>(
+            csv::parse(_content, csvFormat));
     }
 };
 
@@ -86,9 +89,9 @@ TEST_F(Generator_Historical_CsvReader, ThrowsExceptionWhenCSVIsEmpty)
 
     MappingParams const mappingParams = makeDefaultMapping(0);
     CsvParsingParams const parsingParams = makeParsingParams(0, 1, ',');
-    csv::CSVReader csv = parseCsv(csvContent, parsingParams);
+    auto csv = parseCsv(csvContent, parsingParams);
 
-    ASSERT_THROW(Historical::CsvReader reader(parsingParams, mappingParams, csv), std::invalid_argument);
+    ASSERT_THROW(Historical::CsvReader reader(parsingParams, mappingParams, std::move(csv)), std::invalid_argument);
 }
 
 TEST_F(Generator_Historical_CsvReader, ReadCsv_WithHeader)
@@ -102,10 +105,10 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithHeader)
 
     MappingParams const mappingParams = makeDefaultMapping(1);
     CsvParsingParams const parsingParams = makeParsingParams(1, 2, ',');
-    csv::CSVReader csv = parseCsv(csvContent, parsingParams);
+    auto csv = parseCsv(csvContent, parsingParams);
 
     EXPECT_THAT(
-        csv.get_col_names(),
+        csv->get_col_names(),
         ElementsAre(
             "REC_TIME",
             "MSG_TIME",
@@ -122,7 +125,7 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithHeader)
     MockFunction<void(Record)> record_visitor;
     EXPECT_CALL(record_visitor, Call).Times(2);
 
-    Historical::CsvReader reader{parsingParams, mappingParams, csv};
+    Historical::CsvReader reader{parsingParams, mappingParams, std::move(csv)};
     reader.accept(record_visitor.AsStdFunction());
 }
 
@@ -138,10 +141,10 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithCommentedHeader)
 
     MappingParams const mappingParams = makeDefaultMapping(2);
     CsvParsingParams const parsingParams = makeParsingParams(2, 3);
-    csv::CSVReader csv = parseCsv(csvContent, parsingParams);
+    auto csv = parseCsv(csvContent, parsingParams);
 
     EXPECT_THAT(
-        csv.get_col_names(),
+        csv->get_col_names(),
         ElementsAre(
             "REC_TIME",
             "MSG_TIME",
@@ -158,7 +161,7 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithCommentedHeader)
     MockFunction<void(Record)> record_visitor;
     EXPECT_CALL(record_visitor, Call).Times(2);
 
-    Historical::CsvReader reader{parsingParams, mappingParams, csv};
+    Historical::CsvReader reader{parsingParams, mappingParams, std::move(csv)};
     reader.accept(record_visitor.AsStdFunction());
 }
 
@@ -174,10 +177,10 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithMultiHeader)
 
     MappingParams const mappingParams = makeDefaultMapping(2);
     CsvParsingParams const parsingParams = makeParsingParams(2, 3);
-    csv::CSVReader csv = parseCsv(csvContent, parsingParams);
+    auto csv = parseCsv(csvContent, parsingParams);
 
     EXPECT_THAT(
-        csv.get_col_names(),
+        csv->get_col_names(),
         ElementsAre(
             "REC_TIME",
             "MSG_TIME",
@@ -194,7 +197,7 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithMultiHeader)
     MockFunction<void(Record)> record_visitor;
     EXPECT_CALL(record_visitor, Call).Times(2);
 
-    Historical::CsvReader reader{parsingParams, mappingParams, csv};
+    Historical::CsvReader reader{parsingParams, mappingParams, std::move(csv)};
     reader.accept(record_visitor.AsStdFunction());
 }
 
@@ -209,12 +212,12 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_WithoutHeader)
 
     MappingParams const mappingParams = makeDefaultMapping(0);
     CsvParsingParams const parsingParams = makeParsingParams(0, 1, ',');
-    csv::CSVReader csv = parseCsv(csvContent, parsingParams);
+    auto csv = parseCsv(csvContent, parsingParams);
 
     MockFunction<void(Record)> record_visitor;
     EXPECT_CALL(record_visitor, Call).Times(3);
 
-    Historical::CsvReader reader{parsingParams, mappingParams, csv};
+    Historical::CsvReader reader{parsingParams, mappingParams, std::move(csv)};
     reader.accept(record_visitor.AsStdFunction());
 }
 
@@ -230,15 +233,56 @@ TEST_F(Generator_Historical_CsvReader, ReadCsv_FromSpecificRow)
 
     MappingParams const mappingParams = makeDefaultMapping(1);
     CsvParsingParams const parsingParams = makeParsingParams(1, 3, ',');
-    csv::CSVReader csv = parseCsv(csvContent, parsingParams);
+    auto csv = parseCsv(csvContent, parsingParams);
 
     MockFunction<void(Record)> record_visitor;
     EXPECT_CALL(record_visitor, Call).Times(2);
 
-    Historical::CsvReader reader{parsingParams, mappingParams, csv};
+    Historical::CsvReader reader{parsingParams, mappingParams, std::move(csv)};
     reader.accept(record_visitor.AsStdFunction());
 }
 
+TEST_F(Generator_Historical_CsvReader, ReadCsv_MoreRowsThanReadAheadCapacity)
+{
+    // clang-format off
+    constexpr std::string_view csvContent =
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP1,12,120,220,22,AP1\r\n"
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP2,32,320,420,42,AP2\r\n"
+        "malformed,row\r\n"
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP3,52,520,620,62,AP3\r\n"
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP4,72,720,820,82,AP4\r\n";
+    // clang-format on
+
+    MappingParams const mappingParams = makeDefaultMapping(0);
+    CsvParsingParams const parsingParams = makeParsingParams(0, 1, ',');
+    auto csv = parseCsv(csvContent, parsingParams);
+
+    MockFunction<void(Record)> record_visitor;
+    EXPECT_CALL(record_visitor, Call).Times(4);
+
+    Historical::CsvReader reader{parsingParams, mappingParams, std::move(csv), 1};
+    reader.accept(record_visitor.AsStdFunction());
+}
+
+TEST_F(Generator_Historical_CsvReader, StopsReadingWhenDestroyedBeforeAllRowsAreConsumed)
+{
+    // clang-format off
+    constexpr std::string_view csvContent =
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP1,12,120,220,22,AP1\r\n"
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP2,32,320,420,42,AP2\r\n"
+        "2023-01-20 12:00:32.345,2023-01-20 12:00:33.006,AUD/CAD,BP3,52,520,620,62,AP3\r\n";
+    // clang-format on
+
+    MappingParams const mappingParams = makeDefaultMapping(0);
+    CsvParsingParams const parsingParams = makeParsingParams(0, 1, ',');
+    auto csv = parseCsv(csvContent, parsingParams);
+
+    auto reader = std::make_unique<Historical::CsvReader>(
+        parsingParams, mappingParams, std::move(csv), 1);
+
+    EXPECT_NO_THROW(reader.reset());
+}
+
 TEST_F(Generator_Historical_CsvReader, ReadCsv_FromNonexistentFile)
 {
     EXPECT_THROW(
@@ -255,9 +299,9 @@ TEST_F(Generator_Historical_CsvReader, ParsesOneLevelIfHeaderIsNotPresent) {
 
   const MappingParams mapping_params = makeDefaultMapping(0);
   const CsvParsingParams parsing_params = makeParsingParams(0, 1, ',');
-  csv::CSVReader csv = parseCsv(csv_content, parsing_params);
+  auto csv = parseCsv(csv_content, parsing_params);
 
-  Historical::CsvReader reader{parsing_params, mapping_params, csv};
+  Historical::CsvReader reader{parsing_params, mapping_params, std::move(csv)};
 
   MockFunction<void(std::uint64_t, Level const&)> level_visitor;
   EXPECT_CALL(level_visitor, Call).Times(1);
@@ -276,9 +320,9 @@ TEST_F(Generator_Historical_CsvReader, ParsesOneLevelIfHeaderIsPresent) {
 
   const MappingParams mapping_params = makeDefaultMapping(1);
   const CsvParsingParams parsing_params = makeParsingParams(1, 2, ',');
-  csv::CSVReader csv = parseCsv(csv_content, parsing_params);
+  auto csv = parseCsv(csv_content, parsing_params);
 
-  Historical::CsvReader reader{parsing_params, mapping_params, csv};
+  Historical::CsvReader reader{parsing_params, mapping_params, std::move(csv)};
 
   MockFunction<void(std::uint64_t, Level const&)> level_visitor;
   EXPECT_CALL(level_visitor, Call).Times(1);
@@ -297,9 +341,9 @@ TEST_F(Generator_Historical_CsvReader,
 
   const MappingParams mapping_params = makeDefaultMapping(0);
   const CsvParsingParams parsing_params = makeParsingParams(0, 1, ',');
-  csv::CSVReader csv = parseCsv(csv_content, parsing_params);
+  auto csv = parseCsv(csv_content, parsing_params);
 
-  Historical::CsvReader reader{parsing_params, mapping_params, csv};
+  Historical::CsvReader reader{parsing_params, mapping_params, std::move(csv)};
 
   MockFunction<void(std::uint64_t, Level const&)> level_visitor;
   EXPECT_CALL(level_visitor, Call).Times(2);
@@ -319,9 +363,9 @@ TEST_F(Generator_Historical_CsvReader,
 
   const MappingParams mapping_params = makeDefaultMapping(1);
   const CsvParsingParams parsing_params = makeParsingParams(1, 2, ',');
-  csv::CSVReader csv = parseCsv(csv_content, parsing_params);
+  auto csv = parseCsv(csv_content, parsing_params);
 
-  Historical::CsvReader reader{parsing_params, mapping_params, csv};
+  Historical::CsvReader reader{parsing_params, mapping_params, std::move(csv)};
 
   MockFunction<void(std::uint64_t, Level const&)> level_visitor;
   EXPECT_CALL(level_visitor, Call).Times(2);
@@ -341,9 +385,9 @@ TEST_F(Generator_Historical_CsvReader,
 
   const MappingParams mapping_params = makeDefaultMapping(1);
   const CsvParsingParams parsing_params = makeParsingParams(1, 2, ',');
-  csv::CSVReader csv = parseCsv(csv_content, parsing_params);
+  auto csv = parseCsv(csv_content, parsing_params);
 
-  Historical::CsvReader reader{parsing_params, mapping_params, csv};
+  Historical::CsvReader reader{parsing_params, mapping_params, std::move(csv)};
 
   MockFunction<void(std::uint64_t, Level const&)> level_visitor;
   EXPECT_CALL(level_visitor, Call).Times(2);
@@ -103,3 +103,28 @@ TEST(Generator_Historical_DataAccessAdapter, Accept_ValidRecord)
 
     EXPECT_NO_THROW(adapter.accept(visitor));
 }
+
+TEST(Generator_Historical_DataAccessAdapter, Accept_DataSourceReadError)
+{
+    Mock::DataAccessAdapter adapter{};
+    EXPECT_CALL(adapter, hasNextRecord).WillRepeatedly(Return(true));
+    EXPECT_CALL(adapter, parseNextRecord)
+        .Times(2)
+        .WillOnce(CreateValidRecord())
+        .WillOnce(Throw(DataSourceReadError{"read error"}));
+
+    NoopRecordVisitor visitor{};
+    EXPECT_CALL(visitor, accept).Times(1);
+
+    EXPECT_THROW(adapter.accept(visitor), DataSourceReadError);
+}
+
+TEST(Generator_Historical_DataAccessAdapter, Next_DataSourceReadError)
+{
+    Mock::DataAccessAdapter adapter{};
+    EXPECT_CALL(adapter, hasNextRecord).WillOnce(Return(true));
+    EXPECT_CALL(adapter, parseNextRecord)
+        .WillOnce(Throw(DataSourceReadError{"read error"}));
+
+    EXPECT_THROW((void)adapter.next(), DataSourceReadError);
+}
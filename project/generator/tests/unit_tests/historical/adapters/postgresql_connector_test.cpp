@@ -0,0 +1,83 @@
+#include <optional>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ih/historical/adapters/postgresql_connector.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+using namespace ::testing;
+
+TEST(Generator_Historical_PostgresConnector, MakeCursorQuery_WithoutTimeColumn)
+{
+    std::string const query = PostgresConnector::makeCursorQuery(
+        "records", std::nullopt, std::nullopt, std::nullopt);
+
+    EXPECT_EQ(query, "SELECT * FROM records");
+}
+
+TEST(Generator_Historical_PostgresConnector, MakeCursorQuery_UnboundedPartition)
+{
+    std::string const query = PostgresConnector::makeCursorQuery(
+        "records", R"("time")", std::nullopt, std::nullopt);
+
+    EXPECT_EQ(query, R"(SELECT * FROM records ORDER BY "time")");
+}
+
+TEST(Generator_Historical_PostgresConnector, MakeCursorQuery_FirstPartition)
+{
+    std::string const query = PostgresConnector::makeCursorQuery(
+        "records", R"("time")", std::nullopt, "'2023-06-13'");
+
+    EXPECT_EQ(
+        query,
+        R"(SELECT * FROM records WHERE "time" < '2023-06-13' ORDER BY "time")");
+}
+
+TEST(Generator_Historical_PostgresConnector, MakeCursorQuery_LastPartition)
+{
+    std::string const query = PostgresConnector::makeCursorQuery(
+        "records", R"("time")", "'2023-06-13'", std::nullopt);
+
+    EXPECT_EQ(
+        query,
+        R"(SELECT * FROM records WHERE "time" >= '2023-06-13' ORDER BY "time")");
+}
+
+TEST(Generator_Historical_PostgresConnector, MakeCursorQuery_BoundedPartition)
+{
+    std::string const query = PostgresConnector::makeCursorQuery(
+        "records", R"("time")", "'2023-06-13'", "'2023-06-14'");
+
+    EXPECT_EQ(query,
+              R"(SELECT * FROM records WHERE "time" >= '2023-06-13' AND )"
+              R"("time" < '2023-06-14' ORDER BY "time")");
+}
+
+TEST(Generator_Historical_PostgresConnector,
+     MakePartitionBoundsQuery_SelectsPercentiles)
+{
+    std::string const query =
+        PostgresConnector::makePartitionBoundsQuery("records", R"("time")", 4);
+
+    EXPECT_THAT(query, HasSubstr(R"(percentile_disc(0.25) WITHIN GROUP )"
+                                 R"((ORDER BY "time")::text)"));
+    EXPECT_THAT(query, HasSubstr("percentile_disc(0.5)"));
+    EXPECT_THAT(query, HasSubstr("percentile_disc(0.75)"));
+    EXPECT_THAT(query, Not(HasSubstr("percentile_disc(1)")));
+}
+
+TEST(Generator_Historical_PostgresConnector,
+     MakePartitionBoundsQuery_SamplesTable)
+{
+    std::string const query =
+        PostgresConnector::makePartitionBoundsQuery("records", R"("time")", 2);
+
+    EXPECT_THAT(query, HasSubstr("FROM records TABLESAMPLE SYSTEM (1)"));
+}
+
+} // namespace
+} // namespace Simulator::Generator::Historical
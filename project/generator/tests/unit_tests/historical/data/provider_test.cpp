@@ -1,8 +1,12 @@
 #include <chrono>
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -78,12 +82,52 @@ class Generator_Historical_DataProvider : public testing::Test {
     }
 };
 
-class Generator_Historical_FiniteProvider
-    : public Generator_Historical_DataProvider {};
-
 class Generator_Historical_RepeatingProvider
     : public Generator_Historical_DataProvider {};
 
+class Generator_Historical_StreamingProvider
+    : public Generator_Historical_DataProvider {
+  public:
+    static auto makeStreamingProvider(Fake::DataAccessAdapter _adapter)
+        -> StreamingProvider
+    {
+        return StreamingProvider{
+            std::make_unique<Fake::DataAccessAdapter>(std::move(_adapter))};
+    }
+};
+
+class Generator_Historical_MergingProvider
+    : public Generator_Historical_DataProvider {
+  public:
+    static auto makeAdapters(std::vector<Fake::DataAccessAdapter> _adapters)
+        -> MergingProvider::Adapters
+    {
+        MergingProvider::Adapters adapters;
+        for (auto& adapter : _adapters) {
+            adapters.push_back(
+                std::make_unique<Fake::DataAccessAdapter>(std::move(adapter)));
+        }
+        return adapters;
+    }
+
+    static auto collectInstruments(MergingProvider& _provider)
+        -> std::vector<std::vector<std::string>>
+    {
+        std::vector<std::vector<std::string>> actions;
+        auto const puller = [&](Historical::Action const& _action) {
+            auto& instruments = actions.emplace_back();
+            _action.visit_records([&](Historical::Record const& _record) {
+                instruments.push_back(_record.instrument());
+            });
+        };
+
+        while (!_provider.isEmpty()) {
+            _provider.pullAction(puller);
+        }
+        return actions;
+    }
+};
+
 ACTION_P(ConstructActionWith, HistoricalRecord)
 {
     constexpr auto timeOffset = Historical::Duration{100};
@@ -184,9 +228,9 @@ TEST_F(Generator_Historical_DataProvider, PullAction_Multiple)
     EXPECT_NO_THROW(provider.pullAction([]([[maybe_unused]] auto _action) {}));
 }
 
-TEST_F(Generator_Historical_FiniteProvider, TimeOffset_InitializeWhenEmpty)
+TEST_F(Generator_Historical_RepeatingProvider, TimeOffset_InitializeWhenEmpty)
 {
-    FiniteProvider provider{};
+    RepeatingProvider provider{};
     ASSERT_TRUE(provider.isEmpty());
 
     EXPECT_FALSE(provider.hasTimeOffset());
@@ -194,7 +238,7 @@ TEST_F(Generator_Historical_FiniteProvider, TimeOffset_InitializeWhenEmpty)
     EXPECT_FALSE(provider.hasTimeOffset());
 }
 
-TEST_F(Generator_Historical_FiniteProvider, TimeOffset_InitializeWhenFilled)
+TEST_F(Generator_Historical_RepeatingProvider, TimeOffset_InitializeWhenFilled)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint recordTime = make_time(1686661852000000000);
@@ -202,7 +246,7 @@ TEST_F(Generator_Historical_FiniteProvider, TimeOffset_InitializeWhenFilled)
     Fake::DataAccessAdapter adapter =
         makeFakeDataAdapter({RecordAttributes{recordTime, "AAPL", 1}});
 
-    FiniteProvider provider{};
+    RepeatingProvider provider{};
     provider.prepare(adapter);
     ASSERT_FALSE(provider.isEmpty());
 
@@ -211,17 +255,7 @@ TEST_F(Generator_Historical_FiniteProvider, TimeOffset_InitializeWhenFilled)
     EXPECT_TRUE(provider.hasTimeOffset());
 }
 
-TEST_F(Generator_Historical_FiniteProvider, Pull_Empty)
-{
-    auto const puller = []([[maybe_unused]] auto const& _action) {};
-
-    FiniteProvider provider{};
-    ASSERT_TRUE(provider.isEmpty());
-
-    EXPECT_THROW(provider.pullAction(puller), std::logic_error);
-}
-
-TEST_F(Generator_Historical_FiniteProvider, Pull_SingleAction)
+TEST_F(Generator_Historical_RepeatingProvider, Pull_SingleAction)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint firstRecTime =
@@ -237,7 +271,7 @@ TEST_F(Generator_Historical_FiniteProvider, Pull_SingleAction)
 
     auto const puller = []([[maybe_unused]] auto const& _action) {};
 
-    FiniteProvider provider{};
+    RepeatingProvider provider{};
     provider.prepare(adapter);
     ASSERT_FALSE(provider.isEmpty());
 
@@ -247,7 +281,7 @@ TEST_F(Generator_Historical_FiniteProvider, Pull_SingleAction)
     EXPECT_TRUE(provider.hasTimeOffset());
 }
 
-TEST_F(Generator_Historical_FiniteProvider, Pull_AllActions)
+TEST_F(Generator_Historical_RepeatingProvider, Pull_MultipleActions)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint firstRecTime =
@@ -263,18 +297,43 @@ TEST_F(Generator_Historical_FiniteProvider, Pull_AllActions)
 
     auto const puller = []([[maybe_unused]] auto const& _action) {};
 
-    FiniteProvider provider{};
+    RepeatingProvider provider{};
     provider.prepare(adapter);
     ASSERT_FALSE(provider.isEmpty());
 
+    // 1st action
+    EXPECT_FALSE(provider.hasTimeOffset());
     EXPECT_NO_THROW(provider.pullAction(puller));
     EXPECT_FALSE(provider.isEmpty());
+    EXPECT_TRUE(provider.hasTimeOffset());
 
+    // 2nd action
+    ASSERT_FALSE(provider.isEmpty());
     EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_TRUE(provider.isEmpty());
+    EXPECT_FALSE(provider.isEmpty());
+
+    Historical::Duration const firstTimeOffset = provider.getTimeOffset();
+
+    // Suspend test for 1 historical time point to catch the difference
+    // in first and second time offsets
+    std::this_thread::sleep_for(Historical::Duration{1});
+
+    // 3d action (copy of 1st one)
+    EXPECT_NO_THROW(provider.pullAction(puller));
+    EXPECT_FALSE(provider.isEmpty());
+    EXPECT_TRUE(provider.hasTimeOffset());
+
+    // 4th action (copy of 2nd one)
+    ASSERT_FALSE(provider.isEmpty());
+    EXPECT_NO_THROW(provider.pullAction(puller));
+    EXPECT_FALSE(provider.isEmpty());
+
+    Historical::Duration const secondTimeOffset = provider.getTimeOffset();
+
+    EXPECT_TRUE(secondTimeOffset != firstTimeOffset);
 }
 
-TEST_F(Generator_Historical_FiniteProvider, Pull_MergeRecords)
+TEST_F(Generator_Historical_RepeatingProvider, Pull_MergeRecords)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint recordsTime = make_time(1686661852000000000);
@@ -294,17 +353,17 @@ TEST_F(Generator_Historical_FiniteProvider, Pull_MergeRecords)
         EXPECT_EQ(numRecords, 2);
     };
 
-    FiniteProvider provider{};
+    RepeatingProvider provider{};
     provider.prepare(adapter);
     ASSERT_FALSE(provider.isEmpty());
 
     EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_TRUE(provider.isEmpty());
+    EXPECT_FALSE(provider.isEmpty());
 }
 
-TEST_F(Generator_Historical_RepeatingProvider, TimeOffset_InitializeWhenEmpty)
+TEST_F(Generator_Historical_StreamingProvider, TimeOffset_InitializeWhenEmpty)
 {
-    RepeatingProvider provider{};
+    StreamingProvider provider = makeStreamingProvider(makeFakeDataAdapter(0));
     ASSERT_TRUE(provider.isEmpty());
 
     EXPECT_FALSE(provider.hasTimeOffset());
@@ -312,16 +371,13 @@ TEST_F(Generator_Historical_RepeatingProvider, TimeOffset_InitializeWhenEmpty)
     EXPECT_FALSE(provider.hasTimeOffset());
 }
 
-TEST_F(Generator_Historical_RepeatingProvider, TimeOffset_InitializeWhenFilled)
+TEST_F(Generator_Historical_StreamingProvider, TimeOffset_InitializeWhenFilled)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint recordTime = make_time(1686661852000000000);
 
-    Fake::DataAccessAdapter adapter =
-        makeFakeDataAdapter({RecordAttributes{recordTime, "AAPL", 1}});
-
-    RepeatingProvider provider{};
-    provider.prepare(adapter);
+    StreamingProvider provider = makeStreamingProvider(
+        makeFakeDataAdapter({RecordAttributes{recordTime, "AAPL", 1}}));
     ASSERT_FALSE(provider.isEmpty());
 
     EXPECT_FALSE(provider.hasTimeOffset());
@@ -329,33 +385,17 @@ TEST_F(Generator_Historical_RepeatingProvider, TimeOffset_InitializeWhenFilled)
     EXPECT_TRUE(provider.hasTimeOffset());
 }
 
-TEST_F(Generator_Historical_RepeatingProvider, Pull_SingleAction)
+TEST_F(Generator_Historical_StreamingProvider, Pull_Empty)
 {
-    // 2023-06-13 13:10:52 GMT
-    constexpr Historical::Timepoint firstRecTime =
-        make_time(1686661852000000000);
-    // 2023-06-13 13:10:53 GMT
-    constexpr Historical::Timepoint secondRecTime =
-        make_time(1686661853000000000);
-
-    Fake::DataAccessAdapter adapter = makeFakeDataAdapter(
-        {RecordAttributes(firstRecTime, "AAPL", 1),
-         RecordAttributes(secondRecTime, "TSLA", 2)}
-    );
-
     auto const puller = []([[maybe_unused]] auto const& _action) {};
 
-    RepeatingProvider provider{};
-    provider.prepare(adapter);
-    ASSERT_FALSE(provider.isEmpty());
+    StreamingProvider provider = makeStreamingProvider(makeFakeDataAdapter(0));
+    ASSERT_TRUE(provider.isEmpty());
 
-    EXPECT_FALSE(provider.hasTimeOffset());
-    EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_FALSE(provider.isEmpty());
-    EXPECT_TRUE(provider.hasTimeOffset());
+    EXPECT_THROW(provider.pullAction(puller), std::logic_error);
 }
 
-TEST_F(Generator_Historical_RepeatingProvider, Pull_MultipleActions)
+TEST_F(Generator_Historical_StreamingProvider, Pull_AllActions)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint firstRecTime =
@@ -364,58 +404,38 @@ TEST_F(Generator_Historical_RepeatingProvider, Pull_MultipleActions)
     constexpr Historical::Timepoint secondRecTime =
         make_time(1686661853000000000);
 
-    Fake::DataAccessAdapter adapter = makeFakeDataAdapter(
+    StreamingProvider provider = makeStreamingProvider(makeFakeDataAdapter(
         {RecordAttributes(firstRecTime, "AAPL", 1),
          RecordAttributes(secondRecTime, "TSLA", 2)}
-    );
-
-    auto const puller = []([[maybe_unused]] auto const& _action) {};
-
-    RepeatingProvider provider{};
-    provider.prepare(adapter);
-    ASSERT_FALSE(provider.isEmpty());
-
-    // 1st action
-    EXPECT_FALSE(provider.hasTimeOffset());
-    EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_FALSE(provider.isEmpty());
-    EXPECT_TRUE(provider.hasTimeOffset());
-
-    // 2nd action
+    ));
     ASSERT_FALSE(provider.isEmpty());
-    EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_FALSE(provider.isEmpty());
-
-    Historical::Duration const firstTimeOffset = provider.getTimeOffset();
 
-    // Suspend test for 1 historical time point to catch the difference
-    // in first and second time offsets
-    std::this_thread::sleep_for(Historical::Duration{1});
+    std::vector<std::string> instruments;
+    auto const puller = [&](Historical::Action const& _action) {
+        _action.visit_records([&](Historical::Record const& _record) {
+            instruments.push_back(_record.instrument());
+        });
+    };
 
-    // 3d action (copy of 1st one)
     EXPECT_NO_THROW(provider.pullAction(puller));
     EXPECT_FALSE(provider.isEmpty());
     EXPECT_TRUE(provider.hasTimeOffset());
 
-    // 4th action (copy of 2nd one)
-    ASSERT_FALSE(provider.isEmpty());
     EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_FALSE(provider.isEmpty());
-
-    Historical::Duration const secondTimeOffset = provider.getTimeOffset();
+    EXPECT_TRUE(provider.isEmpty());
 
-    EXPECT_TRUE(secondTimeOffset != firstTimeOffset);
+    EXPECT_THAT(instruments, ::testing::ElementsAre("AAPL", "TSLA"));
 }
 
-TEST_F(Generator_Historical_RepeatingProvider, Pull_MergeRecords)
+TEST_F(Generator_Historical_StreamingProvider, Pull_MergeRecords)
 {
     // 2023-06-13 13:10:52 GMT
     constexpr Historical::Timepoint recordsTime = make_time(1686661852000000000);
 
-    Fake::DataAccessAdapter adapter = makeFakeDataAdapter(
+    StreamingProvider provider = makeStreamingProvider(makeFakeDataAdapter(
         {RecordAttributes(recordsTime, "AAPL", 1),
          RecordAttributes(recordsTime, "TSLA", 2)}
-    );
+    ));
 
     auto const puller = [&](Historical::Action const& _action) {
         std::size_t numRecords = 0;
@@ -427,13 +447,123 @@ TEST_F(Generator_Historical_RepeatingProvider, Pull_MergeRecords)
         EXPECT_EQ(numRecords, 2);
     };
 
-    RepeatingProvider provider{};
-    provider.prepare(adapter);
+    EXPECT_NO_THROW(provider.pullAction(puller));
+    EXPECT_TRUE(provider.isEmpty());
+}
+
+TEST_F(Generator_Historical_StreamingProvider, Pull_DataSourceReadError)
+{
+    // 2023-06-13 13:10:52 GMT
+    constexpr Historical::Timepoint recordTime = make_time(1686661852000000000);
+
+    Fake::DataAccessAdapter adapter =
+        makeFakeDataAdapter({RecordAttributes(recordTime, "AAPL", 1)});
+    adapter.failReadingAfterRecords();
+    StreamingProvider provider = makeStreamingProvider(std::move(adapter));
+    ASSERT_FALSE(provider.isEmpty());
+
+    auto const puller = []([[maybe_unused]] auto const& _action) {};
+    EXPECT_THROW(provider.pullAction(puller), DataSourceReadError);
+    EXPECT_TRUE(provider.isEmpty());
+}
+
+TEST_F(Generator_Historical_MergingProvider, Pull_Empty)
+{
+    auto const puller = []([[maybe_unused]] auto const& _action) {};
+
+    std::vector<Fake::DataAccessAdapter> adapters;
+    adapters.push_back(makeFakeDataAdapter(0));
+    adapters.push_back(makeFakeDataAdapter(0));
+    MergingProvider provider{makeAdapters(std::move(adapters))};
+    ASSERT_TRUE(provider.isEmpty());
+
+    provider.initializeTimeOffset();
+    EXPECT_FALSE(provider.hasTimeOffset());
+    EXPECT_THROW(provider.pullAction(puller), std::logic_error);
+}
+
+TEST_F(Generator_Historical_MergingProvider, Pull_MergesByReceiveTime)
+{
+    // 2023-06-13 13:10:52 GMT
+    constexpr Historical::Timepoint firstRecTime =
+        make_time(1686661852000000000);
+    constexpr Historical::Timepoint secondRecTime =
+        firstRecTime + std::chrono::seconds{1};
+    constexpr Historical::Timepoint thirdRecTime =
+        firstRecTime + std::chrono::seconds{2};
+
+    std::vector<Fake::DataAccessAdapter> adapters;
+    adapters.push_back(makeFakeDataAdapter(
+        {RecordAttributes(secondRecTime, "TSLA", 1)}
+    ));
+    adapters.push_back(makeFakeDataAdapter(
+        {RecordAttributes(firstRecTime, "AAPL", 1),
+         RecordAttributes(thirdRecTime, "MSFT", 2)}
+    ));
+    MergingProvider provider{makeAdapters(std::move(adapters))};
+
+    EXPECT_THAT(
+        collectInstruments(provider),
+        ::testing::ElementsAre(
+            ::testing::ElementsAre("AAPL"),
+            ::testing::ElementsAre("TSLA"),
+            ::testing::ElementsAre("MSFT")
+        )
+    );
+}
+
+TEST_F(Generator_Historical_MergingProvider, Pull_MergeRecordsOfSources)
+{
+    // 2023-06-13 13:10:52 GMT
+    constexpr Historical::Timepoint recordsTime = make_time(1686661852000000000);
+
+    std::vector<Fake::DataAccessAdapter> adapters;
+    adapters.push_back(makeFakeDataAdapter(
+        {RecordAttributes(recordsTime, "AAPL", 1)}
+    ));
+    adapters.push_back(makeFakeDataAdapter(
+        {RecordAttributes(recordsTime, "TSLA", 1)}
+    ));
+    MergingProvider provider{makeAdapters(std::move(adapters))};
+
+    EXPECT_THAT(
+        collectInstruments(provider),
+        ::testing::ElementsAre(::testing::ElementsAre("AAPL", "TSLA"))
+    );
+}
+
+TEST_F(Generator_Historical_MergingProvider, Pull_DataSourceReadError)
+{
+    // 2023-06-13 13:10:52 GMT
+    constexpr Historical::Timepoint firstRecTime =
+        make_time(1686661852000000000);
+    constexpr Historical::Timepoint secondRecTime =
+        firstRecTime + std::chrono::seconds{1};
+
+    std::vector<Fake::DataAccessAdapter> adapters;
+    adapters.push_back(makeFakeDataAdapter(
+        {RecordAttributes(firstRecTime, "AAPL", 1)}
+    ));
+    adapters.back().failReadingAfterRecords();
+    adapters.push_back(makeFakeDataAdapter(
+        {RecordAttributes(secondRecTime, "TSLA", 1)}
+    ));
+    MergingProvider provider{makeAdapters(std::move(adapters))};
+
+    std::vector<std::string> instruments;
+    auto const puller = [&](Historical::Action const& _action) {
+        _action.visit_records([&](Historical::Record const& _record) {
+            instruments.push_back(_record.instrument());
+        });
+    };
+
+    EXPECT_THROW(provider.pullAction(puller), DataSourceReadError);
     ASSERT_FALSE(provider.isEmpty());
 
     EXPECT_NO_THROW(provider.pullAction(puller));
-    EXPECT_FALSE(provider.isEmpty());
+    EXPECT_TRUE(provider.isEmpty());
+    EXPECT_THAT(instruments, ::testing::ElementsAre("TSLA"));
 }
 
 } // namespace
-} // namespace Simulator::Generator::Historical
\ No newline at end of file
+} // namespace Simulator::Generator::Historical
@@ -0,0 +1,173 @@
+#include "ih/historical/data/record_store.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/data/time.hpp"
+#include "tests/test_utils/historical_data_utils.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+using namespace ::testing;
+
+// NOLINTBEGIN(*magic-numbers*)
+
+struct GeneratorHistoricalRecordStore : public Test {
+  // 2023-06-13 13:10:52 GMT
+  static constexpr Historical::Timepoint ReceiveTime{
+      make_time(1686661852000000000)};
+  // 2023-06-13 13:10:53 GMT
+  static constexpr Historical::Timepoint MessageTime{
+      make_time(1686661853000000000)};
+
+  static auto make_record(std::string instrument,
+                          std::uint64_t source_row,
+                          std::vector<Level> levels) -> Record {
+    Record::Builder builder;
+    builder.with_instrument(std::move(instrument))
+        .with_receive_time(ReceiveTime)
+        .with_source_row(source_row)
+        .with_source_name("source-name")
+        .with_source_connection("/path/to/file.csv");
+    for (std::uint64_t index = 0; index < levels.size(); ++index) {
+      builder.add_level(index, std::move(levels[index]));
+    }
+    return Record::Builder::construct(std::move(builder));
+  }
+
+  static auto collect_levels(const Record& record) -> std::vector<Level> {
+    std::vector<Level> levels;
+    record.visit_levels(
+        [&](std::uint64_t, const Level& level) { levels.push_back(level); });
+    return levels;
+  }
+
+  std::shared_ptr<RecordStore> store = RecordStore::create();
+};
+
+TEST_F(GeneratorHistoricalRecordStore, IsEmptyWhenCreated) {
+  ASSERT_TRUE(store->empty());
+  ASSERT_EQ(store->size(), 0);
+}
+
+TEST_F(GeneratorHistoricalRecordStore, StoresRecordAttributes) {
+  Record::Builder builder;
+  builder.with_instrument("AAPL")
+      .with_receive_time(ReceiveTime)
+      .with_message_time(MessageTime)
+      .with_source_row(42)
+      .with_source_name("source-name")
+      .with_source_connection("/path/to/file.csv");
+  store->add(Record::Builder::construct(std::move(builder)));
+
+  const Record record = store->record(0);
+
+  EXPECT_EQ(record.instrument(), "AAPL");
+  EXPECT_EQ(record.receive_time(), ReceiveTime);
+  EXPECT_THAT(record.message_time(), Optional(Eq(MessageTime)));
+  EXPECT_EQ(record.source_row(), 42);
+  EXPECT_THAT(record.source_name(), Optional(Eq("source-name")));
+  EXPECT_THAT(record.source_connection(), Optional(Eq("/path/to/file.csv")));
+  EXPECT_FALSE(record.has_levels());
+}
+
+TEST_F(GeneratorHistoricalRecordStore, StoresLevelsOfEachRecord) {
+  store->add(make_record(
+      "AAPL",
+      1,
+      {make_level(10.1, 100., "BP1", 10.2, 200., "OP1"),
+       make_level(10., 110., "BP2", 10.3, 210., "OP2")}));
+  store->add(
+      make_record("TSLA", 2, {make_level(20.1, 300., "BP1", 20.2, 400., "OP1")}));
+  store->shrink_to_fit();
+
+  EXPECT_THAT(collect_levels(store->record(0)),
+              ElementsAre(LevelEq("BP1", 100., 10.1, 10.2, 200., "OP1"),
+                          LevelEq("BP2", 110., 10., 10.3, 210., "OP2")));
+  EXPECT_THAT(collect_levels(store->record(1)),
+              ElementsAre(LevelEq("BP1", 300., 20.1, 20.2, 400., "OP1")));
+  EXPECT_EQ(store->record(1).instrument(), "TSLA");
+}
+
+TEST_F(GeneratorHistoricalRecordStore, KeepsAbsentLevelAttributesAbsent) {
+  store->add(make_record(
+      "AAPL",
+      1,
+      {make_level(10.1, 100., std::nullopt, std::nullopt, std::nullopt, "OP")}));
+
+  const auto levels = collect_levels(store->record(0));
+
+  ASSERT_EQ(levels.size(), 1);
+  EXPECT_THAT(levels[0].bid_price(), Optional(DoubleEq(10.1)));
+  EXPECT_THAT(levels[0].bid_quantity(), Optional(DoubleEq(100.)));
+  EXPECT_EQ(levels[0].bid_counterparty(), std::nullopt);
+  EXPECT_EQ(levels[0].offer_price(), std::nullopt);
+  EXPECT_EQ(levels[0].offer_quantity(), std::nullopt);
+  EXPECT_THAT(levels[0].offer_counterparty(), Optional(Eq("OP")));
+}
+
+TEST_F(GeneratorHistoricalRecordStore, ViewsStoredLevelAttributes) {
+  store->add(make_record(
+      "AAPL",
+      1,
+      {make_level(10.1, 100., "BP", std::nullopt, std::nullopt, std::nullopt)}));
+
+  const RecordStore::LevelView level = store->level_view(0, 0);
+
+  EXPECT_THAT(level.bid_price, Optional(DoubleEq(10.1)));
+  EXPECT_THAT(level.bid_quantity, Optional(DoubleEq(100.)));
+  ASSERT_NE(level.bid_counterparty, nullptr);
+  EXPECT_EQ(*level.bid_counterparty, "BP");
+  EXPECT_EQ(level.offer_price, std::nullopt);
+  EXPECT_EQ(level.offer_quantity, std::nullopt);
+  EXPECT_EQ(level.offer_counterparty, nullptr);
+}
+
+TEST_F(GeneratorHistoricalRecordStore, ViewsLevelsOfStoredRecordInPlace) {
+  store->add(make_record(
+      "AAPL", 1, {make_level(10.1, 100., "BP", 10.2, 200., "OP")}));
+  const Record record = store->record(0);
+
+  std::vector<LevelView> views;
+  record.visit_level_views(
+      [&](std::uint64_t, const LevelView& level) { views.push_back(level); });
+
+  ASSERT_THAT(views, SizeIs(1));
+  // Counterparties refer to the strings kept in the store.
+  EXPECT_EQ(views[0].bid_counterparty,
+            store->level_view(0, 0).bid_counterparty);
+  EXPECT_EQ(views[0].offer_counterparty,
+            store->level_view(0, 0).offer_counterparty);
+  EXPECT_THAT(views[0].offer_price, Optional(DoubleEq(10.2)));
+}
+
+TEST_F(GeneratorHistoricalRecordStore, KeepsStoredRecordWhenViewIsModified) {
+  store->add(make_record(
+      "AAPL", 1, {make_level(10.1, 100., "BP", 10.2, 200., "OP")}));
+
+  Record::Builder builder{store->record(0)};
+  builder.with_instrument("TSLA");
+  const Record modified = Record::Builder::construct(std::move(builder));
+
+  Record stolen = store->record(0);
+  stolen.steal_levels([](std::uint64_t, const Level&) {});
+
+  EXPECT_EQ(modified.instrument(), "TSLA");
+  EXPECT_TRUE(modified.has_levels());
+  EXPECT_FALSE(stolen.has_levels());
+  EXPECT_EQ(store->record(0).instrument(), "AAPL");
+  EXPECT_TRUE(store->record(0).has_levels());
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator::Historical
@@ -148,6 +148,32 @@ TEST_F(GeneratorHistoricalRecordBuilder, ConstructsFromAnotherRecord) {
   EXPECT_TRUE(copyRecord.has_levels());
 }
 
+TEST_F(GeneratorHistoricalRecordBuilder,
+       ModifiesOnlyRecordConstructedFromAnotherRecord) {
+  const auto level = make_level(120.1, 201.1, "BCP", 122.1, 202.1, "OCP");
+
+  set_mandatory_attributes(record_builder);
+  record_builder.add_level(0, level);
+  const Record initialRecord =
+      Record::Builder::construct(std::move(record_builder));
+
+  Historical::Record::Builder copyBuilder{initialRecord};
+  copyBuilder.with_instrument("TSLA").add_level(1, level);
+  const auto copyRecord = Record::Builder::construct(std::move(copyBuilder));
+
+  std::size_t initialLevels = 0;
+  initialRecord.visit_levels([&](std::uint64_t, const Level&) {
+    ++initialLevels;
+  });
+  std::size_t copyLevels = 0;
+  copyRecord.visit_levels([&](std::uint64_t, const Level&) { ++copyLevels; });
+
+  EXPECT_EQ(initialRecord.instrument(), Instrument);
+  EXPECT_EQ(initialLevels, 1);
+  EXPECT_EQ(copyRecord.instrument(), "TSLA");
+  EXPECT_EQ(copyLevels, 2);
+}
+
 struct GeneratorHistoricalRecord : public GeneratorHistoricalRecordBuilder {};
 
 TEST_F(GeneratorHistoricalRecord, GivesAwayLevelsOnStealing) {
@@ -169,6 +195,40 @@ TEST_F(GeneratorHistoricalRecord, GivesAwayLevelsOnStealing) {
   EXPECT_FALSE(record.has_levels());
 }
 
+TEST_F(GeneratorHistoricalRecord, KeepsLevelsOfCopyOnStealing) {
+  const auto level = make_level(120.1, 202.1, "BCP", 120.2, 202.2, "OCP");
+
+  set_mandatory_attributes(record_builder);
+  record_builder.add_level(0, level);
+
+  const Record record = Record::Builder::construct(std::move(record_builder));
+  Record copy = record;
+
+  copy.steal_levels([](std::uint64_t, const Level&) {});
+
+  EXPECT_FALSE(copy.has_levels());
+  EXPECT_TRUE(record.has_levels());
+}
+
+TEST_F(GeneratorHistoricalRecord, StealsLevelsOfUnsharedRecord) {
+  const auto level = make_level(120.1, 202.1, "BCP", 120.2, 202.2, "OCP");
+
+  set_mandatory_attributes(record_builder);
+  record_builder.add_level(0, level);
+
+  Record record = Record::Builder::construct(std::move(record_builder));
+
+  std::size_t stolen_levels = 0;
+  record.steal_levels([&](std::uint64_t, const Level& stolen) {
+    ++stolen_levels;
+    EXPECT_THAT(stolen.bid_price(), Optional(DoubleEq(120.1)));
+    EXPECT_EQ(stolen.bid_counterparty(), "BCP");
+  });
+
+  EXPECT_FALSE(record.has_levels());
+  EXPECT_EQ(stolen_levels, 1);
+}
+
 TEST_F(GeneratorHistoricalRecord, FormatsToString) {
   constexpr std::uint64_t level_idx = 0;
 
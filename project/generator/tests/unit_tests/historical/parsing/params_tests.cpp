@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "data_layer/api/models/datasource.hpp"
+#include "ih/constants.hpp"
 #include "ih/historical/parsing/params.hpp"
 
 namespace Simulator::Generator::Historical {
@@ -161,5 +162,28 @@ TEST_F(GeneratorHistoricalParsingMakeDatabaseParsingParams,
   ASSERT_EQ(params.datasource_max_depth_levels(), 42);
 }
 
+TEST_F(GeneratorHistoricalParsingMakeDatabaseParsingParams,
+       MakesWithDefaultFetchSizeAndPartitions) {
+  patch.with_table_name("my_table");
+  const auto datasource = make_datasource(patch);
+
+  const auto params = make_database_parsing_params(datasource);
+  ASSERT_EQ(params.fetch_size(), Constant::Historical::DatabaseFetchRowsCount);
+  ASSERT_EQ(params.partitions(), 1);
+}
+
+TEST_F(GeneratorHistoricalParsingMakeDatabaseParsingParams,
+       DoesNotAcceptZeroFetchSizeAndPartitions) {
+  patch.with_table_name("my_table");
+  const auto datasource = make_datasource(patch);
+
+  auto params = make_database_parsing_params(datasource);
+  params.set_fetch_size(0);
+  params.set_partitions(0);
+
+  ASSERT_EQ(params.fetch_size(), 1);
+  ASSERT_EQ(params.partitions(), 1);
+}
+
 }  // namespace
 }  // namespace Simulator::Generator::Historical
@@ -0,0 +1,173 @@
+#include "ih/historical/processor.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ih/adaptation/request_prototypes.hpp"
+#include "ih/historical/data/record.hpp"
+#include "ih/registry/generated_orders_registry_impl.hpp"
+#include "middleware/routing/trading_request_channel.hpp"
+#include "mocks/context/order_context.hpp"
+#include "mocks/trading_request_channel.hpp"
+#include "tests/test_utils/historical_data_utils.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+using namespace ::testing;
+
+class GeneratorHistoricalActionProcessor : public testing::Test {
+ public:
+  auto processor() -> ActionProcessor& { return *processor_; }
+
+  auto saturate_engine(bool saturated) -> void { saturated_ = saturated; }
+
+  auto make_action(double bid_price) const -> Historical::Action {
+    Record::Builder record_builder;
+    record_builder.with_receive_time(std::chrono::system_clock::now())
+        .with_instrument(Symbol)
+        .with_source_row(1)
+        .add_level(0,
+                   make_level(bid_price,
+                              10.,
+                              "Counterparty1",
+                              std::nullopt,
+                              std::nullopt,
+                              std::nullopt));
+
+    Action::Builder action_builder;
+    action_builder.add(Record::Builder::construct(std::move(record_builder)),
+                       Historical::Duration{0});
+    return Action::Builder::construct(std::move(action_builder));
+  }
+
+  auto placed_prices() const -> const std::vector<double>& {
+    return placed_prices_;
+  }
+
+ protected:
+  inline static const std::string Symbol{"AAPL"};
+
+  GeneratorHistoricalActionProcessor()
+      : listing_{make_listing()},
+        prototypes_{simulator::InstrumentDescriptor{}},
+        context_{std::make_shared<NiceMock<Mock::OrderInstrumentContext>>()} {
+    ON_CALL(*context_, getInstrument).WillByDefault(ReturnRef(listing_));
+    ON_CALL(*context_, getRequestPrototypes)
+        .WillByDefault(ReturnRef(prototypes_));
+    ON_CALL(*context_, takeRegistry).WillByDefault(ReturnRef(registry_));
+    ON_CALL(*context_, getSyntheticIdentifier)
+        .WillByDefault(Return("Order1"));
+
+    ON_CALL(receiver_,
+            process(A<const simulator::protocol::InstrumentHandleRequest&>(),
+                    A<simulator::protocol::InstrumentHandleReply&>()))
+        .WillByDefault(
+            [](const auto&, simulator::protocol::InstrumentHandleReply& reply) {
+              reply.handle = simulator::protocol::InstrumentHandle{1};
+            });
+    ON_CALL(receiver_,
+            process(A<const simulator::protocol::EngineLoadRequest&>(),
+                    A<simulator::protocol::EngineLoadReply&>()))
+        .WillByDefault([this](const auto&,
+                              simulator::protocol::EngineLoadReply& reply) {
+          reply.load = simulator::protocol::EngineLoad{
+              .queue_depth = saturated_ ? 1'000'000U : 0U,
+              .oldest_request_age = std::chrono::microseconds{0}};
+        });
+    ON_CALL(receiver_, process(A<simulator::protocol::OrderPlacementRequest>()))
+        .WillByDefault([this](simulator::protocol::OrderPlacementRequest req) {
+          placed_prices_.push_back(req.order_price.value().value());
+        });
+
+    simulator::middleware::bind_trading_request_channel(
+        std::shared_ptr<Mock::TradingRequestReceiver>{
+            std::addressof(receiver_), [](auto* /*pointer*/) {}});
+
+    // Contexts are resolved by symbol of a listing on construction,
+    // the engine load is probed on each record to follow saturate_engine
+    processor_ = std::make_unique<ActionProcessor>(
+        ActionProcessor::Contexts{context_}, make_pacer_limits());
+  }
+
+  ~GeneratorHistoricalActionProcessor() override {
+    simulator::middleware::release_trading_request_channel();
+  }
+
+ private:
+  static auto make_pacer_limits() -> EnginePacer::Limits {
+    EnginePacer::Limits limits = EnginePacer::defaultLimits();
+    limits.probeInterval = std::chrono::microseconds::zero();
+    return limits;
+  }
+
+  static auto make_listing() -> DataLayer::Listing {
+    DataLayer::Listing::Patch patch;
+    patch.withSymbol(Symbol).withVenueId("NYSE");
+    return DataLayer::Listing::create(std::move(patch), 1);
+  }
+
+  DataLayer::Listing listing_;
+  RequestPrototypes prototypes_;
+  GeneratedOrdersRegistryImpl registry_;
+  NiceMock<Mock::TradingRequestReceiver> receiver_;
+  std::shared_ptr<NiceMock<Mock::OrderInstrumentContext>> context_;
+  std::unique_ptr<ActionProcessor> processor_;
+
+  std::vector<double> placed_prices_;
+  bool saturated_{false};
+};
+
+TEST_F(GeneratorHistoricalActionProcessor,
+       AppliesRecordWhenEngineIsNotSaturated) {
+  processor().process(make_action(10.));
+
+  ASSERT_THAT(placed_prices(), ElementsAre(10.));
+  ASSERT_FALSE(processor().hasHeldRecords());
+}
+
+TEST_F(GeneratorHistoricalActionProcessor,
+       HoldsRecordWhileEngineIsSaturated) {
+  saturate_engine(true);
+
+  processor().process(make_action(10.));
+  processor().retryHeldRecords();
+
+  ASSERT_THAT(placed_prices(), IsEmpty());
+  ASSERT_TRUE(processor().hasHeldRecords());
+}
+
+TEST_F(GeneratorHistoricalActionProcessor,
+       RetriesHeldRecordOnceEngineCatchesUp) {
+  saturate_engine(true);
+  processor().process(make_action(10.));
+
+  saturate_engine(false);
+  processor().retryHeldRecords();
+
+  ASSERT_THAT(placed_prices(), ElementsAre(10.));
+  ASSERT_FALSE(processor().hasHeldRecords());
+}
+
+TEST_F(GeneratorHistoricalActionProcessor,
+       FlushesLatestOfConflatedRecordsWhileEngineIsSaturated) {
+  saturate_engine(true);
+  processor().process(make_action(10.));
+  processor().process(make_action(11.));
+
+  processor().flushHeldRecords();
+
+  ASSERT_THAT(placed_prices(), ElementsAre(11.));
+  ASSERT_FALSE(processor().hasHeldRecords());
+}
+
+}  // namespace
+}  // namespace Simulator::Generator::Historical
@@ -34,8 +34,10 @@ class GeneratorHistoricalRecordApplierFixture : public testing::Test {
 
   auto context() -> Mock::OrderInstrumentContext& { return *context_; }
 
+  // Records are diffed against the book of the previous ones,
+  // as they are by a historical processor.
   auto apply(Historical::Record _record) -> std::vector<GeneratedMessage> {
-    return RecordApplier::apply(std::move(_record), context_);
+    return RecordApplier::apply(std::move(_record), context_, book_);
   }
 
   auto make_record(std::initializer_list<Historical::Level> levels)
@@ -93,6 +95,7 @@ class GeneratorHistoricalRecordApplierFixture : public testing::Test {
   DataLayer::Venue venue_;
 
   std::shared_ptr<Mock::OrderInstrumentContext> context_;
+  RecordApplier::Book book_;
 };
 
 class GeneratorHistoricalRecordApplierMockedRegistry
@@ -110,6 +113,14 @@ class GeneratorHistoricalRecordApplierMockedRegistry
     EXPECT_CALL(context(), getInstrument).WillRepeatedly(ReturnRef(listing()));
 
     EXPECT_CALL(context(), takeRegistry).WillRepeatedly(ReturnRef(registry()));
+
+    EXPECT_CALL(registry(), transact)
+        .WillRepeatedly(
+            [this](const GeneratedOrdersRegistry::Transaction& transaction) {
+              transaction(registry());
+            });
+
+    EXPECT_CALL(registry(), revision).WillRepeatedly(Return(0));
   }
 
  private:
@@ -655,6 +666,33 @@ TEST_F(GeneratorHistoricalRecordApplierMockedRegistry,
   ASSERT_THAT(generated_orders[5].getOwnerID(), Eq(simulator::PartyId{"CP4"}));
 }
 
+TEST_F(GeneratorHistoricalRecordApplierMockedRegistry,
+       DoesNotLookUpUnchangedLevelsWhileRegistryIsUnchanged) {
+  const auto level = make_level(
+      10., 10., "Counterparty1", std::nullopt, std::nullopt, std::nullopt);
+
+  // Each transaction is published with the next revision
+  std::uint64_t revision = 0;
+  EXPECT_CALL(registry(), revision).WillRepeatedly(ReturnPointee(&revision));
+  EXPECT_CALL(registry(), transact)
+      .WillRepeatedly(
+          [&](const GeneratedOrdersRegistry::Transaction& transaction) {
+            transaction(registry());
+            ++revision;
+          });
+  EXPECT_CALL(registry(), selectBy)
+      .Times(1)
+      .WillOnce(Return(std::vector<GeneratedOrderData>{}));
+  EXPECT_CALL(registry(), findByOwner("Counterparty1"))
+      .Times(1)
+      .WillOnce(Return(std::nullopt));
+  EXPECT_CALL(registry(), add).Times(1).WillOnce(Return(true));
+  EXPECT_CALL(context(), getSyntheticIdentifier).WillOnce(Return("Order1"));
+
+  ASSERT_EQ(apply(make_record({level})).size(), 1);
+  EXPECT_TRUE(apply(make_record({level})).empty());
+}
+
 class GeneratorHistoricalRecordApplier
     : public GeneratorHistoricalRecordApplierFixture {
  public:
@@ -1355,5 +1393,166 @@ TEST_F(GeneratorHistoricalRecordApplier,
                                simulator::PartyId{"Counterparty2"}));
 }
 
+TEST_F(GeneratorHistoricalRecordApplier,
+       SkipsUnchangedLevelsOfConsecutiveRecords) {
+  const auto level =
+      make_level(10., 10., "Counterparty1", 12., 12., "Counterparty2");
+
+  EXPECT_CALL(context(), getSyntheticIdentifier)
+      .Times(2)
+      .WillRepeatedly(ReturnRoundRobin({"Order1", "Order2"}));
+
+  const std::vector<GeneratedMessage> messages1 =
+      apply(make_record({level}));
+  ASSERT_EQ(messages1.size(), 2);
+
+  const std::vector<GeneratedMessage> messages2 =
+      apply(make_record({level}));
+  ASSERT_TRUE(messages2.empty());
+
+  ASSERT_EQ(registry_select_by_party_id(simulator::PartyId{"Counterparty1"})
+                .size(),
+            1);
+  ASSERT_EQ(registry_select_by_party_id(simulator::PartyId{"Counterparty2"})
+                .size(),
+            1);
+}
+
+TEST_F(GeneratorHistoricalRecordApplier,
+       ModifiesOnlyChangedLevelOfConsecutiveRecord) {
+  const auto level1 =
+      make_level(10., 10., "Counterparty1", 12., 12., "Counterparty2");
+  const auto level2 =
+      make_level(10., 10., "Counterparty1", 13., 12., "Counterparty2");
+
+  EXPECT_CALL(context(), getSyntheticIdentifier)
+      .Times(2)
+      .WillRepeatedly(ReturnRoundRobin({"Order1", "Order2"}));
+
+  ASSERT_EQ(apply(make_record({level1})).size(), 2);
+
+  const std::vector<GeneratedMessage> messages =
+      apply(make_record({level2}));
+  ASSERT_EQ(messages.size(), 1);
+  ASSERT_THAT(messages[0],
+              IsModificationRequest(simulator::Side::Option::Sell,
+                                    simulator::ClientOrderId{"Order2"},
+                                    13.,
+                                    12.,
+                                    simulator::PartyId{"Counterparty2"}));
+}
+
+TEST_F(GeneratorHistoricalRecordApplier,
+       TopsUpPartiallyFilledOrderOfUnchangedLevel) {
+  const auto level = make_level(
+      10., 10., "Counterparty1", std::nullopt, std::nullopt, std::nullopt);
+
+  EXPECT_CALL(context(), getSyntheticIdentifier).WillOnce(Return("Order1"));
+
+  ASSERT_EQ(apply(make_record({level})).size(), 1);
+
+  // The order has been partially filled since the previous record
+  GeneratedOrderData::Patch partial_fill;
+  partial_fill.setUpdatedQuantity(simulator::Quantity{4.});
+  ASSERT_TRUE(registry().updateByOwner("Counterparty1",
+                                       std::move(partial_fill)));
+
+  const std::vector<GeneratedMessage> messages =
+      apply(make_record({level}));
+  ASSERT_EQ(messages.size(), 1);
+  ASSERT_THAT(messages[0],
+              IsModificationRequest(simulator::Side::Option::Buy,
+                                    simulator::ClientOrderId{"Order1"},
+                                    10.,
+                                    10.,
+                                    simulator::PartyId{"Counterparty1"}));
+}
+
+TEST_F(GeneratorHistoricalRecordApplier,
+       PlacesUnchangedLevelIfItsOrderIsNoLongerRegistered) {
+  const auto level = make_level(
+      10., 10., "Counterparty1", std::nullopt, std::nullopt, std::nullopt);
+
+  EXPECT_CALL(context(), getSyntheticIdentifier)
+      .Times(2)
+      .WillRepeatedly(ReturnRoundRobin({"Order1", "Order2"}));
+
+  ASSERT_EQ(apply(make_record({level})).size(), 1);
+
+  // The order has been filled since the previous record
+  ASSERT_TRUE(registry().removeByOwner("Counterparty1"));
+
+  const std::vector<GeneratedMessage> messages =
+      apply(make_record({level}));
+  ASSERT_EQ(messages.size(), 1);
+  ASSERT_THAT(messages[0],
+              IsNewOrderRequest(simulator::Side::Option::Buy,
+                                simulator::ClientOrderId{"Order2"},
+                                10.,
+                                10.,
+                                simulator::PartyId{"Counterparty1"}));
+}
+
+TEST_F(GeneratorHistoricalRecordApplier,
+       PlacesLevelAgainAfterItHasBeenCancelled) {
+  const auto level = make_level(
+      10., 10., "Counterparty1", std::nullopt, std::nullopt, std::nullopt);
+
+  EXPECT_CALL(context(), getSyntheticIdentifier)
+      .Times(2)
+      .WillRepeatedly(ReturnRoundRobin({"Order1", "Order2"}));
+
+  ASSERT_EQ(apply(make_record({level})).size(), 1);
+  ASSERT_EQ(apply(make_record({})).size(), 1);
+
+  const std::vector<GeneratedMessage> messages =
+      apply(make_record({level}));
+  ASSERT_EQ(messages.size(), 1);
+  ASSERT_THAT(messages[0],
+              IsNewOrderRequest(simulator::Side::Option::Buy,
+                                simulator::ClientOrderId{"Order2"},
+                                10.,
+                                10.,
+                                simulator::PartyId{"Counterparty1"}));
+}
+
+TEST_F(GeneratorHistoricalRecordApplier,
+       SkipsUnchangedLevelsWithoutPartyOfConsecutiveRecords) {
+  const auto level = make_level(10., 10., std::nullopt, 12., 12., std::nullopt);
+
+  EXPECT_CALL(context(), getSyntheticIdentifier)
+      .Times(2)
+      .WillRepeatedly(ReturnRoundRobin({"Order1", "Order2"}));
+
+  ASSERT_EQ(apply(make_record({level})).size(), 2);
+  EXPECT_TRUE(apply(make_record({level})).empty());
+}
+
+TEST_F(GeneratorHistoricalRecordApplier,
+       CancelsOrderOfPartyWhichHasLeftConsecutiveRecord) {
+  const auto level1 =
+      make_level(10., 10., "Counterparty1", 12., 12., "Counterparty2");
+  const auto level2 = make_level(
+      10., 10., "Counterparty1", std::nullopt, std::nullopt, std::nullopt);
+
+  EXPECT_CALL(context(), getSyntheticIdentifier)
+      .Times(2)
+      .WillRepeatedly(ReturnRoundRobin({"Order1", "Order2"}));
+
+  ASSERT_EQ(apply(make_record({level1})).size(), 2);
+
+  const std::vector<GeneratedMessage> messages = apply(make_record({level2}));
+  ASSERT_EQ(messages.size(), 1);
+  ASSERT_THAT(messages[0],
+              IsCancelRequest(simulator::Side::Option::Sell,
+                              simulator::ClientOrderId{"Order2"},
+                              12.,
+                              12.,
+                              simulator::PartyId{"Counterparty2"}));
+  ASSERT_TRUE(
+      registry_select_by_party_id(simulator::PartyId{"Counterparty2"})
+          .empty());
+}
+
 }  // namespace
-}  // namespace Simulator::Generator::Historical
\ No newline at end of file
+}  // namespace Simulator::Generator::Historical
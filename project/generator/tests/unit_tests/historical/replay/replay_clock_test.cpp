@@ -0,0 +1,93 @@
+#include "ih/historical/replay/replay_clock.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "core/tools/time.hpp"
+#include "ih/historical/data/time.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+// NOLINTBEGIN(*magic-numbers*)
+
+TEST(GeneratorHistoricalReplayClock, RunsInRealTimeByDefault) {
+  const ReplayClock clock;
+
+  EXPECT_DOUBLE_EQ(clock.speed(), 1.);
+  EXPECT_FALSE(clock.isMaxSpeed());
+  EXPECT_THAT(clock.timeUntil(clock.now() + 10s),
+              AllOf(Gt(9s), Le(std::chrono::microseconds{10s})));
+}
+
+TEST(GeneratorHistoricalReplayClock, DividesWaitingTimeBySpeed) {
+  const ReplayClock clock{60.};
+
+  EXPECT_THAT(clock.timeUntil(clock.now() + 60s),
+              AllOf(Gt(900ms), Le(std::chrono::microseconds{1s})));
+}
+
+TEST(GeneratorHistoricalReplayClock, DoesNotWaitForPastTime) {
+  const ReplayClock clock{2.};
+
+  EXPECT_EQ(clock.timeUntil(clock.now() - 1s), 0us);
+}
+
+TEST(GeneratorHistoricalReplayClock, DoesNotWaitInMaxSpeedMode) {
+  const ReplayClock clock{ReplayClock::MaxSpeed};
+
+  EXPECT_TRUE(clock.isMaxSpeed());
+  EXPECT_EQ(clock.timeUntil(clock.now() + 1h), 0us);
+}
+
+TEST(GeneratorHistoricalReplayClock, StandsStillInMaxSpeedMode) {
+  const ReplayClock clock{ReplayClock::MaxSpeed};
+  const Historical::Timepoint start = clock.now();
+
+  std::this_thread::sleep_for(1ms);
+
+  EXPECT_EQ(clock.now(), start);
+}
+
+TEST(GeneratorHistoricalReplayClock, AdvancesToReplayedTime) {
+  ReplayClock clock{ReplayClock::MaxSpeed};
+  const Historical::Timepoint replayed = clock.now() + 1h;
+
+  clock.advanceTo(replayed);
+
+  EXPECT_EQ(clock.now(), replayed);
+}
+
+TEST(GeneratorHistoricalReplayClock, DoesNotMoveBackwards) {
+  ReplayClock clock{ReplayClock::MaxSpeed};
+  const Historical::Timepoint start = clock.now();
+
+  clock.advanceTo(start - 1h);
+
+  EXPECT_EQ(clock.now(), start);
+}
+
+TEST(GeneratorHistoricalReplayClock, GivesReplayTimeAsSystemTime) {
+  ReplayClock clock{ReplayClock::MaxSpeed};
+  const Historical::Timepoint replayed = clock.now() + 1h;
+
+  clock.advanceTo(replayed);
+
+  EXPECT_EQ(clock.system_time(), simulator::core::to_time(replayed));
+}
+
+TEST(GeneratorHistoricalReplayClock, RejectsNegativeSpeed) {
+  EXPECT_THROW(ReplayClock{-1.}, std::invalid_argument);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator::Historical
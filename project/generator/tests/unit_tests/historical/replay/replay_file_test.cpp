@@ -0,0 +1,192 @@
+#include "ih/historical/replay/replay_file.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ih/historical/adapters/replay_file_reader.hpp"
+#include "ih/historical/data/record.hpp"
+#include "ih/historical/data/record_store.hpp"
+#include "ih/historical/data/time.hpp"
+#include "mocks/historical/data_access_adapter.hpp"
+#include "tests/test_utils/historical_data_utils.hpp"
+
+namespace Simulator::Generator::Historical {
+namespace {
+
+using namespace ::testing;
+
+// NOLINTBEGIN(*magic-numbers*)
+
+struct GeneratorHistoricalReplayFile : public Test {
+  // 2023-06-13 13:10:52 GMT
+  static constexpr Historical::Timepoint ReceiveTime{
+      make_time(1686661852000000000)};
+  // 2023-06-13 13:10:53 GMT
+  static constexpr Historical::Timepoint MessageTime{
+      make_time(1686661853000000000)};
+
+  static auto make_builder(std::string instrument,
+                           Historical::Timepoint receive_time,
+                           std::uint64_t source_row) -> Record::Builder {
+    Record::Builder builder;
+    builder.with_instrument(std::move(instrument))
+        .with_receive_time(receive_time)
+        .with_source_row(source_row)
+        .with_source_name("source-name")
+        .with_source_connection("/path/to/file.csv");
+    return builder;
+  }
+
+  static auto make_record(Record::Builder builder) -> Record {
+    return Record::Builder::construct(std::move(builder));
+  }
+
+  static auto collect_levels(const Record& record) -> std::vector<Level> {
+    std::vector<Level> levels;
+    record.visit_levels(
+        [&](std::uint64_t, const Level& level) { levels.push_back(level); });
+    return levels;
+  }
+
+  auto TearDown() -> void override { std::filesystem::remove(path); }
+
+  std::string path = (std::filesystem::temp_directory_path() /
+                      ("generator-replay-file-test-" +
+                       std::to_string(::testing::UnitTest::GetInstance()
+                                          ->random_seed())))
+                         .string();
+  std::shared_ptr<RecordStore> store = RecordStore::create();
+};
+
+TEST_F(GeneratorHistoricalReplayFile, RecognizesReplayFile) {
+  ReplayFile::write(*store, path);
+
+  ASSERT_TRUE(ReplayFile::is_replay_file(path));
+}
+
+TEST_F(GeneratorHistoricalReplayFile, DoesNotRecognizeCsvFile) {
+  std::ofstream{path} << "ReceivedTimeStamp,Instrument\n";
+
+  ASSERT_FALSE(ReplayFile::is_replay_file(path));
+}
+
+TEST_F(GeneratorHistoricalReplayFile, ReadsEmptyReplayFile) {
+  ReplayFile::write(*store, path);
+
+  ReplayFileReader reader{path};
+
+  ASSERT_EQ(reader.size(), 0);
+  ASSERT_EQ(reader.next(), std::nullopt);
+}
+
+TEST_F(GeneratorHistoricalReplayFile, ReadsRecordAttributes) {
+  Record::Builder builder = make_builder("AAPL", ReceiveTime, 42);
+  builder.with_message_time(MessageTime)
+      .add_level(0, make_level(10.1, 100., "BP", 10.2, 200., "OP"))
+      .add_level(1,
+                 make_level(10., std::nullopt, std::nullopt, 10.3, 210., "OP"));
+  store->add(make_record(std::move(builder)));
+  ReplayFile::write(*store, path);
+
+  ReplayFileReader reader{path};
+  const std::optional<Record> record = reader.next();
+
+  ASSERT_TRUE(record.has_value());
+  EXPECT_EQ(record->instrument(), "AAPL");
+  EXPECT_EQ(record->receive_time(), ReceiveTime);
+  EXPECT_THAT(record->message_time(), Optional(Eq(MessageTime)));
+  EXPECT_EQ(record->source_row(), 42);
+  EXPECT_THAT(record->source_name(), Optional(Eq("source-name")));
+  EXPECT_THAT(record->source_connection(), Optional(Eq("/path/to/file.csv")));
+
+  const std::vector<Level> levels = collect_levels(*record);
+  ASSERT_EQ(levels.size(), 2);
+  EXPECT_THAT(levels[0], LevelEq("BP", 100., 10.1, 10.2, 200., "OP"));
+  EXPECT_THAT(levels[1].bid_price(), Optional(DoubleEq(10.)));
+  EXPECT_EQ(levels[1].bid_quantity(), std::nullopt);
+  EXPECT_EQ(levels[1].bid_counterparty(), std::nullopt);
+  EXPECT_THAT(levels[1].offer_counterparty(), Optional(Eq("OP")));
+
+  EXPECT_EQ(reader.next(), std::nullopt);
+}
+
+TEST_F(GeneratorHistoricalReplayFile, ReadsLevelsOfConsecutiveRecords) {
+  Record::Builder first = make_builder("AAPL", ReceiveTime, 1);
+  first.add_level(0, make_level(10.1, 100., "BP", 10.2, 200., "OP"));
+  store->add(make_record(std::move(first)));
+  store->add(make_record(make_builder("MSFT", ReceiveTime, 2)));
+  Record::Builder third = make_builder("AAPL", ReceiveTime, 3);
+  third.add_level(0, make_level(9.9, 50., "BP", 10.3, 60., "OP2"))
+      .add_level(1, make_level(9.8, 70., "BP2", 10.4, 80., "OP"));
+  store->add(make_record(std::move(third)));
+  ReplayFile::write(*store, path);
+
+  ReplayFileReader reader{path};
+  ASSERT_EQ(reader.size(), 3);
+
+  const std::optional<Record> first_record = reader.next();
+  ASSERT_TRUE(first_record.has_value());
+  EXPECT_THAT(collect_levels(*first_record),
+              ElementsAre(LevelEq("BP", 100., 10.1, 10.2, 200., "OP")));
+
+  const std::optional<Record> second_record = reader.next();
+  ASSERT_TRUE(second_record.has_value());
+  EXPECT_EQ(second_record->instrument(), "MSFT");
+  EXPECT_THAT(collect_levels(*second_record), IsEmpty());
+
+  const std::optional<Record> third_record = reader.next();
+  ASSERT_TRUE(third_record.has_value());
+  EXPECT_THAT(collect_levels(*third_record),
+              ElementsAre(LevelEq("BP", 50., 9.9, 10.3, 60., "OP2"),
+                          LevelEq("BP2", 70., 9.8, 10.4, 80., "OP")));
+}
+
+TEST_F(GeneratorHistoricalReplayFile, CompilesAdapterRecords) {
+  Fake::DataAccessAdapter adapter;
+  adapter.pushRecordBuilder(make_builder("AAPL", ReceiveTime, 1));
+  adapter.pushRecordBuilder(make_builder("MSFT", ReceiveTime, 2));
+
+  ASSERT_EQ(ReplayFile::compile(adapter, path), 2);
+  EXPECT_FALSE(std::filesystem::exists(path + ".tmp.0"));
+
+  ReplayFileReader reader{path};
+  EXPECT_THAT(reader.next(), Optional(Property(&Record::instrument, "AAPL")));
+  EXPECT_THAT(reader.next(), Optional(Property(&Record::instrument, "MSFT")));
+  EXPECT_EQ(reader.next(), std::nullopt);
+}
+
+TEST_F(GeneratorHistoricalReplayFile, FailsToCompileMalformedRecord) {
+  Record::Builder malformed;
+  malformed.with_receive_time(ReceiveTime).with_source_row(2);
+
+  Fake::DataAccessAdapter adapter;
+  adapter.pushRecordBuilder(make_builder("AAPL", ReceiveTime, 1));
+  adapter.pushRecordBuilder(std::move(malformed));
+
+  ASSERT_THROW(ReplayFile::compile(adapter, path), std::runtime_error);
+  ASSERT_FALSE(std::filesystem::exists(path));
+  ASSERT_FALSE(std::filesystem::exists(path + ".tmp.0"));
+}
+
+TEST_F(GeneratorHistoricalReplayFile, RejectsTruncatedReplayFile) {
+  store->add(make_record(make_builder("AAPL", ReceiveTime, 1)));
+  ReplayFile::write(*store, path);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+
+  ASSERT_THROW(ReplayFileReader{path}, std::runtime_error);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator::Historical
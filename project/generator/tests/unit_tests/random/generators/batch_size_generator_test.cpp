@@ -0,0 +1,74 @@
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ih/random/generators/batch_size_generator.hpp"
+
+namespace Simulator::Generator::Random {
+namespace {
+
+std::vector<std::size_t> drawSizes(BatchSizeGenerator & _generator)
+{
+    _generator.setExpectedSize(8.);
+
+    std::vector<std::size_t> sizes;
+    for (int draw = 0; draw < 100; ++draw)
+    {
+        sizes.push_back(_generator.generate());
+    }
+    return sizes;
+}
+
+TEST(Generator_Random_BatchSizeGenerator, DrawsSameSizesForSameSeed)
+{
+    BatchSizeGenerator first { 42, 7 };
+    BatchSizeGenerator second { 42, 7 };
+
+    EXPECT_EQ(drawSizes(first), drawSizes(second));
+}
+
+TEST(Generator_Random_BatchSizeGenerator, DrawsDifferentSizesForStreams)
+{
+    BatchSizeGenerator first { 42, 7 };
+    BatchSizeGenerator second { 42, 8 };
+
+    EXPECT_NE(drawSizes(first), drawSizes(second));
+}
+
+TEST(Generator_Random_BatchSizeGenerator, DrawsDifferentSizesForSeeds)
+{
+    BatchSizeGenerator first { 42, 7 };
+    BatchSizeGenerator second { 43, 7 };
+
+    EXPECT_NE(drawSizes(first), drawSizes(second));
+}
+
+TEST(Generator_Random_BatchSizeGenerator, DrawsNothingForZeroExpectedSize)
+{
+    BatchSizeGenerator generator { 42, 7 };
+    generator.setExpectedSize(0.);
+
+    EXPECT_EQ(generator.generate(), 0);
+}
+
+TEST(Generator_Random_BatchSizeGenerator, DrawsSizesAroundExpectedSize)
+{
+    for (double const expectedSize : { 3., 250. })
+    {
+        BatchSizeGenerator generator { 42, 7 };
+        generator.setExpectedSize(expectedSize);
+
+        constexpr int Draws = 10'000;
+        double total = 0.;
+        for (int draw = 0; draw < Draws; ++draw)
+        {
+            total += static_cast<double>(generator.generate());
+        }
+
+        EXPECT_NEAR(total / Draws, expectedSize, expectedSize * 0.05);
+    }
+}
+
+} // namespace
+} // namespace Simulator::Generator::Random
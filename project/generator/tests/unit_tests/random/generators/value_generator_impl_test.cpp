@@ -1,8 +1,10 @@
 #include "gtest/gtest.h"
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -141,3 +143,68 @@ TYPED_TEST(Generator_Random_ValueGenerator_FloatingPoint, GenerateUniformInterva
     EXPECT_LE(random, max);
     EXPECT_GE(random, min);
 }
+
+
+TEST(Generator_Random_ValueGenerator, GenerateSameValuesWithSameSeed)
+{
+    auto pFirst = ValueGeneratorImpl::create(42);
+    auto pSecond = ValueGeneratorImpl::create(42);
+
+    for (int draw = 0; draw < 100; ++draw)
+    {
+        ASSERT_EQ(
+                pFirst->generateUniformValue<std::int64_t>(-1000, 1000)
+            ,   pSecond->generateUniformValue<std::int64_t>(-1000, 1000)
+        );
+        ASSERT_EQ(
+                pFirst->generateUniformValue(0., 1.)
+            ,   pSecond->generateUniformValue(0., 1.)
+        );
+    }
+}
+
+TEST(Generator_Random_ValueGenerator, GenerateDifferentValuesInStreams)
+{
+    constexpr std::uint64_t seed = 42;
+    auto pFirst = ValueGeneratorImpl::create(seed, 1);
+    auto pSecond = ValueGeneratorImpl::create(seed, 2);
+
+    constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_NE(
+            pFirst->generateUniformValue<std::uint64_t>(0, max)
+        ,   pSecond->generateUniformValue<std::uint64_t>(0, max)
+    );
+}
+
+TEST(Generator_Random_ValueGenerator, GenerateEachValueOfInterval)
+{
+    constexpr std::uint32_t min = 5;
+    constexpr std::uint32_t max = 14;
+
+    auto pGenerator = ValueGeneratorImpl::create(42);
+    std::vector<int> generatedCounts(max - min + 1, 0);
+    for (int draw = 0; draw < 1000; ++draw)
+    {
+        auto const random = pGenerator->generateUniformValue(min, max);
+        ASSERT_GE(random, min);
+        ASSERT_LE(random, max);
+        ++generatedCounts[random - min];
+    }
+
+    for (int const count : generatedCounts)
+    {
+        EXPECT_GT(count, 0);
+    }
+}
+
+TEST(Generator_Random_ValueGenerator, GenerateFullRange)
+{
+    constexpr auto min = std::numeric_limits<std::int64_t>::min();
+    constexpr auto max = std::numeric_limits<std::int64_t>::max();
+
+    auto pGenerator = ValueGeneratorImpl::create(42);
+    auto const first = pGenerator->generateUniformValue(min, max);
+    auto const second = pGenerator->generateUniformValue(min, max);
+
+    EXPECT_NE(first, second);
+}
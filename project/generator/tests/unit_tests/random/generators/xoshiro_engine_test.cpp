@@ -0,0 +1,42 @@
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "ih/random/generators/xoshiro_engine.hpp"
+
+namespace Simulator::Generator::Random {
+namespace {
+
+static_assert(std::uniform_random_bit_generator<XoshiroEngine>);
+
+TEST(Generator_Random_XoshiroEngine, GeneratesReferenceSequence)
+{
+    XoshiroEngine engine { 0 };
+
+    EXPECT_EQ(engine(), 0x99EC5F36CB75F2B4ULL);
+    EXPECT_EQ(engine(), 0xBF6E1F784956452AULL);
+    EXPECT_EQ(engine(), 0x1A5F849D4933E6E0ULL);
+}
+
+TEST(Generator_Random_XoshiroEngine, GeneratesSameSequenceForSameSeed)
+{
+    XoshiroEngine first { 42 };
+    XoshiroEngine second { 42 };
+
+    for (int draw = 0; draw < 100; ++draw)
+    {
+        ASSERT_EQ(first(), second());
+    }
+}
+
+TEST(Generator_Random_XoshiroEngine, GeneratesDifferentSequencesForCloseSeeds)
+{
+    XoshiroEngine first { 1 };
+    XoshiroEngine second { 2 };
+
+    EXPECT_NE(first(), second());
+}
+
+} // namespace
+} // namespace Simulator::Generator::Random
@@ -1,9 +1,11 @@
 #include "ih/registry/generated_orders_registry.hpp"
 
+#include <fmt/format.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -200,6 +202,25 @@ TEST_F(Generator_GeneratedOrdersRegistry, UpdatesByOrderID) {
   EXPECT_EQ(optUpdatedData->getOrderSide(), sell_side);
 }
 
+TEST_F(Generator_GeneratedOrdersRegistry,
+       DoesNotUpdateToOrderIDOfAnotherOrder) {
+  addRegisteredOrder(owner_id, order_id, buy_side);
+  addRegisteredOrder(simulator::PartyId{"Owner2"},
+                     simulator::ClientOrderId{"Order2"},
+                     sell_side);
+
+  EXPECT_FALSE(registry().updateByOwner("Owner2",
+                                        createOrderDataUpdate(order_id)));
+
+  const auto by_owner = registry().findByOwner("Owner2");
+  ASSERT_TRUE(by_owner.has_value());
+  EXPECT_EQ(by_owner->getOrderID(), simulator::ClientOrderId{"Order2"});
+
+  const auto by_order_id = registry().findByIdentifier(order_id.value());
+  ASSERT_TRUE(by_order_id.has_value());
+  EXPECT_EQ(by_order_id->getOwnerID(), owner_id);
+}
+
 TEST_F(Generator_GeneratedOrdersRegistry, DoesNotRemoveByNonexistentOwnerID) {
   EXPECT_FALSE(registry().removeByOwner(owner_id.value()));
 }
@@ -263,5 +284,114 @@ TEST_F(Generator_GeneratedOrdersRegistry, SelectsByPredicate) {
   EXPECT_EQ(selected.front().getOrderID(), order_id);
   EXPECT_EQ(selected.front().getOrderSide(), buy_side);
 }
+
+TEST_F(Generator_GeneratedOrdersRegistry, FindsOrdersAfterManyRemovals) {
+  constexpr int orders_count = 1000;
+  for (int idx = 0; idx < orders_count; ++idx) {
+    addRegisteredOrder(simulator::PartyId{fmt::format("Owner{}", idx)},
+                       simulator::ClientOrderId{fmt::format("OrderID{}", idx)},
+                       buy_side);
+  }
+  for (int idx = 0; idx < orders_count; ++idx) {
+    if (idx % 10 != 0) {
+      ASSERT_TRUE(registry().removeByOwner(fmt::format("Owner{}", idx)));
+    }
+  }
+
+  for (int idx = 0; idx < orders_count; ++idx) {
+    const auto order =
+        registry().findByIdentifier(fmt::format("OrderID{}", idx));
+    EXPECT_EQ(order.has_value(), idx % 10 == 0) << idx;
+  }
+  EXPECT_EQ(registry().selectBy([](auto const&) { return true; }).size(),
+            orders_count / 10);
+}
+
+TEST_F(Generator_GeneratedOrdersRegistry, KeepsInsertionOrderOfOrders) {
+  constexpr int orders_count = 200;
+  for (int idx = 0; idx < orders_count; ++idx) {
+    addRegisteredOrder(simulator::PartyId{fmt::format("Owner{}", idx)},
+                       simulator::ClientOrderId{fmt::format("OrderID{}", idx)},
+                       sell_side);
+  }
+  for (int idx = 0; idx < orders_count; idx += 2) {
+    ASSERT_TRUE(registry().removeByIdentifier(fmt::format("OrderID{}", idx)));
+  }
+
+  std::vector<std::string> owners;
+  registry().forEach([&](GeneratedOrderData const& _order) {
+    owners.push_back(_order.getOwnerID().value());
+  });
+
+  ASSERT_EQ(owners.size(), orders_count / 2);
+  for (std::size_t idx = 0; idx < owners.size(); ++idx) {
+    EXPECT_EQ(owners[idx], fmt::format("Owner{}", idx * 2 + 1));
+  }
+}
+
+TEST_F(Generator_GeneratedOrdersRegistry, AppliesTransactionOperations) {
+  addRegisteredOrder(owner_id, order_id, buy_side);
+
+  registry().transact([&](GeneratedOrdersRegistry& _locked) {
+    ASSERT_TRUE(_locked.add(makeOrderData(simulator::PartyId{"Owner2"},
+                                          simulator::ClientOrderId{"Order2"},
+                                          sell_side)));
+    ASSERT_TRUE(_locked.updateByOwner(
+        owner_id.value(),
+        createOrderDataUpdate(simulator::ClientOrderId{"Updated"})));
+    ASSERT_TRUE(_locked.removeByIdentifier("Order2"));
+    EXPECT_TRUE(_locked.findByIdentifier("Updated").has_value());
+  });
+
+  EXPECT_FALSE(registry().findByIdentifier(order_id.value()).has_value());
+  EXPECT_TRUE(registry().findByIdentifier("Updated").has_value());
+  EXPECT_FALSE(registry().findByOwner("Owner2").has_value());
+}
+
+TEST_F(Generator_GeneratedOrdersRegistry, AppliesNestedTransaction) {
+  registry().transact([&](GeneratedOrdersRegistry& _locked) {
+    _locked.transact([&](GeneratedOrdersRegistry& _nested) {
+      ASSERT_TRUE(_nested.add(makeOrderData(owner_id, order_id, buy_side)));
+    });
+    EXPECT_TRUE(_locked.findByOwner(owner_id.value()).has_value());
+  });
+
+  EXPECT_TRUE(registry().findByOwner(owner_id.value()).has_value());
+}
+
+TEST_F(Generator_GeneratedOrdersRegistry,
+       ReadsRegistryAsPublishedBeforeRunningTransaction) {
+  addRegisteredOrder(owner_id, order_id, buy_side);
+
+  registry().transact([&](GeneratedOrdersRegistry& _locked) {
+    ASSERT_TRUE(_locked.removeByOwner(owner_id.value()));
+    ASSERT_TRUE(_locked.add(makeOrderData(simulator::PartyId{"Owner2"},
+                                          simulator::ClientOrderId{"Order2"},
+                                          sell_side)));
+
+    EXPECT_TRUE(registry().findByOwner(owner_id.value()).has_value());
+    EXPECT_FALSE(registry().findByOwner("Owner2").has_value());
+  });
+
+  EXPECT_FALSE(registry().findByOwner(owner_id.value()).has_value());
+  EXPECT_TRUE(registry().findByOwner("Owner2").has_value());
+}
+
+TEST_F(Generator_GeneratedOrdersRegistry, DoesNotApplyThrowingTransaction) {
+  addRegisteredOrder(owner_id, order_id, buy_side);
+
+  EXPECT_THROW(registry().transact([&](GeneratedOrdersRegistry& _locked) {
+    ASSERT_TRUE(_locked.removeByOwner(owner_id.value()));
+    throw std::runtime_error{"transaction failed"};
+  }),
+               std::runtime_error);
+
+  EXPECT_TRUE(registry().findByOwner(owner_id.value()).has_value());
+  addRegisteredOrder(simulator::PartyId{"Owner2"},
+                     simulator::ClientOrderId{"Order2"},
+                     sell_side);
+  EXPECT_TRUE(registry().findByOwner(owner_id.value()).has_value());
+}
+
 }  // namespace
-}  // namespace Simulator::Generator
\ No newline at end of file
+}  // namespace Simulator::Generator
@@ -6,6 +6,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "ih/constants.hpp"
 #include "ih/registry/generated_order_data.hpp"
@@ -372,6 +373,38 @@ TEST_F(GeneratorOrderRegistryUpdaterExecutionReport,
   EXPECT_NO_THROW(OrderRegistryUpdater::update(registry, execution_report));
 }
 
+TEST_F(GeneratorOrderRegistryUpdaterExecutionReport,
+       AppliesMessagesInSingleTransaction) {
+  execution_report.order_status = simulator::OrderStatus::Option::Filled;
+  const std::vector<GeneratedMessage> messages{execution_report,
+                                               execution_report};
+
+  EXPECT_CALL(registry, transact)
+      .WillOnce([&](const GeneratedOrdersRegistry::Transaction& _transaction) {
+        _transaction(registry);
+      });
+  EXPECT_CALL(registry, removeByIdentifier(Eq(order_id.value()))).Times(2);
+
+  EXPECT_NO_THROW(OrderRegistryUpdater::update(registry, messages));
+}
+
+TEST_F(GeneratorOrderRegistryUpdaterExecutionReport,
+       SkipsInvalidMessageInTransaction) {
+  GeneratedMessage invalid_report = execution_report;
+  invalid_report.order_status = std::nullopt;
+  execution_report.order_status = simulator::OrderStatus::Option::Filled;
+  const std::vector<GeneratedMessage> messages{invalid_report,
+                                               execution_report};
+
+  EXPECT_CALL(registry, transact)
+      .WillOnce([&](const GeneratedOrdersRegistry::Transaction& _transaction) {
+        _transaction(registry);
+      });
+  EXPECT_CALL(registry, removeByIdentifier(Eq(order_id.value()))).Times(1);
+
+  EXPECT_NO_THROW(OrderRegistryUpdater::update(registry, messages));
+}
+
 // NOLINTEND(*magic-numbers*)
 
 }  // namespace
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "ih/tracing/json_tracer.hpp"
+#include "ih/tracing/null_tracer.hpp"
+#include "ih/tracing/trace_sampler.hpp"
+#include "ih/tracing/tracing.hpp"
+
+using namespace Simulator;
+using namespace Simulator::Generator;
+using namespace Simulator::Generator::Trace;
+
+namespace {
+
+// Reports whether an algorithm has been run with a recording tracer
+struct TracerProbe
+{
+    template<typename Tracer>
+    bool operator()(Tracer & /*_tracer*/) const
+    {
+        return IsRecording<Tracer>;
+    }
+};
+
+} // namespace
+
+TEST(Generator_Trace_Sampler, DisabledByDefault)
+{
+    Sampler sampler {};
+
+    EXPECT_FALSE(sampler.isEnabled());
+    EXPECT_FALSE(sampler.sampleNext());
+    EXPECT_FALSE(sampler.sampleNext());
+}
+
+TEST(Generator_Trace_Sampler, DisabledWithZeroRate)
+{
+    Sampler sampler { 0 };
+
+    EXPECT_FALSE(sampler.isEnabled());
+    EXPECT_FALSE(sampler.sampleNext());
+}
+
+TEST(Generator_Trace_Sampler, SamplesEachRunWithUnitRate)
+{
+    Sampler sampler { 1 };
+
+    EXPECT_TRUE(sampler.sampleNext());
+    EXPECT_TRUE(sampler.sampleNext());
+    EXPECT_TRUE(sampler.sampleNext());
+}
+
+TEST(Generator_Trace_Sampler, SamplesEachNthRunStartingWithFirst)
+{
+    Sampler sampler { 3 };
+
+    EXPECT_TRUE(sampler.sampleNext());
+    EXPECT_FALSE(sampler.sampleNext());
+    EXPECT_FALSE(sampler.sampleNext());
+    EXPECT_TRUE(sampler.sampleNext());
+    EXPECT_FALSE(sampler.sampleNext());
+}
+
+TEST(Generator_Trace_Tracing, RecognizesRecordingTracers)
+{
+    static_assert(!IsRecording<NullTracer>);
+    static_assert(!IsRecording<NullTracer &>);
+    static_assert(IsRecording<JsonTracer>);
+    static_assert(IsRecording<JsonTracer &>);
+}
+
+TEST(Generator_Trace_Tracing, RunsWithNullTracerWhenNotSampled)
+{
+    Sampler sampler {};
+
+    EXPECT_FALSE(trace(TracerProbe {}, sampler));
+}
+
+TEST(Generator_Trace_Tracing, RunsWithJsonTracerWhenSampled)
+{
+    Sampler sampler { 2 };
+
+    EXPECT_TRUE(trace(TracerProbe {}, sampler));
+    EXPECT_FALSE(trace(TracerProbe {}, sampler));
+}
@@ -0,0 +1,161 @@
+#include "ih/utils/engine_pacer.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+
+#include "middleware/routing/trading_request_channel.hpp"
+#include "mocks/trading_request_channel.hpp"
+#include "protocol/app/engine_load_request.hpp"
+
+namespace Simulator::Generator {
+namespace {
+
+using namespace std::chrono_literals;
+using namespace ::testing;
+
+// NOLINTBEGIN(*magic-numbers*)
+
+auto make_pacer() -> EnginePacer {
+  return EnginePacer{EnginePacer::Limits{
+      .maxQueueDepth = 10, .maxRequestAge = 100us, .maxSlowdown = 4}};
+}
+
+auto make_load(std::uint64_t depth, std::chrono::microseconds age)
+    -> simulator::protocol::EngineLoad {
+  return simulator::protocol::EngineLoad{.queue_depth = depth,
+                                         .oldest_request_age = age};
+}
+
+TEST(GeneratorEnginePacer, AdmitsWhenEngineKeepsUp) {
+  EnginePacer pacer = make_pacer();
+
+  EXPECT_TRUE(pacer.admit(make_load(10, 100us)));
+  EXPECT_EQ(pacer.slowdown(), 1);
+  EXPECT_EQ(pacer.pace(5ms), 5ms);
+}
+
+TEST(GeneratorEnginePacer, RejectsWhenQueueIsTooDeep) {
+  EnginePacer pacer = make_pacer();
+
+  EXPECT_FALSE(pacer.admit(make_load(11, 0us)));
+}
+
+TEST(GeneratorEnginePacer, RejectsWhenOldestRequestWaitsTooLong) {
+  EnginePacer pacer = make_pacer();
+
+  EXPECT_FALSE(pacer.admit(make_load(1, 101us)));
+}
+
+TEST(GeneratorEnginePacer, DoublesSlowdownUpToLimitWhileSaturated) {
+  EnginePacer pacer = make_pacer();
+  const auto saturated = make_load(11, 0us);
+
+  ASSERT_FALSE(pacer.admit(saturated));
+  EXPECT_EQ(pacer.slowdown(), 2);
+  ASSERT_FALSE(pacer.admit(saturated));
+  EXPECT_EQ(pacer.slowdown(), 4);
+  ASSERT_FALSE(pacer.admit(saturated));
+  EXPECT_EQ(pacer.slowdown(), 4);
+  EXPECT_EQ(pacer.pace(5ms), 20ms);
+}
+
+TEST(GeneratorEnginePacer, ResetsSlowdownOnceEngineKeepsUp) {
+  EnginePacer pacer = make_pacer();
+  ASSERT_FALSE(pacer.admit(make_load(11, 0us)));
+
+  ASSERT_TRUE(pacer.admit(make_load(0, 0us)));
+  EXPECT_EQ(pacer.slowdown(), 1);
+}
+
+class GeneratorEnginePacerProbe : public testing::Test {
+ public:
+  auto expect_load_queries(int times) -> void {
+    EXPECT_CALL(receiver_,
+                process(A<const simulator::protocol::EngineLoadRequest&>(),
+                        A<simulator::protocol::EngineLoadReply&>()))
+        .Times(times)
+        .WillRepeatedly([this](const auto&,
+                               simulator::protocol::EngineLoadReply& reply) {
+          reply.load = load_;
+        });
+  }
+
+  auto set_load(simulator::protocol::EngineLoad load) -> void { load_ = load; }
+
+  static auto make_pacer() -> EnginePacer {
+    return EnginePacer{EnginePacer::Limits{.maxQueueDepth = 10,
+                                           .maxRequestAge = 100us,
+                                           .maxSlowdown = 4,
+                                           .probeInterval = 10ms}};
+  }
+
+  inline static const simulator::protocol::InstrumentHandle Instrument{1};
+  inline static const EnginePacer::Clock::time_point Start{};
+
+ protected:
+  GeneratorEnginePacerProbe() {
+    simulator::middleware::bind_trading_request_channel(
+        std::shared_ptr<Mock::TradingRequestReceiver>{
+            std::addressof(receiver_), [](auto* /*pointer*/) {}});
+  }
+
+  ~GeneratorEnginePacerProbe() override {
+    simulator::middleware::release_trading_request_channel();
+  }
+
+ private:
+  NiceMock<Mock::TradingRequestReceiver> receiver_;
+  simulator::protocol::EngineLoad load_{make_load(0, 0us)};
+};
+
+TEST_F(GeneratorEnginePacerProbe, QueriesLoadOncePerProbeInterval) {
+  EnginePacer pacer = make_pacer();
+  expect_load_queries(2);
+
+  EXPECT_TRUE(pacer.admit(Instrument, Start));
+  EXPECT_TRUE(pacer.admit(Instrument, Start + 5ms));
+  EXPECT_TRUE(pacer.admit(Instrument, Start + 9999us));
+  EXPECT_TRUE(pacer.admit(Instrument, Start + 10ms));
+}
+
+TEST_F(GeneratorEnginePacerProbe, KeepsDecisionUntilNextProbe) {
+  EnginePacer pacer = make_pacer();
+  expect_load_queries(2);
+
+  set_load(make_load(11, 0us));
+  ASSERT_FALSE(pacer.admit(Instrument, Start));
+  set_load(make_load(0, 0us));
+  EXPECT_FALSE(pacer.admit(Instrument, Start + 5ms));
+  EXPECT_EQ(pacer.slowdown(), 2);
+
+  EXPECT_TRUE(pacer.admit(Instrument, Start + 10ms));
+  EXPECT_EQ(pacer.slowdown(), 1);
+}
+
+TEST_F(GeneratorEnginePacerProbe, KeepsLoadOfLastProbe) {
+  EnginePacer pacer = make_pacer();
+  expect_load_queries(1);
+  set_load(make_load(11, 5us));
+
+  ASSERT_FALSE(pacer.admit(Instrument, Start));
+
+  ASSERT_TRUE(pacer.lastLoad().has_value());
+  EXPECT_EQ(pacer.lastLoad()->queue_depth, 11U);
+  EXPECT_EQ(pacer.lastLoad()->oldest_request_age, 5us);
+}
+
+TEST(GeneratorEnginePacer, AdmitsWhenLoadCanNotBeQueried) {
+  EnginePacer pacer = make_pacer();
+
+  EXPECT_TRUE(pacer.admit(simulator::protocol::InstrumentHandle{1},
+                          EnginePacer::Clock::time_point{}));
+  EXPECT_FALSE(pacer.lastLoad().has_value());
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator
@@ -0,0 +1,217 @@
+#include "ih/utils/generation_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <stdexcept>
+
+#include "ih/context/generation_manager.hpp"
+
+namespace Simulator::Generator {
+namespace {
+
+using namespace std::chrono_literals;
+
+// NOLINTBEGIN(*magic-numbers*)
+
+class CountingExecutable : public Executable {
+ public:
+  explicit CountingExecutable(std::size_t executions_limit = 0) noexcept
+      : executions_limit_{executions_limit} {}
+
+  void prepare() noexcept override { ++preparations; }
+
+  void execute() override {
+    ++executions;
+    if (on_execution) {
+      on_execution();
+    }
+    if (throws) {
+      throw std::runtime_error{"execution failed"};
+    }
+  }
+
+  [[nodiscard]]
+  bool finished() const noexcept override {
+    return executions_limit_ != 0 && executions >= executions_limit_;
+  }
+
+  [[nodiscard]]
+  std::chrono::microseconds nextExecTimeout() const override {
+    return 1ms;
+  }
+
+  std::atomic<std::size_t> preparations{0};
+  std::atomic<std::size_t> executions{0};
+  std::atomic<bool> throws{false};
+  std::function<void()> on_execution;
+
+ private:
+  std::size_t executions_limit_;
+};
+
+// The scheduler has no workers, tests run due executables themselves
+// at the time they choose, so no test depends on thread timing.
+class GeneratorGenerationScheduler : public testing::Test {
+ public:
+  static auto make_manager(bool running) -> std::shared_ptr<GenerationManager> {
+    DataLayer::Venue::Patch patch;
+    patch.withVenueId("XLON").withOrdersOnStartupFlag(running);
+    return GenerationManager::create(DataLayer::Venue::create(std::move(patch)));
+  }
+
+  auto add_executable(std::size_t executions_limit = 0) -> CountingExecutable& {
+    auto executable = std::make_unique<CountingExecutable>(executions_limit);
+    auto& reference = *executable;
+    scheduler->add(std::move(executable));
+    return reference;
+  }
+
+  // Advances the time by the executables' timeout and runs due executables.
+  auto run_next() -> std::size_t {
+    now += 1ms;
+    return scheduler->runDue(now);
+  }
+
+  GenerationScheduler::Clock::time_point now =
+      GenerationScheduler::Clock::now();
+  std::shared_ptr<GenerationManager> manager = make_manager(true);
+  std::unique_ptr<GenerationScheduler> scheduler =
+      GenerationScheduler::create(0, manager);
+};
+
+TEST_F(GeneratorGenerationScheduler, ExecutesLaunchedExecutablesAtOnce) {
+  auto& first = add_executable();
+  auto& second = add_executable();
+
+  scheduler->launch();
+
+  EXPECT_EQ(scheduler->runDue(now), 2);
+  EXPECT_EQ(first.executions, 1);
+  EXPECT_EQ(second.executions, 1);
+  EXPECT_EQ(first.preparations, 1);
+}
+
+TEST_F(GeneratorGenerationScheduler, ExecutesExecutableAfterItsTimeout) {
+  auto& executable = add_executable();
+  scheduler->launch();
+  ASSERT_EQ(scheduler->runDue(now), 1);
+
+  EXPECT_EQ(scheduler->runDue(now + 999us), 0);
+  EXPECT_EQ(executable.executions, 1);
+
+  EXPECT_EQ(scheduler->runDue(now + 1ms), 1);
+  EXPECT_EQ(executable.executions, 2);
+}
+
+TEST_F(GeneratorGenerationScheduler, ExecutesExecutableOncePerRun) {
+  auto& executable = add_executable();
+  scheduler->launch();
+
+  EXPECT_EQ(scheduler->runDue(now + 1h), 1);
+  EXPECT_EQ(executable.executions, 1);
+}
+
+TEST_F(GeneratorGenerationScheduler, StopsExecutingFinishedExecutable) {
+  auto& executable = add_executable(3);
+  scheduler->launch();
+
+  ASSERT_EQ(scheduler->runDue(now), 1);
+  ASSERT_EQ(run_next(), 1);
+  ASSERT_EQ(run_next(), 1);
+  ASSERT_EQ(executable.executions, 3);
+
+  EXPECT_EQ(run_next(), 0);
+  EXPECT_EQ(executable.executions, 3);
+}
+
+TEST_F(GeneratorGenerationScheduler, PostponesLaunchTillComponentIsLaunched) {
+  manager = make_manager(false);
+  scheduler = GenerationScheduler::create(0, manager);
+  auto& executable = add_executable();
+
+  scheduler->launch();
+  ASSERT_EQ(scheduler->runDue(now), 0);
+  ASSERT_EQ(executable.preparations, 0);
+
+  manager->launch();
+
+  EXPECT_EQ(scheduler->runDue(now), 1);
+  EXPECT_EQ(executable.executions, 1);
+}
+
+TEST_F(GeneratorGenerationScheduler, ResumesExecutablesAfterSuspension) {
+  auto& executable = add_executable();
+  scheduler->launch();
+  ASSERT_EQ(scheduler->runDue(now), 1);
+
+  manager->suspend();
+  // The executable is parked instead of being executed.
+  ASSERT_EQ(run_next(), 1);
+  ASSERT_EQ(run_next(), 0);
+  ASSERT_EQ(executable.executions, 1);
+
+  manager->launch();
+
+  EXPECT_EQ(scheduler->runDue(now), 1);
+  EXPECT_EQ(executable.executions, 2);
+  EXPECT_EQ(executable.preparations, 2);
+}
+
+TEST_F(GeneratorGenerationScheduler, SuspendsFailedExecutableTillNextLaunch) {
+  auto& executable = add_executable();
+  executable.throws = true;
+  scheduler->launch();
+
+  ASSERT_EQ(scheduler->runDue(now), 1);
+  ASSERT_EQ(run_next(), 0);
+  ASSERT_EQ(executable.executions, 1);
+
+  executable.throws = false;
+  manager->suspend();
+  manager->launch();
+
+  EXPECT_EQ(scheduler->runDue(now), 1);
+  EXPECT_EQ(executable.executions, 2);
+}
+
+TEST_F(GeneratorGenerationScheduler, StopsExecutionOnTermination) {
+  auto& executable = add_executable();
+  scheduler->launch();
+  ASSERT_EQ(scheduler->runDue(now), 1);
+
+  scheduler->terminate();
+
+  EXPECT_EQ(run_next(), 0);
+  EXPECT_EQ(executable.executions, 1);
+}
+
+// The test only waits for the expected executions to happen,
+// thus it does not depend on how fast workers run.
+TEST_F(GeneratorGenerationScheduler, ExecutesAllExecutablesOnFewWorkers) {
+  scheduler = GenerationScheduler::create(2, manager);
+  std::latch executed{3 * 4};
+  auto& first = add_executable(4);
+  auto& second = add_executable(4);
+  auto& third = add_executable(4);
+  for (auto* executable : {&first, &second, &third}) {
+    executable->on_execution = [&executed] { executed.count_down(); };
+  }
+
+  scheduler->launch();
+  executed.wait();
+
+  EXPECT_EQ(first.executions, 4);
+  EXPECT_EQ(second.executions, 4);
+  EXPECT_EQ(third.executions, 4);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator
@@ -0,0 +1,52 @@
+#include "ih/utils/parallel.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Simulator::Generator {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*)
+
+TEST(GeneratorForEachIndexInParallel, DoesNothingForEmptyRange) {
+  std::atomic<std::size_t> calls{0};
+
+  forEachIndexInParallel(0, [&](std::size_t) { ++calls; });
+
+  EXPECT_EQ(calls, 0);
+}
+
+TEST(GeneratorForEachIndexInParallel, VisitsEachIndexOnce) {
+  std::vector<int> visits(1000, 0);
+
+  forEachIndexInParallel(visits.size(),
+                         [&](std::size_t idx) { ++visits[idx]; });
+
+  EXPECT_THAT(visits, Each(Eq(1)));
+}
+
+TEST(GeneratorForEachIndexInParallel, RethrowsExceptionOfFunction) {
+  std::atomic<std::size_t> calls{0};
+
+  EXPECT_THROW(forEachIndexInParallel(100,
+                                      [&](std::size_t idx) {
+                                        ++calls;
+                                        if (idx == 42) {
+                                          throw std::runtime_error("error");
+                                        }
+                                      }),
+               std::runtime_error);
+  EXPECT_GE(calls, 1);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator
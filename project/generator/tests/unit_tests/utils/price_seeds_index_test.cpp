@@ -0,0 +1,68 @@
+#include "ih/utils/price_seeds_index.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Simulator::Generator {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*)
+
+class GeneratorPriceSeedsIndex : public testing::Test {
+ public:
+  static auto make_seed(std::uint64_t id, std::string symbol)
+      -> DataLayer::PriceSeed {
+    DataLayer::PriceSeed::Patch patch;
+    patch.withSymbol(std::move(symbol));
+    return DataLayer::PriceSeed::create(std::move(patch), id);
+  }
+
+  static auto make_seed_without_symbol(std::uint64_t id)
+      -> DataLayer::PriceSeed {
+    return DataLayer::PriceSeed::create(DataLayer::PriceSeed::Patch{}, id);
+  }
+};
+
+TEST_F(GeneratorPriceSeedsIndex, FindsSeedBySymbol) {
+  const PriceSeedsIndex index{{make_seed(1, "AAPL"), make_seed(2, "MSFT")}};
+
+  const auto* seed = index.find("MSFT");
+
+  ASSERT_NE(seed, nullptr);
+  EXPECT_EQ(seed->getPriceSeedId(), 2);
+  EXPECT_FALSE(index.isAmbiguous("MSFT"));
+}
+
+TEST_F(GeneratorPriceSeedsIndex, DoesNotFindUnknownSymbol) {
+  const PriceSeedsIndex index{{make_seed(1, "AAPL")}};
+
+  EXPECT_EQ(index.find("MSFT"), nullptr);
+  EXPECT_FALSE(index.isAmbiguous("MSFT"));
+}
+
+TEST_F(GeneratorPriceSeedsIndex, IgnoresSeedWithoutSymbol) {
+  const PriceSeedsIndex index{{make_seed_without_symbol(1)}};
+
+  EXPECT_EQ(index.find(""), nullptr);
+}
+
+TEST_F(GeneratorPriceSeedsIndex, DoesNotFindSeedOfAmbiguousSymbol) {
+  const PriceSeedsIndex index{
+      {make_seed(1, "AAPL"), make_seed(2, "AAPL"), make_seed(3, "MSFT")}};
+
+  EXPECT_EQ(index.find("AAPL"), nullptr);
+  EXPECT_TRUE(index.isAmbiguous("AAPL"));
+  EXPECT_NE(index.find("MSFT"), nullptr);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator
@@ -0,0 +1,79 @@
+#include "ih/utils/ring_buffer.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace Simulator::Generator {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*)
+
+TEST(GeneratorRingBuffer, PopsValuesInPushOrder) {
+  RingBuffer<int> buffer{3};
+
+  ASSERT_TRUE(buffer.push(1));
+  ASSERT_TRUE(buffer.push(2));
+
+  EXPECT_THAT(buffer.pop(), Optional(1));
+  EXPECT_THAT(buffer.pop(), Optional(2));
+}
+
+TEST(GeneratorRingBuffer, ReportsDrainedAfterClosedAndConsumed) {
+  RingBuffer<int> buffer{3};
+  ASSERT_TRUE(buffer.push(1));
+
+  buffer.close();
+
+  ASSERT_FALSE(buffer.drained());
+  EXPECT_THAT(buffer.pop(), Optional(1));
+  EXPECT_TRUE(buffer.drained());
+  EXPECT_EQ(buffer.pop(), std::nullopt);
+}
+
+TEST(GeneratorRingBuffer, RejectsValuesAfterClosed) {
+  RingBuffer<int> buffer{3};
+
+  buffer.close();
+
+  EXPECT_FALSE(buffer.push(1));
+}
+
+TEST(GeneratorRingBuffer, TransfersMoreValuesThanCapacity) {
+  RingBuffer<int> buffer{2};
+
+  std::jthread producer{[&buffer] {
+    for (int value = 0; value < 1000; ++value) {
+      buffer.push(value);
+    }
+    buffer.close();
+  }};
+
+  std::vector<int> consumed;
+  while (auto value = buffer.pop()) {
+    consumed.push_back(*value);
+  }
+
+  std::vector<int> expected(1000);
+  std::iota(expected.begin(), expected.end(), 0);
+  ASSERT_EQ(consumed, expected);
+}
+
+TEST(GeneratorRingBuffer, UnblocksProducerWhenClosed) {
+  RingBuffer<int> buffer{1};
+  ASSERT_TRUE(buffer.push(1));
+
+  std::jthread producer{[&buffer] { EXPECT_FALSE(buffer.push(2)); }};
+
+  buffer.close();
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace Simulator::Generator
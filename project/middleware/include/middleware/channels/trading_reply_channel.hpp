@@ -15,6 +15,7 @@
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
 #include "protocol/app/order_placement_reject.hpp"
+#include "protocol/app/order_reply_batch.hpp"
 #include "protocol/app/security_status.hpp"
 
 namespace simulator::middleware {
@@ -35,6 +36,8 @@ struct TradingReplyReceiver : public detail::Receiver {
   virtual auto process(protocol::OrderCancellationConfirmation confirmation)
       -> void = 0;
 
+  virtual auto process(protocol::OrderReplyBatch replies) -> void = 0;
+
   virtual auto process(protocol::MarketDataReject reject) -> void = 0;
   virtual auto process(protocol::MarketDataSnapshot snapshot) -> void = 0;
   virtual auto process(protocol::MarketDataUpdate update) -> void = 0;
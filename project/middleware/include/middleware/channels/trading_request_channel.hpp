@@ -4,11 +4,14 @@
 #include <memory>
 
 #include "middleware/channels/detail/receiver.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 #include "protocol/app/security_status_request.hpp"
 
 namespace simulator::middleware {
@@ -19,9 +22,20 @@ struct TradingRequestReceiver : public detail::Receiver {
   virtual auto process(protocol::OrderCancellationRequest request) -> void = 0;
   virtual auto process(protocol::MarketDataRequest request) -> void = 0;
   virtual auto process(protocol::SecurityStatusRequest request) -> void = 0;
+  virtual auto process(protocol::OrderRequestBatch batch) -> void = 0;
 
   virtual auto process(const protocol::InstrumentStateRequest& request,
                        protocol::InstrumentState& reply) -> void = 0;
+
+  virtual auto process(const protocol::InstrumentHandleRequest& request,
+                       protocol::InstrumentHandleReply& reply) -> void = 0;
+
+  virtual auto process(protocol::ResolvedOrderRequests requests) -> void = 0;
+
+  virtual auto process(protocol::ResolvedOrderRequest request) -> void = 0;
+
+  virtual auto process(const protocol::EngineLoadRequest& request,
+                       protocol::EngineLoadReply& reply) -> void = 0;
 };
 
 // Allows the receiver receiving messages sent via the channel,
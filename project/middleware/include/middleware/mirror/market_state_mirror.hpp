@@ -0,0 +1,52 @@
+#ifndef SIMULATOR_MIDDLEWARE_MIRROR_MARKET_STATE_MIRROR_HPP_
+#define SIMULATOR_MIDDLEWARE_MIRROR_MARKET_STATE_MIRROR_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+namespace simulator::middleware {
+
+struct MirroredMarketState {
+  std::optional<double> best_bid_price;
+  std::optional<double> best_offer_price;
+  std::uint32_t bid_depth_levels{0};
+  std::uint32_t offer_depth_levels{0};
+
+  auto operator==(const MirroredMarketState&) const -> bool = default;
+};
+
+// Top of book figures of an instrument published by the trading engine
+// which owns the instrument and read by other components without crossing
+// into the engine thread.
+//
+// The mirror is a seqlock: a single writer never waits for readers,
+// readers retry while a publication is in progress.
+class MarketStateMirror {
+ public:
+  // Must be called by a single writer thread.
+  auto publish(const MirroredMarketState& state) noexcept -> void;
+
+  // Returns nullopt until the first state is published.
+  [[nodiscard]]
+  auto read() const noexcept -> std::optional<MirroredMarketState>;
+
+ private:
+  std::atomic<std::uint64_t> sequence_{0};
+
+  std::atomic<double> best_bid_price_{0.};
+  std::atomic<double> best_offer_price_{0.};
+  std::atomic<std::uint32_t> bid_depth_levels_{0};
+  std::atomic<std::uint32_t> offer_depth_levels_{0};
+  std::atomic<bool> has_best_bid_price_{false};
+  std::atomic<bool> has_best_offer_price_{false};
+};
+
+// Returns the mirror of an instrument identified by its listing identifier.
+// The mirror is created on first access and is never destroyed,
+// so callers may keep the reference.
+auto market_state_mirror(std::uint64_t listing_id) -> MarketStateMirror&;
+
+}  // namespace simulator::middleware
+
+#endif  // SIMULATOR_MIDDLEWARE_MIRROR_MARKET_STATE_MIRROR_HPP_
@@ -13,6 +13,7 @@
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
 #include "protocol/app/order_placement_reject.hpp"
+#include "protocol/app/order_reply_batch.hpp"
 #include "protocol/app/security_status.hpp"
 
 namespace simulator::middleware {
@@ -33,6 +34,9 @@ auto send_trading_reply(protocol::OrderCancellationReject reply) -> void;
 
 auto send_trading_reply(protocol::OrderCancellationConfirmation reply) -> void;
 
+// Delivers order replies of a single trading command at once.
+auto send_trading_reply(protocol::OrderReplyBatch replies) -> void;
+
 auto send_trading_reply(protocol::MarketDataReject reply) -> void;
 
 auto send_trading_reply(protocol::MarketDataSnapshot reply) -> void;
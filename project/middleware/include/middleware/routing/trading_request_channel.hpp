@@ -2,11 +2,14 @@
 #define SIMULATOR_MIDDLEWARE_ROUTING_TRADING_REQUEST_CHANNEL_HPP_
 
 #include "middleware/routing/errors.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 #include "protocol/app/security_status_request.hpp"
 
 namespace simulator::middleware {
@@ -21,9 +24,30 @@ auto send_trading_request(protocol::MarketDataRequest request) -> void;
 
 auto send_trading_request(protocol::SecurityStatusRequest request) -> void;
 
+// Delivers all the requests of the batch to the receiver at once.
+auto send_trading_request(protocol::OrderRequestBatch batch) -> void;
+
 auto send_trading_request(const protocol::InstrumentStateRequest& request,
                           protocol::InstrumentState& reply) -> void;
 
+// Resolves the instrument of the request, the reply holds no handle
+// if the instrument is unknown to the receiver.
+auto send_trading_request(const protocol::InstrumentHandleRequest& request,
+                          protocol::InstrumentHandleReply& reply) -> void;
+
+// Delivers requests to the instrument resolved beforehand, the receiver
+// does not resolve instruments of the requests.
+auto send_trading_request(protocol::ResolvedOrderRequests requests) -> void;
+
+// Delivers a single request to the instrument resolved beforehand,
+// the request is not wrapped into a batch.
+auto send_trading_request(protocol::ResolvedOrderRequest request) -> void;
+
+// Reports the load of the resolved instrument's trading engine, the reply
+// holds no load if the instrument handle is unknown to the receiver.
+auto send_trading_request(const protocol::EngineLoadRequest& request,
+                          protocol::EngineLoadReply& reply) -> void;
+
 }  // namespace simulator::middleware
 
 #endif  // SIMULATOR_MIDDLEWARE_ROUTING_TRADING_REQUEST_CHANNEL_HPP_
\ No newline at end of file
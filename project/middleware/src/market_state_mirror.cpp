@@ -0,0 +1,76 @@
+#include "middleware/mirror/market_state_mirror.hpp"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace simulator::middleware {
+
+auto MarketStateMirror::publish(const MirroredMarketState& state) noexcept
+    -> void {
+  const auto sequence = sequence_.load(std::memory_order_relaxed);
+  sequence_.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  best_bid_price_.store(state.best_bid_price.value_or(0.),
+                        std::memory_order_relaxed);
+  best_offer_price_.store(state.best_offer_price.value_or(0.),
+                          std::memory_order_relaxed);
+  bid_depth_levels_.store(state.bid_depth_levels, std::memory_order_relaxed);
+  offer_depth_levels_.store(state.offer_depth_levels,
+                            std::memory_order_relaxed);
+  has_best_bid_price_.store(state.best_bid_price.has_value(),
+                            std::memory_order_relaxed);
+  has_best_offer_price_.store(state.best_offer_price.has_value(),
+                              std::memory_order_relaxed);
+
+  sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+auto MarketStateMirror::read() const noexcept
+    -> std::optional<MirroredMarketState> {
+  while (true) {
+    const auto before = sequence_.load(std::memory_order_acquire);
+    if (before == 0) {
+      return std::nullopt;
+    }
+    if (before % 2 != 0) {
+      continue;
+    }
+
+    MirroredMarketState state;
+    const auto best_bid_price =
+        best_bid_price_.load(std::memory_order_relaxed);
+    const auto best_offer_price =
+        best_offer_price_.load(std::memory_order_relaxed);
+    state.bid_depth_levels = bid_depth_levels_.load(std::memory_order_relaxed);
+    state.offer_depth_levels =
+        offer_depth_levels_.load(std::memory_order_relaxed);
+    if (has_best_bid_price_.load(std::memory_order_relaxed)) {
+      state.best_bid_price = best_bid_price;
+    }
+    if (has_best_offer_price_.load(std::memory_order_relaxed)) {
+      state.best_offer_price = best_offer_price;
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) == before) {
+      return state;
+    }
+  }
+}
+
+auto market_state_mirror(std::uint64_t listing_id) -> MarketStateMirror& {
+  static std::mutex mutex;
+  static std::unordered_map<std::uint64_t, std::unique_ptr<MarketStateMirror>>
+      mirrors;
+
+  const std::lock_guard lock{mutex};
+  auto& mirror = mirrors[listing_id];
+  if (!mirror) {
+    mirror = std::make_unique<MarketStateMirror>();
+  }
+  return *mirror;
+}
+
+}  // namespace simulator::middleware
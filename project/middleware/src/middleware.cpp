@@ -1,3 +1,6 @@
+#include <fmt/base.h>
+
+#include <cstddef>
 #include <string_view>
 #include <utility>
 
@@ -16,6 +19,32 @@
 namespace simulator::middleware {
 namespace {
 
+// Describes a batch of messages in channel logs
+// without formatting each message of the batch.
+struct BatchDescription {
+  std::size_t size{0};
+  std::string_view messages;
+};
+
+}  // namespace
+}  // namespace simulator::middleware
+
+template <>
+struct fmt::formatter<simulator::middleware::BatchDescription> {
+  using formattable = simulator::middleware::BatchDescription;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& batch, format_context& context) const
+      -> decltype(context.out()) {
+    return format_to(
+        context.out(), "a batch of {} {}", batch.size, batch.messages);
+  }
+};
+
+namespace simulator::middleware {
+namespace {
+
 struct GeneratorAdminChannelUnboundError : ChannelUnboundError {
   auto what() const noexcept -> const char* override { return message.data(); }
 
@@ -89,8 +118,11 @@ auto send_via_trading_admin_channel(Request&& request, Reply&& reply) -> void {
   throw TradingAdminChannelUnboundError{};
 }
 
-template <typename Message>
-auto send_via_trading_reply_channel(Message&& message) -> void {
+// The description is formatted in place of a message,
+// which is not formatted as a whole.
+template <typename Description, typename Message>
+auto send_described_via_trading_reply_channel(const Description& description,
+                                              Message&& message) -> void {
   if (auto* receiver = TradingReplyChannel::receiver()) [[likely]] {
     receiver->process(std::forward<Message>(message));
     return;
@@ -100,14 +132,23 @@ auto send_via_trading_reply_channel(Message&& message) -> void {
       "unable to send message via trading reply channel, "
       "probably channel has not been bound or has been released already, "
       "can not dispatch {}",
-      message);
+      description);
 
   throw TradingReplyChannelUnboundError{};
 }
 
-template <typename Request, typename... Args>
-auto send_via_trading_request_channel(Request&& request, Args&&... args)
-    -> void {
+template <typename Message>
+auto send_via_trading_reply_channel(Message&& message) -> void {
+  send_described_via_trading_reply_channel(message,
+                                           std::forward<Message>(message));
+}
+
+// The description is formatted in place of a request,
+// which is not formatted as a whole.
+template <typename Description, typename Request, typename... Args>
+auto send_described_via_trading_request_channel(const Description& description,
+                                                Request&& request,
+                                                Args&&... args) -> void {
   if (auto* receiver = TradingRequestChannel::receiver()) [[likely]] {
     receiver->process(std::forward<Request>(request),
                       std::forward<Args>(args)...);
@@ -118,11 +159,19 @@ auto send_via_trading_request_channel(Request&& request, Args&&... args)
       "unable to send message via trading request channel, "
       "probably channel has not been bound or has been released already, "
       "can not dispatch {}",
-      request);
+      description);
 
   throw TradingRequestChannelUnboundError{};
 }
 
+template <typename Request, typename... Args>
+auto send_via_trading_request_channel(Request&& request, Args&&... args)
+    -> void {
+  send_described_via_trading_request_channel(request,
+                                             std::forward<Request>(request),
+                                             std::forward<Args>(args)...);
+}
+
 template <typename Event>
 auto emit_via_trading_session_event_channel(Event&& event) -> void {
   if (auto* receiver = TradingSessionEventChannel::receiver()) [[likely]] {
@@ -272,6 +321,15 @@ auto send_trading_reply(protocol::OrderCancellationConfirmation reply) -> void {
   send_via_trading_reply_channel(std::move(reply));
 }
 
+auto send_trading_reply(protocol::OrderReplyBatch replies) -> void {
+  log::debug(
+      "trading reply channel is transferring a batch of {} order replies",
+      replies.size());
+  const BatchDescription description{.size = replies.size(),
+                                     .messages = "order replies"};
+  send_described_via_trading_reply_channel(description, std::move(replies));
+}
+
 auto send_trading_reply(protocol::MarketDataReject reply) -> void {
   log::debug("trading reply channel is transferring MarketDataReject message");
   send_via_trading_reply_channel(std::move(reply));
@@ -338,6 +396,15 @@ auto send_trading_request(protocol::SecurityStatusRequest request) -> void {
   send_via_trading_request_channel(std::move(request));
 }
 
+auto send_trading_request(protocol::OrderRequestBatch batch) -> void {
+  log::debug(
+      "trading request channel is transferring a batch of {} order requests",
+      batch.size());
+  const BatchDescription description{.size = batch.size(),
+                                     .messages = "order requests"};
+  send_described_via_trading_request_channel(description, std::move(batch));
+}
+
 auto send_trading_request(const protocol::InstrumentStateRequest& request,
                           protocol::InstrumentState& reply) -> void {
   log::debug(
@@ -346,6 +413,40 @@ auto send_trading_request(const protocol::InstrumentStateRequest& request,
   send_via_trading_request_channel(request, reply);
 }
 
+auto send_trading_request(const protocol::InstrumentHandleRequest& request,
+                          protocol::InstrumentHandleReply& reply) -> void {
+  log::debug(
+      "trading request channel is transferring InstrumentHandleRequest "
+      "internal request");
+  send_via_trading_request_channel(request, reply);
+}
+
+auto send_trading_request(protocol::ResolvedOrderRequests requests) -> void {
+  log::debug(
+      "trading request channel is transferring {} order requests to "
+      "the resolved instrument {}",
+      requests.requests.size(),
+      requests.instrument.value);
+  send_via_trading_request_channel(std::move(requests));
+}
+
+auto send_trading_request(protocol::ResolvedOrderRequest request) -> void {
+  log::debug(
+      "trading request channel is transferring an order request to "
+      "the resolved instrument {}",
+      request.instrument.value);
+  send_via_trading_request_channel(std::move(request));
+}
+
+auto send_trading_request(const protocol::EngineLoadRequest& request,
+                          protocol::EngineLoadReply& reply) -> void {
+  log::trace(
+      "trading request channel is transferring EngineLoadRequest internal "
+      "request for the resolved instrument {}",
+      request.instrument.value);
+  send_via_trading_request_channel(request, reply);
+}
+
 // Trading session event channel implementation
 
 auto bind_trading_session_event_channel(
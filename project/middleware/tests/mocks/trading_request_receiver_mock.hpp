@@ -14,8 +14,13 @@ struct TradingRequestReceiverMock : public TradingRequestReceiver {
   MOCK_METHOD(void, process, (protocol::OrderCancellationRequest), (override));
   MOCK_METHOD(void, process, (protocol::MarketDataRequest), (override));
   MOCK_METHOD(void, process, (protocol::SecurityStatusRequest), (override));
+  MOCK_METHOD(void, process, (protocol::OrderRequestBatch), (override));
 
   MOCK_METHOD(void, process, (const protocol::InstrumentStateRequest&, protocol::InstrumentState&), (override));
+  MOCK_METHOD(void, process, (const protocol::InstrumentHandleRequest&, protocol::InstrumentHandleReply&), (override));
+  MOCK_METHOD(void, process, (protocol::ResolvedOrderRequests), (override));
+  MOCK_METHOD(void, process, (protocol::ResolvedOrderRequest), (override));
+  MOCK_METHOD(void, process, (const protocol::EngineLoadRequest&, protocol::EngineLoadReply&), (override));
   // clang-format on
 };
 
@@ -0,0 +1,81 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "middleware/mirror/market_state_mirror.hpp"
+
+namespace simulator::middleware::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*)
+
+struct MiddlewareMarketStateMirror : public Test {
+  MarketStateMirror mirror;
+};
+
+TEST_F(MiddlewareMarketStateMirror, ReadsNothingBeforePublication) {
+  ASSERT_EQ(mirror.read(), std::nullopt);
+}
+
+TEST_F(MiddlewareMarketStateMirror, ReadsPublishedState) {
+  const MirroredMarketState state{.best_bid_price = 10.5,
+                                  .best_offer_price = std::nullopt,
+                                  .bid_depth_levels = 3,
+                                  .offer_depth_levels = 0};
+
+  mirror.publish(state);
+
+  ASSERT_THAT(mirror.read(), Optional(Eq(state)));
+}
+
+TEST_F(MiddlewareMarketStateMirror, ReadsLatestPublishedState) {
+  mirror.publish({.best_bid_price = 10.5,
+                  .best_offer_price = 11.,
+                  .bid_depth_levels = 3,
+                  .offer_depth_levels = 2});
+  const MirroredMarketState latest{.best_bid_price = std::nullopt,
+                                   .best_offer_price = 12.,
+                                   .bid_depth_levels = 0,
+                                   .offer_depth_levels = 1};
+
+  mirror.publish(latest);
+
+  ASSERT_THAT(mirror.read(), Optional(Eq(latest)));
+}
+
+TEST_F(MiddlewareMarketStateMirror, ReadsConsistentStateWhilePublishing) {
+  std::atomic<bool> done{false};
+  std::jthread writer{[&] {
+    for (std::uint32_t levels = 1; levels <= 100000; ++levels) {
+      mirror.publish({.best_bid_price = static_cast<double>(levels),
+                      .best_offer_price = static_cast<double>(levels),
+                      .bid_depth_levels = levels,
+                      .offer_depth_levels = levels});
+    }
+    done = true;
+  }};
+
+  while (!done) {
+    if (const auto state = mirror.read()) {
+      ASSERT_EQ(state->best_bid_price,
+                static_cast<double>(state->bid_depth_levels));
+      ASSERT_EQ(state->best_offer_price,
+                static_cast<double>(state->bid_depth_levels));
+      ASSERT_EQ(state->offer_depth_levels, state->bid_depth_levels);
+    }
+  }
+}
+
+TEST(MiddlewareMarketStateMirrorRegistry, ReturnsSameMirrorForListing) {
+  ASSERT_EQ(&market_state_mirror(42), &market_state_mirror(42));
+  ASSERT_NE(&market_state_mirror(42), &market_state_mirror(43));
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace simulator::middleware::test
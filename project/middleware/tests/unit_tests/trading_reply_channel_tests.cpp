@@ -52,5 +52,26 @@ TYPED_TEST(TradingReplyChannel, ReportsChannelNotBoundWhenSendingReply) {
   EXPECT_THROW(send_trading_reply(reply), ChannelUnboundError);
 }
 
+struct TradingReplyChannelBatch : public TradingReplyChannel<void> {};
+
+TEST_F(TradingReplyChannelBatch, SendsOrderReplyBatch) {
+  bind_channel();
+  const protocol::OrderReplyBatch replies{
+      make_app_message<protocol::OrderPlacementConfirmation>(),
+      make_app_message<protocol::ExecutionReport>()};
+
+  EXPECT_CALL(receiver, process(Matcher<protocol::OrderReplyBatch>(
+                            SizeIs(replies.size()))))
+      .Times(1);
+  EXPECT_NO_THROW(send_trading_reply(replies));
+}
+
+TEST_F(TradingReplyChannelBatch, ReportsChannelNotBoundWhenSendingBatch) {
+  const protocol::OrderReplyBatch replies{
+      make_app_message<protocol::ExecutionReport>()};
+
+  EXPECT_THROW(send_trading_reply(replies), ChannelUnboundError);
+}
+
 }  // namespace
 }  // namespace simulator::middleware::test
\ No newline at end of file
@@ -58,6 +58,101 @@ TEST_F(TradingRequestChannel, SendsAsyncMarketDataRequest) {
   ASSERT_NO_THROW(send_trading_request(request));
 }
 
+TEST_F(TradingRequestChannel, SendsAsyncOrderRequestBatch) {
+  bind_channel();
+  const protocol::OrderRequestBatch batch{
+      make_app_message<protocol::OrderPlacementRequest>(),
+      make_app_message<protocol::OrderCancellationRequest>()};
+
+  EXPECT_CALL(receiver, process(Matcher<protocol::OrderRequestBatch>(
+                            SizeIs(batch.size()))))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(batch));
+}
+
+TEST_F(TradingRequestChannel, ReportsChannelNotBoundWhenSendingBatch) {
+  const protocol::OrderRequestBatch batch{
+      make_app_message<protocol::OrderPlacementRequest>()};
+
+  ASSERT_THROW(send_trading_request(batch), ChannelUnboundError);
+}
+
+TEST_F(TradingRequestChannel, SendsSyncInstrumentHandleRequest) {
+  bind_channel();
+  const protocol::InstrumentHandleRequest request;
+  protocol::InstrumentHandleReply reply;
+
+  EXPECT_CALL(receiver,
+              process(A<const protocol::InstrumentHandleRequest&>(),
+                      A<protocol::InstrumentHandleReply&>()))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(request, reply));
+}
+
+TEST_F(TradingRequestChannel, SendsAsyncResolvedOrderRequests) {
+  bind_channel();
+  const protocol::ResolvedOrderRequests requests{
+      .instrument = protocol::InstrumentHandle{42},
+      .requests = {make_app_message<protocol::OrderPlacementRequest>()}};
+
+  EXPECT_CALL(receiver,
+              process(Matcher<protocol::ResolvedOrderRequests>(Field(
+                  &protocol::ResolvedOrderRequests::instrument,
+                  Eq(requests.instrument)))))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(requests));
+}
+
+TEST_F(TradingRequestChannel,
+       ReportsChannelNotBoundWhenSendingResolvedOrderRequests) {
+  const protocol::ResolvedOrderRequests requests{};
+
+  ASSERT_THROW(send_trading_request(requests), ChannelUnboundError);
+}
+
+TEST_F(TradingRequestChannel, SendsAsyncResolvedOrderRequest) {
+  bind_channel();
+  const protocol::ResolvedOrderRequest request{
+      .instrument = protocol::InstrumentHandle{42},
+      .request = make_app_message<protocol::OrderCancellationRequest>()};
+
+  EXPECT_CALL(receiver,
+              process(Matcher<protocol::ResolvedOrderRequest>(Field(
+                  &protocol::ResolvedOrderRequest::instrument,
+                  Eq(request.instrument)))))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(request));
+}
+
+TEST_F(TradingRequestChannel,
+       ReportsChannelNotBoundWhenSendingResolvedOrderRequest) {
+  const protocol::ResolvedOrderRequest request{
+      .instrument = protocol::InstrumentHandle{42},
+      .request = make_app_message<protocol::OrderCancellationRequest>()};
+
+  ASSERT_THROW(send_trading_request(request), ChannelUnboundError);
+}
+
+TEST_F(TradingRequestChannel, SendsSyncEngineLoadRequest) {
+  bind_channel();
+  const protocol::EngineLoadRequest request{protocol::InstrumentHandle{42}};
+  protocol::EngineLoadReply reply;
+
+  EXPECT_CALL(receiver,
+              process(A<const protocol::EngineLoadRequest&>(),
+                      A<protocol::EngineLoadReply&>()))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(request, reply));
+}
+
+TEST_F(TradingRequestChannel,
+       ReportsChannelNotBoundWhenSendingEngineLoadRequest) {
+  const protocol::EngineLoadRequest request;
+  protocol::EngineLoadReply reply;
+
+  ASSERT_THROW(send_trading_request(request, reply), ChannelUnboundError);
+}
+
 TEST_F(TradingRequestChannel, SendsSyncInstrumentStateRequest) {
   bind_channel();
   protocol::InstrumentStateRequest request;
@@ -0,0 +1,43 @@
+#ifndef SIMULATOR_PROTOCOL_APP_ENGINE_LOAD_REQUEST_HPP_
+#define SIMULATOR_PROTOCOL_APP_ENGINE_LOAD_REQUEST_HPP_
+
+#include <fmt/base.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "protocol/app/resolved_order_requests.hpp"
+
+namespace simulator::protocol {
+
+// Asks the trading system how far behind the trading engine
+// of a resolved instrument is.
+struct EngineLoadRequest {
+  InstrumentHandle instrument{};
+};
+
+// Requests, which are waiting to be executed by a trading engine.
+struct EngineLoad {
+  std::uint64_t queue_depth{0};
+  std::chrono::microseconds oldest_request_age{0};
+};
+
+// Holds no load, when the instrument handle is unknown.
+struct EngineLoadReply {
+  std::optional<EngineLoad> load{};
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::EngineLoadRequest> {
+  using formattable = simulator::protocol::EngineLoadRequest;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& request, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_APP_ENGINE_LOAD_REQUEST_HPP_
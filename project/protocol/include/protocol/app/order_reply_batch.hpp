@@ -0,0 +1,31 @@
+#ifndef SIMULATOR_PROTOCOL_APP_ORDER_REPLY_BATCH_HPP_
+#define SIMULATOR_PROTOCOL_APP_ORDER_REPLY_BATCH_HPP_
+
+#include <variant>
+#include <vector>
+
+#include "protocol/app/execution_report.hpp"
+#include "protocol/app/order_cancellation_confirmation.hpp"
+#include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_modification_confirmation.hpp"
+#include "protocol/app/order_modification_reject.hpp"
+#include "protocol/app/order_placement_confirmation.hpp"
+#include "protocol/app/order_placement_reject.hpp"
+
+namespace simulator::protocol {
+
+using OrderReply = std::variant<OrderPlacementConfirmation,
+                                OrderPlacementReject,
+                                OrderModificationConfirmation,
+                                OrderModificationReject,
+                                OrderCancellationConfirmation,
+                                OrderCancellationReject,
+                                ExecutionReport>;
+
+// Order replies produced by a single trading command,
+// which are delivered together and processed in order.
+using OrderReplyBatch = std::vector<OrderReply>;
+
+}  // namespace simulator::protocol
+
+#endif  // SIMULATOR_PROTOCOL_APP_ORDER_REPLY_BATCH_HPP_
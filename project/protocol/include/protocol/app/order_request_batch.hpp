@@ -0,0 +1,22 @@
+#ifndef SIMULATOR_PROTOCOL_APP_ORDER_REQUEST_BATCH_HPP_
+#define SIMULATOR_PROTOCOL_APP_ORDER_REQUEST_BATCH_HPP_
+
+#include <variant>
+#include <vector>
+
+#include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_modification_request.hpp"
+#include "protocol/app/order_placement_request.hpp"
+
+namespace simulator::protocol {
+
+using OrderRequest = std::variant<OrderPlacementRequest,
+                                  OrderModificationRequest,
+                                  OrderCancellationRequest>;
+
+// Order requests which are delivered together and processed in order.
+using OrderRequestBatch = std::vector<OrderRequest>;
+
+}  // namespace simulator::protocol
+
+#endif  // SIMULATOR_PROTOCOL_APP_ORDER_REQUEST_BATCH_HPP_
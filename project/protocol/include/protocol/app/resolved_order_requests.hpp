@@ -0,0 +1,93 @@
+#ifndef SIMULATOR_PROTOCOL_APP_RESOLVED_ORDER_REQUESTS_HPP_
+#define SIMULATOR_PROTOCOL_APP_RESOLVED_ORDER_REQUESTS_HPP_
+
+#include <fmt/base.h>
+
+#include <cstdint>
+#include <optional>
+
+#include "core/domain/instrument_descriptor.hpp"
+#include "protocol/app/order_request_batch.hpp"
+
+namespace simulator::protocol {
+
+// Identifies an instrument within the trading system, which has resolved
+// the instrument. A handle stays valid while the trading system runs.
+struct InstrumentHandle {
+  std::uint64_t value{0};
+
+  [[nodiscard]]
+  auto operator==(const InstrumentHandle&) const -> bool = default;
+};
+
+// Asks the trading system to resolve an instrument once, so that requests
+// to the instrument can be sent without resolving it again.
+struct InstrumentHandleRequest {
+  InstrumentDescriptor instrument{};
+};
+
+// Holds no handle, when the instrument can not be resolved.
+struct InstrumentHandleReply {
+  std::optional<InstrumentHandle> handle{};
+};
+
+// Order requests to a resolved instrument, which are delivered to
+// the instrument's trading engine at once and processed in order.
+// Instruments of the requests are not resolved by the trading system.
+struct ResolvedOrderRequests {
+  InstrumentHandle instrument{};
+  OrderRequestBatch requests{};
+};
+
+// A single order request to a resolved instrument, which is delivered to
+// the instrument's trading engine without being wrapped into a batch.
+struct ResolvedOrderRequest {
+  InstrumentHandle instrument{};
+  OrderRequest request;
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::InstrumentHandle> {
+  using formattable = simulator::protocol::InstrumentHandle;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& handle, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::InstrumentHandleRequest> {
+  using formattable = simulator::protocol::InstrumentHandleRequest;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& request, format_context& context) const
+      -> decltype(context.out());
+};
+
+// Formats the number of requests only, requests themselves are not formatted.
+template <>
+struct fmt::formatter<simulator::protocol::ResolvedOrderRequests> {
+  using formattable = simulator::protocol::ResolvedOrderRequests;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& requests, format_context& context) const
+      -> decltype(context.out());
+};
+
+// Formats the instrument handle and the request with its own formatter.
+template <>
+struct fmt::formatter<simulator::protocol::ResolvedOrderRequest> {
+  using formattable = simulator::protocol::ResolvedOrderRequest;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& request, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_APP_RESOLVED_ORDER_REQUESTS_HPP_
@@ -1,8 +1,11 @@
 #include <fmt/base.h>
 
+#include <variant>
+
 #include "core/common/name.hpp"
 #include "core/tools/format.hpp"
 #include "protocol/app/business_message_reject.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/execution_report.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_reject.hpp"
@@ -18,6 +21,7 @@
 #include "protocol/app/order_placement_confirmation.hpp"
 #include "protocol/app/order_placement_reject.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 #include "protocol/app/security_status.hpp"
 #include "protocol/app/security_status_request.hpp"
 #include "protocol/app/session_terminated_event.hpp"
@@ -170,6 +174,51 @@ auto fmt::formatter<simulator::protocol::InstrumentStateRequest>::format(
                    request.instrument);
 }
 
+auto fmt::formatter<simulator::protocol::InstrumentHandle>::format(
+    const formattable& handle,
+    format_context& context) const -> decltype(context.out()) {
+  return format_to(context.out(), "InstrumentHandle={{ {} }}", handle.value);
+}
+
+auto fmt::formatter<simulator::protocol::InstrumentHandleRequest>::format(
+    const formattable& request,
+    format_context& context) const -> decltype(context.out()) {
+  using simulator::core::name_of;
+  return format_to(context.out(),
+                   "InstrumentHandleRequest={{ {}={} }}",
+                   name_of(request.instrument),
+                   request.instrument);
+}
+
+auto fmt::formatter<simulator::protocol::ResolvedOrderRequests>::format(
+    const formattable& requests,
+    format_context& context) const -> decltype(context.out()) {
+  return format_to(context.out(),
+                   "ResolvedOrderRequests={{ {}, RequestsCount={} }}",
+                   requests.instrument,
+                   requests.requests.size());
+}
+
+auto fmt::formatter<simulator::protocol::ResolvedOrderRequest>::format(
+    const formattable& request,
+    format_context& context) const -> decltype(context.out()) {
+  return std::visit(
+      [&](const auto& order_request) {
+        return format_to(context.out(),
+                         "ResolvedOrderRequest={{ {}, {} }}",
+                         request.instrument,
+                         order_request);
+      },
+      request.request);
+}
+
+auto fmt::formatter<simulator::protocol::EngineLoadRequest>::format(
+    const formattable& request,
+    format_context& context) const -> decltype(context.out()) {
+  return format_to(
+      context.out(), "EngineLoadRequest={{ {} }}", request.instrument);
+}
+
 auto fmt::formatter<simulator::protocol::InstrumentState>::format(
     const formattable& state,
     format_context& context) const -> decltype(context.out()) {
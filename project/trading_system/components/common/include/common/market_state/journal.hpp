@@ -0,0 +1,58 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JOURNAL_HPP_
+#define SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JOURNAL_HPP_
+
+#include <functional>
+#include <variant>
+
+#include "common/attributes.hpp"
+#include "common/market_state/snapshot.hpp"
+#include "common/trade.hpp"
+
+namespace simulator::trading_system::market_state {
+
+// A single order book mutation made by a trading engine.
+// Mutations carry absolute values (a full order state, a remaining quantity),
+// so applying the same record twice yields the same instrument state.
+struct JournalRecord {
+  struct OrderAdded {
+    LimitOrder order;
+
+    [[nodiscard]]
+    auto operator==(const OrderAdded&) const -> bool = default;
+  };
+
+  struct OrderReduced {
+    OrderId order_id{0};
+    Side side{Side::Option::Buy};
+    LeavesQuantity leaves_quantity{0.};
+
+    [[nodiscard]]
+    auto operator==(const OrderReduced&) const -> bool = default;
+  };
+
+  struct OrderRemoved {
+    OrderId order_id{0};
+    Side side{Side::Option::Buy};
+
+    [[nodiscard]]
+    auto operator==(const OrderRemoved&) const -> bool = default;
+  };
+
+  using Mutation = std::variant<OrderAdded, OrderReduced, OrderRemoved, Trade>;
+
+  InstrumentId instrument_id{0};
+  Mutation mutation;
+
+  [[nodiscard]]
+  auto operator==(const JournalRecord&) const -> bool = default;
+};
+
+using JournalSink = std::function<void(JournalRecord)>;
+
+// Applies the record mutation to the instrument state,
+// the record is expected to belong to the state instrument.
+auto apply(const JournalRecord& record, InstrumentState& state) -> void;
+
+}  // namespace simulator::trading_system::market_state
+
+#endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JOURNAL_HPP_
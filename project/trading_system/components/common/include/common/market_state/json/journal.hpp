@@ -0,0 +1,44 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_JOURNAL_HPP_
+#define SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_JOURNAL_HPP_
+
+#include "common/market_state/journal.hpp"
+#include "common/market_state/json/limit_order.hpp"
+#include "core/common/json/type_struct.hpp"
+
+template <>
+struct simulator::core::json::Struct<
+    simulator::trading_system::market_state::JournalRecord::OrderAdded> {
+  static constexpr auto fields = std::make_tuple(
+      Field(&simulator::trading_system::market_state::JournalRecord::
+                OrderAdded::order,
+            "order"));
+};
+
+template <>
+struct simulator::core::json::Struct<
+    simulator::trading_system::market_state::JournalRecord::OrderReduced> {
+  static constexpr auto fields = std::make_tuple(
+      Field(&simulator::trading_system::market_state::JournalRecord::
+                OrderReduced::order_id,
+            "order_id"),
+      Field(&simulator::trading_system::market_state::JournalRecord::
+                OrderReduced::side,
+            "side"),
+      Field(&simulator::trading_system::market_state::JournalRecord::
+                OrderReduced::leaves_quantity,
+            "leaves_quantity"));
+};
+
+template <>
+struct simulator::core::json::Struct<
+    simulator::trading_system::market_state::JournalRecord::OrderRemoved> {
+  static constexpr auto fields = std::make_tuple(
+      Field(&simulator::trading_system::market_state::JournalRecord::
+                OrderRemoved::order_id,
+            "order_id"),
+      Field(&simulator::trading_system::market_state::JournalRecord::
+                OrderRemoved::side,
+            "side"));
+};
+
+#endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_JOURNAL_HPP_
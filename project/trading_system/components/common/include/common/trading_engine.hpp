@@ -1,13 +1,17 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_TRADING_ENGINE_HPP_
 #define SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_TRADING_ENGINE_HPP_
 
+#include <functional>
+
 #include "common/events.hpp"
 #include "common/market_state/snapshot.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
 #include "protocol/app/security_status_request.hpp"
 #include "protocol/app/session_terminated_event.hpp"
 
@@ -33,11 +37,23 @@ class TradingEngine {
 
   virtual auto execute(protocol::SecurityStatusRequest request) -> void = 0;
 
+  // Executes all the order requests of the batch in order as a single task.
+  virtual auto execute(std::vector<protocol::OrderRequest> requests)
+      -> void = 0;
+
   virtual auto provide_state(protocol::InstrumentState& reply) -> void = 0;
 
+  // Reports commands waiting to be executed by the engine,
+  // is called from outside of the engine thread.
+  [[nodiscard]]
+  virtual auto load() const -> protocol::EngineLoad = 0;
+
   virtual auto store_state(market_state::InstrumentState& state) -> void = 0;
 
-  virtual auto recover_state(market_state::InstrumentState state) -> void = 0;
+  // Recovers the engine state asynchronously,
+  // the callback is invoked once the state is recovered.
+  virtual auto recover_state(market_state::InstrumentState state,
+                             std::function<void()> on_recovered) -> void = 0;
 
   virtual auto handle(const protocol::SessionTerminatedEvent& event)
       -> void = 0;
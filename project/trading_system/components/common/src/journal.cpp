@@ -0,0 +1,86 @@
+#include "common/market_state/journal.hpp"
+
+#include <algorithm>
+
+#include "core/tools/overload.hpp"
+
+namespace simulator::trading_system::market_state {
+
+namespace {
+
+auto take_orders(OrderBook& order_book, Side side) -> std::vector<LimitOrder>& {
+  return side == Side::Option::Buy ? order_book.buy_orders
+                                   : order_book.sell_orders;
+}
+
+auto find_order(std::vector<LimitOrder>& orders, OrderId order_id) {
+  return std::ranges::find_if(orders, [order_id](const LimitOrder& order) {
+    return order.order_id == order_id;
+  });
+}
+
+auto apply(const JournalRecord::OrderAdded& added, OrderBook& order_book)
+    -> void {
+  auto& orders = take_orders(order_book, added.order.side);
+  if (auto order_it = find_order(orders, added.order.order_id);
+      order_it != std::end(orders)) {
+    *order_it = added.order;
+    return;
+  }
+  orders.push_back(added.order);
+}
+
+auto apply(const JournalRecord::OrderReduced& reduced, OrderBook& order_book)
+    -> void {
+  auto& orders = take_orders(order_book, reduced.side);
+  const auto order_it = find_order(orders, reduced.order_id);
+  if (order_it == std::end(orders)) {
+    return;
+  }
+
+  const auto total = static_cast<double>(order_it->total_quantity);
+  const auto leaves = static_cast<double>(reduced.leaves_quantity);
+  order_it->cum_executed_quantity =
+      CumExecutedQuantity{std::max(total - leaves, 0.0)};
+  order_it->order_status = OrderStatus::Option::PartiallyFilled;
+}
+
+auto apply(const JournalRecord::OrderRemoved& removed, OrderBook& order_book)
+    -> void {
+  auto& orders = take_orders(order_book, removed.side);
+  if (const auto order_it = find_order(orders, removed.order_id);
+      order_it != std::end(orders)) {
+    orders.erase(order_it);
+  }
+}
+
+auto apply(const Trade& trade, InstrumentState& state) -> void {
+  state.last_trade = trade;
+
+  if (!state.info.has_value()) {
+    state.info = InstrumentInfo{.low_price = trade.trade_price,
+                                .high_price = trade.trade_price};
+    return;
+  }
+
+  const auto price = static_cast<double>(trade.trade_price);
+  if (price < static_cast<double>(state.info->low_price)) {
+    state.info->low_price = trade.trade_price;
+  }
+  if (price > static_cast<double>(state.info->high_price)) {
+    state.info->high_price = trade.trade_price;
+  }
+}
+
+}  // namespace
+
+auto apply(const JournalRecord& record, InstrumentState& state) -> void {
+  const auto dispatcher = core::overload(
+      [&](const Trade& trade) { apply(trade, state); },
+      [&](const auto& order_mutation) {
+        apply(order_mutation, state.order_book);
+      });
+  std::visit(dispatcher, record.mutation);
+}
+
+}  // namespace simulator::trading_system::market_state
@@ -0,0 +1,117 @@
+#include <gmock/gmock.h>
+
+#include "common/market_state/journal.hpp"
+#include "common/market_state/snapshot.hpp"
+
+namespace simulator::trading_system::market_state::test {
+namespace {
+
+using namespace ::testing;
+
+struct TradingSystemCommonJournal : public ::testing::Test {
+  static auto make_order(OrderId order_id, Side side) -> LimitOrder {
+    LimitOrder order;
+    order.order_id = order_id;
+    order.side = side;
+    order.order_price = OrderPrice{10.};
+    order.total_quantity = OrderQuantity{100.};
+    return order;
+  }
+
+  static auto make_trade(double price) -> Trade {
+    return Trade{std::nullopt,
+                 std::nullopt,
+                 Price{price},
+                 Quantity{10.},
+                 std::nullopt,
+                 core::sys_us{std::chrono::microseconds{1}},
+                 MarketPhase::open()};
+  }
+
+  static auto record(JournalRecord::Mutation mutation) -> JournalRecord {
+    return JournalRecord{.instrument_id = InstrumentId{1},
+                         .mutation = std::move(mutation)};
+  }
+
+  InstrumentState state;
+};
+
+TEST_F(TradingSystemCommonJournal, AddsOrderToItsSide) {
+  apply(record(JournalRecord::OrderAdded{
+            make_order(OrderId{1}, Side::Option::Sell)}),
+        state);
+
+  ASSERT_TRUE(state.order_book.buy_orders.empty());
+  ASSERT_THAT(state.order_book.sell_orders,
+              ElementsAre(make_order(OrderId{1}, Side::Option::Sell)));
+}
+
+TEST_F(TradingSystemCommonJournal, ReplacesAlreadyAddedOrder) {
+  state.order_book.buy_orders.push_back(
+      make_order(OrderId{1}, Side::Option::Buy));
+  auto amended = make_order(OrderId{1}, Side::Option::Buy);
+  amended.total_quantity = OrderQuantity{50.};
+
+  apply(record(JournalRecord::OrderAdded{amended}), state);
+
+  ASSERT_THAT(state.order_book.buy_orders, ElementsAre(amended));
+}
+
+TEST_F(TradingSystemCommonJournal, SetsExecutedQuantityOfReducedOrder) {
+  state.order_book.buy_orders.push_back(
+      make_order(OrderId{1}, Side::Option::Buy));
+
+  apply(record(JournalRecord::OrderReduced{.order_id = OrderId{1},
+                                           .side = Side::Option::Buy,
+                                           .leaves_quantity =
+                                               LeavesQuantity{30.}}),
+        state);
+
+  const auto& order = state.order_book.buy_orders.front();
+  ASSERT_EQ(order.cum_executed_quantity, CumExecutedQuantity{70.});
+  ASSERT_EQ(order.order_status, OrderStatus::Option::PartiallyFilled);
+}
+
+TEST_F(TradingSystemCommonJournal, RemovesOrder) {
+  state.order_book.sell_orders.push_back(
+      make_order(OrderId{1}, Side::Option::Sell));
+  state.order_book.sell_orders.push_back(
+      make_order(OrderId{2}, Side::Option::Sell));
+
+  apply(record(JournalRecord::OrderRemoved{.order_id = OrderId{1},
+                                           .side = Side::Option::Sell}),
+        state);
+
+  ASSERT_THAT(state.order_book.sell_orders,
+              ElementsAre(make_order(OrderId{2}, Side::Option::Sell)));
+}
+
+TEST_F(TradingSystemCommonJournal, IgnoresMutationOfUnknownOrder) {
+  state.order_book.buy_orders.push_back(
+      make_order(OrderId{1}, Side::Option::Buy));
+  const auto expected = state;
+
+  apply(record(JournalRecord::OrderRemoved{.order_id = OrderId{2},
+                                           .side = Side::Option::Buy}),
+        state);
+  apply(record(JournalRecord::OrderReduced{.order_id = OrderId{1},
+                                           .side = Side::Option::Sell,
+                                           .leaves_quantity =
+                                               LeavesQuantity{30.}}),
+        state);
+
+  ASSERT_EQ(state, expected);
+}
+
+TEST_F(TradingSystemCommonJournal, RecordsTradeAndUpdatesInstrumentInfo) {
+  apply(record(make_trade(10.)), state);
+  apply(record(make_trade(12.)), state);
+  apply(record(make_trade(9.)), state);
+
+  ASSERT_EQ(state.last_trade, make_trade(9.));
+  ASSERT_EQ(state.info,
+            (InstrumentInfo{.low_price = Price{9.}, .high_price = Price{12.}}));
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::market_state::test
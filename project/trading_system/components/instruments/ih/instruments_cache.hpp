@@ -19,6 +19,8 @@ struct Cache::Implementation {
 
   auto add_instrument(Instrument instrument) -> void;
 
+  auto add_instruments(std::vector<Instrument> instruments) -> void;
+
   auto retrieve_instruments() const -> std::vector<Instrument>;
 
   auto find_instrument(const InstrumentDescriptor& descriptor) const
@@ -15,14 +15,18 @@ namespace detail {
 [[nodiscard]] auto create_instrument(
     const Simulator::DataLayer::Listing& listing) noexcept -> Instrument;
 
+// Converts listings in parallel chunks, preserving the order of listings.
+[[nodiscard]] auto create_instruments(
+    const std::vector<Simulator::DataLayer::Listing>& listings)
+    -> std::vector<Instrument>;
+
 }  // namespace detail
 
 struct DatabaseSource {
-  using LoadingProcedure = std::function<void(Instrument)>;
-
   explicit DatabaseSource(Simulator::DataLayer::Database::Context db) noexcept;
 
-  auto load_instruments(LoadingProcedure loading_proc) const -> void;
+  [[nodiscard]]
+  auto retrieve_instruments() const -> std::vector<Instrument>;
 
  private:
   static auto predicate() -> Simulator::DataLayer::Listing::Predicate;
@@ -31,13 +35,12 @@ struct DatabaseSource {
 };
 
 struct MemorySource {
-  using LoadingProcedure = std::function<void(Instrument)>;
-
   MemorySource() = default;
 
   explicit MemorySource(std::vector<Instrument> instruments) noexcept;
 
-  auto load_instruments(LoadingProcedure loading_proc) const -> void;
+  [[nodiscard]]
+  auto retrieve_instruments() const -> std::vector<Instrument>;
 
   auto add_instrument(Instrument instrument) -> MemorySource&;
 
@@ -67,9 +67,7 @@ auto Cache::load_instruments(const SourceType& source) -> void {
   log::debug("loading instruments into cache from a source");
   auto& cache = impl();
   try {
-    source.load_instruments([&](Instrument instrument) {
-      cache.add_instrument(std::move(instrument));
-    });
+    cache.add_instruments(source.retrieve_instruments());
     return;
   } catch (const std::exception& exception) {
     log::err("an error occurred while loading instruments into cache: {}",
@@ -3,6 +3,7 @@
 #include <functional>
 #include <stdexcept>
 #include <tl/expected.hpp>
+#include <utility>
 
 #include "ih/instruments_container.hpp"
 #include "ih/lookup/lookup.hpp"
@@ -28,7 +29,27 @@ auto Cache::Implementation::add_instrument(Instrument instrument) -> void {
     throw std::runtime_error{"internal identifier collision detected"};
   }
 
-  log::info("cached instrument - {}", instrument);
+  log::debug("cached instrument - {}", instrument);
+}
+
+auto Cache::Implementation::add_instruments(std::vector<Instrument> instruments)
+    -> void {
+  log::debug("adding {} instruments to cache", instruments.size());
+  for (auto& instrument : instruments) {
+    instrument.identifier = generate_new_id();
+  }
+
+  const auto count = instruments.size();
+  if (!container_.emplace_all(std::move(instruments))) [[unlikely]] {
+    log::err(
+        "failed to add instruments to the cache because some of them "
+        "have the same internal identifier, "
+        "this may indicate a bug in internal instrument identifier generation "
+        "algorithm, kindly raise an issue");
+    throw std::runtime_error{"internal identifier collision detected"};
+  }
+
+  log::info("cached {} instruments", count);
 }
 
 auto Cache::Implementation::retrieve_instruments() const
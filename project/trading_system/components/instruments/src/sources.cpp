@@ -1,5 +1,8 @@
 #include "instruments/sources.hpp"
 
+#include <algorithm>
+#include <future>
+#include <thread>
 #include <utility>
 
 #include "cfg/api/cfg.hpp"
@@ -13,6 +16,9 @@ namespace simulator::trading_system::instrument {
 namespace detail {
 namespace {
 
+// Listings count below which the conversion is not worth spawning threads.
+constexpr std::size_t MinListingsPerTask = 1024;
+
 template <typename Original, typename Converted>
 auto convert(const std::optional<Original>& original,
              std::optional<Converted>& converted) -> void {
@@ -79,14 +85,47 @@ auto create_instrument(const Simulator::DataLayer::Listing& listing) noexcept
   return instrument;
 }
 
+auto create_instruments(
+    const std::vector<Simulator::DataLayer::Listing>& listings)
+    -> std::vector<Instrument> {
+  std::vector<Instrument> instruments(listings.size());
+
+  const auto convert_chunk = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t index = begin; index < end; ++index) {
+      instruments[index] = create_instrument(listings[index]);
+    }
+  };
+
+  const std::size_t concurrency =
+      std::max(std::thread::hardware_concurrency(), 1U);
+  const std::size_t tasks = std::clamp<std::size_t>(
+      listings.size() / MinListingsPerTask, 1, concurrency);
+  const std::size_t chunk = (listings.size() + tasks - 1) / tasks;
+
+  std::vector<std::future<void>> conversions;
+  conversions.reserve(tasks - 1);
+  for (std::size_t begin = chunk; begin < listings.size(); begin += chunk) {
+    conversions.emplace_back(std::async(std::launch::async,
+                                        convert_chunk,
+                                        begin,
+                                        std::min(begin + chunk,
+                                                 listings.size())));
+  }
+  convert_chunk(0, std::min(chunk, listings.size()));
+
+  for (auto& conversion : conversions) {
+    conversion.get();
+  }
+  return instruments;
+}
+
 }  // namespace detail
 
 DatabaseSource::DatabaseSource(
     Simulator::DataLayer::Database::Context db) noexcept
     : db_(std::move(db)) {}
 
-auto DatabaseSource::load_instruments(LoadingProcedure loading_proc) const
-    -> void {
+auto DatabaseSource::retrieve_instruments() const -> std::vector<Instrument> {
   using Simulator::DataLayer::Listing;
   using Simulator::DataLayer::selectAllListings;
 
@@ -95,9 +134,7 @@ auto DatabaseSource::load_instruments(LoadingProcedure loading_proc) const
   const std::vector<Listing> listings = selectAllListings(db_, predicate());
   log::debug("{} matching listings selected", listings.size());
 
-  for (const auto& listing : listings) {
-    loading_proc(detail::create_instrument(listing));
-  }
+  return detail::create_instruments(listings);
 }
 
 auto DatabaseSource::predicate() -> Simulator::DataLayer::Listing::Predicate {
@@ -112,11 +149,8 @@ auto DatabaseSource::predicate() -> Simulator::DataLayer::Listing::Predicate {
 MemorySource::MemorySource(std::vector<Instrument> instruments) noexcept
     : instruments_(std::move(instruments)) {}
 
-auto MemorySource::load_instruments(LoadingProcedure loading_proc) const
-    -> void {
-  for (const auto& instrument : instruments_) {
-    loading_proc(instrument);
-  }
+auto MemorySource::retrieve_instruments() const -> std::vector<Instrument> {
+  return instruments_;
 }
 
 auto MemorySource::add_instrument(Instrument instrument) -> MemorySource& {
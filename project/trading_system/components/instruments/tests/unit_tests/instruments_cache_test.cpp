@@ -52,6 +52,18 @@ TEST_F(InstrumentsInstrumentsCache, RetrieveSeveralInstruments) {
                           Field(&Instrument::identifier, Eq(InstrumentId{2}))));
 }
 
+TEST_F(InstrumentsInstrumentsCache, AddsInstrumentsInBulk) {
+  cache.add_instrument(make_instrument(InstrumentId{120}));
+
+  cache.add_instruments({make_instrument(InstrumentId{120}),
+                         make_instrument(InstrumentId{120})});
+
+  EXPECT_THAT(cache.container(),
+              ElementsAre(Field(&Instrument::identifier, Eq(InstrumentId{1})),
+                          Field(&Instrument::identifier, Eq(InstrumentId{2})),
+                          Field(&Instrument::identifier, Eq(InstrumentId{3}))));
+}
+
 struct InstrumentsInstrumentsCacheFind : InstrumentsInstrumentsCache {
   [[nodiscard]]
   static auto instrument_sample() -> Instrument {
@@ -86,6 +86,42 @@ TEST_F(InstrumentsInstrumentsContainer,
   EXPECT_EQ(found_it, container.end());
 }
 
+TEST_F(InstrumentsInstrumentsContainer, EmplacesAllInstrumentsSorted) {
+  container.emplace(make_instrument(InstrumentId{42}));
+
+  const bool inserted = container.emplace_all(
+      {make_instrument(InstrumentId{43}), make_instrument(InstrumentId{41})});
+
+  EXPECT_TRUE(inserted);
+  EXPECT_THAT(
+      container,
+      ElementsAre(Field(&Instrument::identifier, Eq(InstrumentId{41})),
+                  Field(&Instrument::identifier, Eq(InstrumentId{42})),
+                  Field(&Instrument::identifier, Eq(InstrumentId{43}))));
+}
+
+TEST_F(InstrumentsInstrumentsContainer,
+       DoesNotEmplaceAllInstrumentsWithDuplicatedIds) {
+  const bool inserted = container.emplace_all(
+      {make_instrument(InstrumentId{42}), make_instrument(InstrumentId{42})});
+
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(container.size(), 0);
+}
+
+TEST_F(InstrumentsInstrumentsContainer,
+       DoesNotEmplaceAllInstrumentsWithExistingId) {
+  container.emplace(make_instrument(InstrumentId{42}));
+
+  const bool inserted = container.emplace_all(
+      {make_instrument(InstrumentId{41}), make_instrument(InstrumentId{42})});
+
+  EXPECT_FALSE(inserted);
+  EXPECT_THAT(
+      container,
+      ElementsAre(Field(&Instrument::identifier, Eq(InstrumentId{42}))));
+}
+
 // NOLINTEND(*-magic-numbers)
 
 }  // namespace
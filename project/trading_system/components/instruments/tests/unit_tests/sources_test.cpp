@@ -3,6 +3,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <vector>
+
 #include "data_layer/api/models/listing.hpp"
 
 namespace simulator::trading_system::instrument::test {
@@ -337,6 +340,26 @@ TEST(InstrumentsCreateInstrument, WithoutMaximalQuantity) {
   EXPECT_EQ(instrument.max_quantity, std::nullopt);
 }
 
+TEST(InstrumentsCreateInstruments, PreservesListingsOrder) {
+  std::vector<Listing> listings;
+  for (std::uint64_t listing_id = 1; listing_id <= 5000; ++listing_id) {
+    listings.push_back(Listing::create(make_listing_patch(), listing_id));
+  }
+
+  const std::vector<Instrument> instruments =
+      detail::create_instruments(listings);
+
+  ASSERT_EQ(instruments.size(), listings.size());
+  for (std::size_t index = 0; index < instruments.size(); ++index) {
+    EXPECT_THAT(instruments[index].database_id,
+                Optional(Eq(DatabaseId{index + 1})));
+  }
+}
+
+TEST(InstrumentsCreateInstruments, FromEmptyListings) {
+  EXPECT_TRUE(detail::create_instruments({}).empty());
+}
+
 // NOLINTEND(*-magic-numbers)
 
 }  // namespace
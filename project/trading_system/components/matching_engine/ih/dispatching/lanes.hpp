@@ -0,0 +1,23 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_DISPATCHING_LANES_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_DISPATCHING_LANES_HPP_
+
+#include <vector>
+
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/types/session.hpp"
+#include "runtime/mux.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// Generator orders are executed after client ones, which are waiting
+// at the same time, so that generated flow does not delay client orders.
+auto lane_of(const protocol::Session& session) -> runtime::Mux::Lane;
+
+// A batch takes the synthetic lane only when all its requests are generated,
+// a client request in a batch is never delayed by generated flow.
+auto lane_of(const std::vector<protocol::OrderRequest>& requests)
+    -> runtime::Mux::Lane;
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_DISPATCHING_LANES_HPP_
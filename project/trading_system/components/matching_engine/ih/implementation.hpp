@@ -2,6 +2,7 @@
 #define SIMULATOR_MATCHING_ENGINE_IH_IMPLEMENTATION_HPP_
 
 #include "common/events.hpp"
+#include "common/market_state/journal.hpp"
 #include "ih/commands/client_notification_cache.hpp"
 #include "ih/commands/commands.hpp"
 #include "ih/dispatching/event_dispatcher.hpp"
@@ -13,8 +14,9 @@ namespace simulator::trading_system::matching_engine {
 
 class MatchingEngine::Implementation {
  public:
-  explicit Implementation(const Instrument& instrument,
-                          const Configuration& configuration);
+  Implementation(const Instrument& instrument,
+                 const Configuration& configuration,
+                 market_state::JournalSink journal);
 
   auto dispatch_order_cmd(protocol::OrderPlacementRequest request) -> void;
 
@@ -43,6 +45,8 @@ class MatchingEngine::Implementation {
       -> void;
 
  private:
+  auto record_in_journal(const OrderBookNotification& notification) -> void;
+
   auto execute(const command::detail::ActionCommand& cmd) -> void;
 
   auto execute(const command::detail::ReplyingCommand& cmd) -> void;
@@ -80,6 +84,9 @@ class MatchingEngine::Implementation {
   auto create_phase_transition_command(event::PhaseTransition event)
       -> command::PhaseTransitionCommand;
 
+  InstrumentId instrument_id_;
+  market_state::JournalSink journal_;
+
   EventDispatcher event_dispatcher_;
   ClientNotificationCache cached_client_notifications_;
   OrderSystemFacade order_system_facade_;
@@ -10,6 +10,7 @@
 #include "ih/market_data/subscriptions/subscription_manager.hpp"
 #include "ih/market_data/validation/validator.hpp"
 #include "matching_engine/configuration.hpp"
+#include "middleware/mirror/market_state_mirror.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
@@ -34,13 +35,20 @@ class MarketDataFacade : public MarketDataRequestProcessor,
 
   auto stop_streaming(const protocol::Session& client_session) -> void override;
 
-  static auto setup(const Configuration& configuration, EventListener& listener)
+  // The mirror, when given, receives the top of book state
+  // after each publication.
+  static auto setup(const Configuration& configuration,
+                    EventListener& listener,
+                    middleware::MarketStateMirror* mirror = nullptr)
       -> MarketDataFacade;
 
  private:
   explicit MarketDataFacade(const Configuration& configuration,
                             EventListener& listener,
-                            std::unique_ptr<mdata::Validator> validator);
+                            std::unique_ptr<mdata::Validator> validator,
+                            middleware::MarketStateMirror* mirror);
+
+  auto update_mirror() const -> void;
 
   auto validate(const std::optional<Trade>& last_trade) const -> bool;
 
@@ -52,6 +60,8 @@ class MarketDataFacade : public MarketDataRequestProcessor,
 
   mdata::CacheManager cache_manager_;
   mdata::SubscriptionManager subscription_manager_;
+
+  middleware::MarketStateMirror* mirror_;
 };
 
 }  // namespace simulator::trading_system::matching_engine
@@ -16,9 +16,9 @@ class BetterOrderComparator {
 
   auto is_better(const LimitOrder& left, const LimitOrder& right) const -> bool;
 
- private:
   auto is_price_better(OrderPrice left, OrderPrice right) const -> bool;
 
+ private:
   static auto is_older(const LimitOrder& left, const LimitOrder& right) -> bool;
 
   Side side_;
@@ -47,6 +47,11 @@ class LimitOrdersContainer {
 
   auto emplace(const LimitOrder& order) -> iterator;
 
+  // Looks up an order among orders with the given price. The price level is
+  // found by a binary search and scanned from its newest order, so that
+  // an order which has just been added is found right away.
+  auto find(OrderId order_id, OrderPrice price) -> iterator;
+
   auto erase(iterator iter) -> iterator;
 
   auto erase(iterator begin, iterator end) -> void;
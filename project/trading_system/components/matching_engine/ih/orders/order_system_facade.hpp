@@ -3,6 +3,7 @@
 
 #include <gsl/pointers>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 #include "common/instrument.hpp"
@@ -47,6 +48,11 @@ class OrderSystemFacade : public OrderRequestProcessor,
 
   auto recover_state(market_state::OrderBook state) -> void override;
 
+  // Looks up a resting order, used to journal the full state of orders
+  // that are added to the book, only when a journal is attached.
+  auto capture_order_state(OrderId order_id, Side side, OrderPrice price)
+      -> std::optional<market_state::LimitOrder>;
+
   auto handle(const event::Tick& tick) -> void override;
 
   auto handle(const event::PhaseTransition& phase_transition) -> void override;
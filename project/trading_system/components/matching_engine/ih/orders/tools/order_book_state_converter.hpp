@@ -9,6 +9,8 @@ namespace simulator::trading_system::matching_engine {
 auto store_order_book_state(OrderBook& order_book,
                             market_state::OrderBook& state) -> void;
 
+auto make_order_state(const LimitOrder& order) -> market_state::LimitOrder;
+
 }  // namespace simulator::trading_system::matching_engine
 
 #endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_TOOLS_PERSISTENT_STATE_HPP_
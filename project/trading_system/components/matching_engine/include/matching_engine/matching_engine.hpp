@@ -1,9 +1,11 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_MATCHING_ENGINE_MATCHING_ENGINE_HPP_
 #define SIMULATOR_TRADING_SYSTEM_COMPONENTS_MATCHING_ENGINE_MATCHING_ENGINE_HPP_
 
+#include <functional>
 #include <memory>
 
 #include "common/events.hpp"
+#include "common/market_state/journal.hpp"
 #include "common/trading_engine.hpp"
 #include "matching_engine/configuration.hpp"
 #include "runtime/mux.hpp"
@@ -15,9 +17,12 @@ class MatchingEngine final : public TradingEngine {
  public:
   class Implementation;
 
+  // The journal sink is invoked from the engine thread for every order book
+  // mutation, an empty sink disables journaling.
   MatchingEngine(const Instrument& instrument,
                  const Configuration& configuration,
-                 runtime::Service& executor) noexcept;
+                 runtime::Service& executor,
+                 market_state::JournalSink journal) noexcept;
 
   MatchingEngine() = delete;
   MatchingEngine(const MatchingEngine&) = delete;
@@ -37,11 +42,16 @@ class MatchingEngine final : public TradingEngine {
 
   auto execute(protocol::SecurityStatusRequest request) -> void override;
 
+  auto execute(std::vector<protocol::OrderRequest> requests) -> void override;
+
   auto provide_state(protocol::InstrumentState& reply) -> void override;
 
+  auto load() const -> protocol::EngineLoad override;
+
   auto store_state(market_state::InstrumentState& state) -> void override;
 
-  auto recover_state(market_state::InstrumentState state) -> void override;
+  auto recover_state(market_state::InstrumentState state,
+                     std::function<void()> on_recovered) -> void override;
 
   auto handle(const protocol::SessionTerminatedEvent& event) -> void override;
 
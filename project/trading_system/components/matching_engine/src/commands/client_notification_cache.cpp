@@ -1,9 +1,13 @@
 #include "ih/commands/client_notification_cache.hpp"
 
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 #include "log/logging.hpp"
 #include "middleware/routing/trading_reply_channel.hpp"
+#include "protocol/app/order_reply_batch.hpp"
+#include "protocol/types/session.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
@@ -23,6 +27,26 @@ auto send_trading_reply(ReplyType&& reply) -> void {
   }
 }
 
+auto send_generator_replies(protocol::OrderReplyBatch replies) -> void {
+  // A single reply is sent as is, there is nothing to batch.
+  if (replies.size() == 1) {
+    std::visit([](auto& reply) { send_trading_reply(std::move(reply)); },
+               replies.front());
+    return;
+  }
+
+  log::debug("sending {} order replies to generator", replies.size());
+
+  try {
+    middleware::send_trading_reply(std::move(replies));
+  } catch (const std::exception& exception) {
+    log::err("failed to send order replies, an error occurred: {}",
+             exception.what());
+  } catch (...) {
+    log::err("failed to send order replies, an unknown error occurred");
+  }
+}
+
 }  // namespace
 
 ClientNotifications::ClientNotifications(
@@ -30,10 +54,33 @@ ClientNotifications::ClientNotifications(
     : notifications_(std::move(notifications)) {}
 
 auto ClientNotifications::publish() -> void {
+  // Consecutive order replies to the generator are delivered at once, so that
+  // the generator applies them to its orders registry in a single pass.
+  // The collected replies are sent before any other message, thus messages
+  // leave the engine in the order they were produced.
+  protocol::OrderReplyBatch generator_replies;
+  const auto send_collected_replies = [&] {
+    if (!generator_replies.empty()) {
+      send_generator_replies(std::exchange(generator_replies, {}));
+    }
+  };
+  const auto publish_message = [&](auto& message) {
+    using Message = std::decay_t<decltype(message)>;
+    if constexpr (std::is_constructible_v<protocol::OrderReply, Message>) {
+      if (std::holds_alternative<protocol::generator::Session>(
+              message.session.value)) {
+        generator_replies.emplace_back(std::move(message));
+        return;
+      }
+    }
+    send_collected_replies();
+    send_trading_reply(std::move(message));
+  };
+
   for (auto& notification : std::exchange(notifications_, {})) {
-    std::visit([](auto& message) { send_trading_reply(std::move(message)); },
-               notification.value);
+    std::visit(publish_message, notification.value);
   }
+  send_collected_replies();
 }
 
 auto ClientNotificationCache::add(ClientNotification notification) -> void {
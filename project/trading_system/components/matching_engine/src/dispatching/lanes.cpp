@@ -0,0 +1,30 @@
+#include "ih/dispatching/lanes.hpp"
+
+#include <algorithm>
+#include <variant>
+#include <vector>
+
+namespace simulator::trading_system::matching_engine {
+
+auto lane_of(const protocol::Session& session) -> runtime::Mux::Lane {
+  return std::holds_alternative<protocol::generator::Session>(session.value)
+             ? runtime::Mux::Lane::Synthetic
+             : runtime::Mux::Lane::Client;
+}
+
+auto lane_of(const std::vector<protocol::OrderRequest>& requests)
+    -> runtime::Mux::Lane {
+  const bool synthetic =
+      std::all_of(requests.begin(), requests.end(), [](const auto& request) {
+        return std::visit(
+            [](const auto& order_request) {
+              return lane_of(order_request.session) ==
+                     runtime::Mux::Lane::Synthetic;
+            },
+            request);
+      });
+  return synthetic ? runtime::Mux::Lane::Synthetic
+                   : runtime::Mux::Lane::Client;
+}
+
+}  // namespace simulator::trading_system::matching_engine
@@ -2,23 +2,43 @@
 
 #include <functional>
 
+#include "core/tools/overload.hpp"
 #include "ih/common/events/client_notification.hpp"
 #include "ih/common/events/order_book_notification.hpp"
 #include "log/logging.hpp"
+#include "middleware/mirror/market_state_mirror.hpp"
 
 namespace simulator::trading_system::matching_engine {
+namespace {
+
+auto find_market_state_mirror(const Instrument& instrument)
+    -> middleware::MarketStateMirror* {
+  if (!instrument.database_id.has_value()) {
+    return nullptr;
+  }
+  return &middleware::market_state_mirror(instrument.database_id->value());
+}
+
+}  // namespace
 
 MatchingEngine::Implementation::Implementation(
-    const Instrument& instrument, const Configuration& configuration)
-    : order_system_facade_(OrderSystemFacade::setup(
+    const Instrument& instrument,
+    const Configuration& configuration,
+    market_state::JournalSink journal)
+    : instrument_id_(instrument.identifier),
+      journal_(std::move(journal)),
+      order_system_facade_(OrderSystemFacade::setup(
           instrument, configuration, event_dispatcher_)),
       market_data_facade_(
-          MarketDataFacade::setup(configuration, event_dispatcher_)) {
+          MarketDataFacade::setup(configuration,
+                                  event_dispatcher_,
+                                  find_market_state_mirror(instrument))) {
   event_dispatcher_
       .on_client_notification([this](ClientNotification notification) {
         cached_client_notifications_.add(std::move(notification));
       })
       .on_order_book_notification([this](OrderBookNotification notification) {
+        record_in_journal(notification);
         market_data_facade_.handle(std::move(notification));
       });
 }
@@ -78,6 +98,50 @@ auto MatchingEngine::Implementation::dispatch_phase_transition_cmd(
   execute(create_phase_transition_command(phase_transition));
 }
 
+auto MatchingEngine::Implementation::record_in_journal(
+    const OrderBookNotification& notification) -> void {
+  if (!journal_) {
+    return;
+  }
+
+  using Record = market_state::JournalRecord;
+  const auto append = [this](Record::Mutation mutation) {
+    journal_(Record{.instrument_id = instrument_id_,
+                    .mutation = std::move(mutation)});
+  };
+
+  // Market data notifications do not carry the full order state,
+  // so it is taken from the book the order has just been added to.
+  const auto dispatcher = core::overload(
+      [&](const OrderAdded& added) {
+        if (!added.order_price.has_value()) {
+          return;
+        }
+        if (auto order = order_system_facade_.capture_order_state(
+                added.order_id,
+                added.order_side,
+                OrderPrice{static_cast<double>(*added.order_price)})) {
+          append(Record::OrderAdded{.order = std::move(*order)});
+        }
+      },
+      [&](const OrderReduced& reduced) {
+        append(Record::OrderReduced{
+            .order_id = reduced.order_id,
+            .side = reduced.order_side,
+            .leaves_quantity = LeavesQuantity{
+                static_cast<double>(reduced.order_quantity)}});
+      },
+      [&](const OrderRemoved& removed) {
+        append(Record::OrderRemoved{.order_id = removed.order_id,
+                                    .side = removed.order_side});
+      },
+      [&](const Trade& trade) { append(trade); },
+      [](const LastTradeRecover&) {},
+      [](const InstrumentInfoRecover&) {});
+
+  std::visit(dispatcher, notification.value);
+}
+
 auto MatchingEngine::Implementation::execute(
     const command::detail::ActionCommand& cmd) -> void {
   log::trace("executing {} command", cmd.name());
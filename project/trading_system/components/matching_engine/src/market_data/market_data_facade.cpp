@@ -26,11 +26,13 @@ auto setup_market_data_validator(const Configuration& configuration)
 
 MarketDataFacade::MarketDataFacade(const Configuration& configuration,
                                    EventListener& listener,
-                                   std::unique_ptr<mdata::Validator> validator)
+                                   std::unique_ptr<mdata::Validator> validator,
+                                   middleware::MarketStateMirror* mirror)
     : validator_{std::move(validator)},
       recover_{listener},
       cache_manager_(configuration),
-      subscription_manager_(configuration, listener, cache_manager_) {}
+      subscription_manager_(configuration, listener, cache_manager_),
+      mirror_{mirror} {}
 
 auto MarketDataFacade::handle(OrderBookNotification notification) -> void {
   log::trace("handling an OrderBookNotification");
@@ -42,6 +44,7 @@ auto MarketDataFacade::publish() -> void {
     log::trace("publishing market data");
     cache_manager_.apply_pending_changes();
     subscription_manager_.publish();
+    update_mirror();
   } else {
     log::trace("no market data updates to publish");
   }
@@ -82,9 +85,37 @@ auto MarketDataFacade::stop_streaming(const protocol::Session& client_session)
 }
 
 auto MarketDataFacade::setup(const Configuration& configuration,
-                             EventListener& listener) -> MarketDataFacade {
-  return MarketDataFacade{
-      configuration, listener, setup_market_data_validator(configuration)};
+                             EventListener& listener,
+                             middleware::MarketStateMirror* mirror)
+    -> MarketDataFacade {
+  return MarketDataFacade{configuration,
+                          listener,
+                          setup_market_data_validator(configuration),
+                          mirror};
+}
+
+auto MarketDataFacade::update_mirror() const -> void {
+  if (mirror_ == nullptr) {
+    return;
+  }
+
+  protocol::InstrumentState state;
+  cache_manager_.capture(state);
+
+  middleware::MirroredMarketState mirrored;
+  if (state.best_bid_price.has_value()) {
+    mirrored.best_bid_price = state.best_bid_price->value();
+  }
+  if (state.best_offer_price.has_value()) {
+    mirrored.best_offer_price = state.best_offer_price->value();
+  }
+  if (state.current_bid_depth.has_value()) {
+    mirrored.bid_depth_levels = state.current_bid_depth->value();
+  }
+  if (state.current_offer_depth.has_value()) {
+    mirrored.offer_depth_levels = state.current_offer_depth->value();
+  }
+  mirror_->publish(mirrored);
 }
 
 auto MarketDataFacade::validate(const std::optional<Trade>& last_trade) const
@@ -1,27 +1,43 @@
 #include "matching_engine/matching_engine.hpp"
 
+#include <chrono>
 #include <future>
 #include <latch>
+#include <variant>
+#include <vector>
 
+#include "ih/dispatching/lanes.hpp"
 #include "ih/implementation.hpp"
 #include "log/logging.hpp"
 #include "runtime/service.hpp"
 
 namespace simulator::trading_system::matching_engine {
+namespace {
+
+// Synchronous engine state commands are executed ahead of orders.
+constexpr auto Control = runtime::Mux::Lane::Control;
+
+// Trading session events are executed in order with orders, i.e. after
+// orders accepted before them and ahead of orders accepted after them.
+constexpr auto Fence = runtime::Mux::Lane::Fence;
+
+}  // namespace
 
 MatchingEngine::MatchingEngine(const Instrument& instrument,
                                const Configuration& configuration,
-                               runtime::Service& executor) noexcept
+                               runtime::Service& executor,
+                               market_state::JournalSink journal) noexcept
     : mux_(runtime::Mux::create_chained_mux(executor)),
-      implementation_(
-          std::make_unique<Implementation>(instrument, configuration)) {}
+      implementation_(std::make_unique<Implementation>(
+          instrument, configuration, std::move(journal))) {}
 
 MatchingEngine::~MatchingEngine() noexcept = default;
 
 auto MatchingEngine::execute(protocol::OrderPlacementRequest request) -> void {
   log::trace("dispatching order placement request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
+  const runtime::Mux::Lane lane = lane_of(request.session);
+  mux_.execute(lane, [this, request = std::move(request)]() mutable {
     implementation_->dispatch_order_cmd(std::move(request));
   });
 
@@ -32,7 +48,8 @@ auto MatchingEngine::execute(protocol::OrderModificationRequest request)
     -> void {
   log::trace("dispatching order amendment request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
+  const runtime::Mux::Lane lane = lane_of(request.session);
+  mux_.execute(lane, [this, request = std::move(request)]() mutable {
     implementation_->dispatch_order_cmd(std::move(request));
   });
 
@@ -43,7 +60,8 @@ auto MatchingEngine::execute(protocol::OrderCancellationRequest request)
     -> void {
   log::trace("dispatching order cancellation request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
+  const runtime::Mux::Lane lane = lane_of(request.session);
+  mux_.execute(lane, [this, request = std::move(request)]() mutable {
     implementation_->dispatch_order_cmd(std::move(request));
   });
 
@@ -53,7 +71,8 @@ auto MatchingEngine::execute(protocol::OrderCancellationRequest request)
 auto MatchingEngine::execute(protocol::MarketDataRequest request) -> void {
   log::trace("dispatching market data request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
+  const runtime::Mux::Lane lane = lane_of(request.session);
+  mux_.execute(lane, [this, request = std::move(request)]() mutable {
     implementation_->dispatch_mdata_cmd(std::move(request));
   });
 
@@ -63,19 +82,38 @@ auto MatchingEngine::execute(protocol::MarketDataRequest request) -> void {
 auto MatchingEngine::execute(protocol::SecurityStatusRequest request) -> void {
   log::trace("dispatching security status request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
+  const runtime::Mux::Lane lane = lane_of(request.session);
+  mux_.execute(lane, [this, request = std::move(request)]() mutable {
     implementation_->dispatch_order_cmd(std::move(request));
   });
 
   log::trace("security status request dispatched");
 }
 
+auto MatchingEngine::execute(std::vector<protocol::OrderRequest> requests)
+    -> void {
+  log::trace("dispatching a batch of {} order requests", requests.size());
+
+  const runtime::Mux::Lane lane = lane_of(requests);
+  mux_.execute(lane, [this, requests = std::move(requests)]() mutable {
+    for (auto& request : requests) {
+      std::visit(
+          [this](auto& order_request) {
+            implementation_->dispatch_order_cmd(std::move(order_request));
+          },
+          request);
+    }
+  });
+
+  log::trace("order requests batch dispatched");
+}
+
 auto MatchingEngine::provide_state(protocol::InstrumentState& reply) -> void {
   log::trace("dispatching synchronous instrument state capture request");
 
   std::promise<void> promise;
 
-  runtime::execute(mux_, [this, &reply, &promise]() mutable {
+  mux_.execute(Control, [this, &reply, &promise]() mutable {
     implementation_->dispatch_instrument_state_capture_cmd(reply);
     promise.set_value();
   });
@@ -85,12 +123,22 @@ auto MatchingEngine::provide_state(protocol::InstrumentState& reply) -> void {
   log::debug("instrument state captured: {}", reply);
 }
 
+auto MatchingEngine::load() const -> protocol::EngineLoad {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  const runtime::Mux::Load load = mux_.load();
+  return protocol::EngineLoad{
+      .queue_depth = load.queue_depth,
+      .oldest_request_age = duration_cast<microseconds>(load.oldest_task_age)};
+}
+
 auto MatchingEngine::store_state(market_state::InstrumentState& state) -> void {
   log::trace("dispatching synchronous instrument state store request");
 
   std::latch state_stored{1};
 
-  runtime::execute(mux_, [this, &state, &state_stored]() mutable {
+  mux_.execute(Control, [this, &state, &state_stored]() mutable {
     implementation_->dispatch_store_state_cmd(state);
     state_stored.count_down();
   });
@@ -100,28 +148,29 @@ auto MatchingEngine::store_state(market_state::InstrumentState& state) -> void {
   log::debug("instrument {} state stored", state.instrument.identifier);
 }
 
-auto MatchingEngine::recover_state(market_state::InstrumentState state)
+auto MatchingEngine::recover_state(market_state::InstrumentState state,
+                                   std::function<void()> on_recovered)
     -> void {
-  log::trace("dispatching synchronous instrument state recover request");
-
-  std::latch state_recovered{1};
-
-  runtime::execute(
-      mux_, [this, state = std::move(state), &state_recovered]() mutable {
-        implementation_->dispatch_recover_state_cmd(std::move(state));
-        state_recovered.count_down();
-      });
-
-  state_recovered.wait();
-
-  log::debug("instrument state recovered");
+  log::trace("dispatching instrument state recover request");
+
+  mux_.execute(Control,
+               [this,
+                state = std::move(state),
+                on_recovered = std::move(on_recovered)]() mutable {
+                 implementation_->dispatch_recover_state_cmd(std::move(state));
+                 log::debug("instrument state recovered");
+                 on_recovered();
+               });
+
+  log::trace("instrument state recover request dispatched");
 }
 
 auto MatchingEngine::handle(const protocol::SessionTerminatedEvent& event)
     -> void {
   log::trace("dispatching client disconnected notification");
 
-  runtime::execute(mux_, [this, event] {
+  // Follows orders of the terminated session, which may be waiting
+  mux_.execute(lane_of(event.session), [this, event] {
     implementation_->dispatch_client_disconnected_cmd(event.session);
   });
 
@@ -131,7 +180,7 @@ auto MatchingEngine::handle(const protocol::SessionTerminatedEvent& event)
 auto MatchingEngine::handle(event::Tick tick) -> void {
   log::trace("dispatching tick event");
 
-  runtime::execute(mux_, [this, tick]() mutable {
+  mux_.execute(Fence, [this, tick]() mutable {
     implementation_->dispatch_tick_cmd(std::move(tick));
   });
 
@@ -141,7 +190,7 @@ auto MatchingEngine::handle(event::Tick tick) -> void {
 auto MatchingEngine::handle(event::PhaseTransition phase_transition) -> void {
   log::trace("dispatching phase transition event");
 
-  runtime::execute(mux_, [this, phase_transition]() mutable {
+  mux_.execute(Fence, [this, phase_transition]() mutable {
     implementation_->dispatch_phase_transition_cmd(std::move(phase_transition));
   });
 
@@ -77,6 +77,26 @@ auto LimitOrdersContainer::emplace(const LimitOrder& order) -> iterator {
                          order);
 }
 
+auto LimitOrdersContainer::find(OrderId order_id, OrderPrice price)
+    -> iterator {
+  // Orders with the same or a better price precede the end of the level.
+  const auto level_end =
+      std::partition_point(begin(), end(), [&](const LimitOrder& order) {
+        return !order_cmp_.is_price_better(price, order.price());
+      });
+
+  for (auto iter = level_end; iter != begin();) {
+    --iter;
+    if (iter->price() != price) {
+      break;
+    }
+    if (iter->id() == order_id) {
+      return iter;
+    }
+  }
+  return end();
+}
+
 auto LimitOrdersContainer::erase(iterator iter) -> iterator {
   if (iter < begin() || iter >= end()) [[unlikely]] {
     throw std::invalid_argument(
@@ -1,5 +1,6 @@
 #include "ih/orders/order_system_facade.hpp"
 
+#include <algorithm>
 #include <variant>
 
 #include "core/tools/overload.hpp"
@@ -123,6 +124,18 @@ auto OrderSystemFacade::recover_state(market_state::OrderBook state) -> void {
   recover_page(std::move(state.sell_orders), order::OrderBookSide::Sell);
 }
 
+auto OrderSystemFacade::capture_order_state(OrderId order_id,
+                                            Side side,
+                                            OrderPrice price)
+    -> std::optional<market_state::LimitOrder> {
+  auto& orders = depr_order_book_->take_page(side).limit_orders();
+  const auto order_it = orders.find(order_id, price);
+  if (order_it == orders.end()) {
+    return std::nullopt;
+  }
+  return make_order_state(*order_it);
+}
+
 auto OrderSystemFacade::recover_page(
     std::vector<market_state::LimitOrder> orders_state,
     order::OrderBookSide side) -> void {
@@ -56,4 +56,10 @@ auto store_order_book_state(OrderBook& order_book,
   store(order_book.sell_page(), state.sell_orders);
 }
 
+auto make_order_state(const LimitOrder& order) -> market_state::LimitOrder {
+  market_state::LimitOrder order_state;
+  store(order, order_state);
+  return order_state;
+}
+
 }  // namespace simulator::trading_system::matching_engine
@@ -72,5 +72,61 @@ TEST_F(MatchingEngineTickCommand, ReturnsClientNotifications) {
   client_notifications.publish();
 }
 
+TEST_F(MatchingEngineTickCommand, PublishesGeneratorOrderRepliesAsBatch) {
+  bind_channel();
+
+  ON_CALL(order_event_handler, handle(TickEvent))
+      .WillByDefault(InvokeWithoutArgs([&] {
+        client_notification_cache.add(
+            ClientNotification{make_message<protocol::ExecutionReport>()});
+        client_notification_cache.add(
+            ClientNotification{make_message<protocol::ExecutionReport>()});
+      }));
+
+  EXPECT_CALL(trading_reply_receiver, process(A<protocol::ExecutionReport>()))
+      .Times(0);
+  EXPECT_CALL(trading_reply_receiver,
+              process(Matcher<protocol::OrderReplyBatch>(SizeIs(2))));
+
+  auto client_notifications = command();
+  client_notifications.publish();
+}
+
+TEST_F(MatchingEngineTickCommand, PublishesNotificationsInProducedOrder) {
+  bind_channel();
+
+  auto fix_report = make_message<protocol::ExecutionReport>();
+  fix_report.session = protocol::Session{
+      protocol::fix::Session{protocol::fix::BeginString{"FIXT1.1"},
+                             protocol::fix::SenderCompId{"Sender"},
+                             protocol::fix::TargetCompId{"Target"}}};
+
+  ON_CALL(order_event_handler, handle(TickEvent))
+      .WillByDefault(InvokeWithoutArgs([&] {
+        client_notification_cache.add(
+            ClientNotification{make_message<protocol::ExecutionReport>()});
+        client_notification_cache.add(
+            ClientNotification{make_message<protocol::ExecutionReport>()});
+        client_notification_cache.add(ClientNotification{fix_report});
+        client_notification_cache.add(
+            ClientNotification{make_message<protocol::ExecutionReport>()});
+      }));
+
+  const InSequence sequence;
+  EXPECT_CALL(trading_reply_receiver,
+              process(Matcher<protocol::OrderReplyBatch>(SizeIs(2))));
+  EXPECT_CALL(trading_reply_receiver,
+              process(Matcher<protocol::ExecutionReport>(
+                  Field(&protocol::ExecutionReport::session,
+                        Eq(fix_report.session)))));
+  EXPECT_CALL(trading_reply_receiver,
+              process(Matcher<protocol::ExecutionReport>(
+                  Field(&protocol::ExecutionReport::session,
+                        Ne(fix_report.session)))));
+
+  auto client_notifications = command();
+  client_notifications.publish();
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::matching_engine::command::test
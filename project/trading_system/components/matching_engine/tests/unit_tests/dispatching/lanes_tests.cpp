@@ -0,0 +1,55 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "ih/dispatching/lanes.hpp"
+#include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/types/session.hpp"
+#include "runtime/mux.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+struct Lanes : public ::testing::Test {
+  static auto make_client_session() -> protocol::Session {
+    return protocol::Session{
+        protocol::fix::Session{protocol::fix::BeginString{"FIXT1.1"},
+                               protocol::fix::SenderCompId{"Sender"},
+                               protocol::fix::TargetCompId{"Target"}}};
+  }
+
+  static auto make_generator_session() -> protocol::Session {
+    return protocol::Session{protocol::generator::Session{}};
+  }
+};
+
+TEST_F(Lanes, RoutesClientSessionToClientLane) {
+  ASSERT_EQ(lane_of(make_client_session()), runtime::Mux::Lane::Client);
+}
+
+TEST_F(Lanes, RoutesGeneratorSessionToSyntheticLane) {
+  ASSERT_EQ(lane_of(make_generator_session()), runtime::Mux::Lane::Synthetic);
+}
+
+TEST_F(Lanes, RoutesGeneratedBatchToSyntheticLane) {
+  const std::vector<protocol::OrderRequest> requests{
+      protocol::OrderPlacementRequest{make_generator_session()},
+      protocol::OrderCancellationRequest{make_generator_session()}};
+
+  ASSERT_EQ(lane_of(requests), runtime::Mux::Lane::Synthetic);
+}
+
+TEST_F(Lanes, RoutesBatchWithClientRequestToClientLane) {
+  const std::vector<protocol::OrderRequest> requests{
+      protocol::OrderPlacementRequest{make_generator_session()},
+      protocol::OrderCancellationRequest{make_client_session()}};
+
+  ASSERT_EQ(lane_of(requests), runtime::Mux::Lane::Client);
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
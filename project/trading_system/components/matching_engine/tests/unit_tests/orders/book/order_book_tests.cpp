@@ -122,6 +122,39 @@ TEST_F(LimitOrdersContainer, InsertsSellOrderAfterOrdersWithSameOrBetterPrice) {
                           Property(&LimitOrder::id, Eq(OrderId{3}))));
 }
 
+TEST_F(LimitOrdersContainer, FindsOrderAmongOrdersWithSamePrice) {
+  add_buy_order(OrderId{1}, OrderPrice{100.01});
+  add_buy_order(OrderId{2}, OrderPrice{100});
+  add_buy_order(OrderId{3}, OrderPrice{99.99});
+  add_buy_order(OrderId{4}, OrderPrice{100});
+
+  const auto iter = buy_container.find(OrderId{2}, OrderPrice{100});
+
+  ASSERT_NE(iter, buy_container.end());
+  ASSERT_THAT(iter->id(), Eq(OrderId{2}));
+}
+
+TEST_F(LimitOrdersContainer, FindsNewestSellOrderOfPrice) {
+  add_sell_order(OrderId{1}, OrderPrice{99.09});
+  add_sell_order(OrderId{2}, OrderPrice{100});
+  add_sell_order(OrderId{3}, OrderPrice{100.01});
+
+  const auto iter = sell_container.find(OrderId{3}, OrderPrice{100.01});
+
+  ASSERT_NE(iter, sell_container.end());
+  ASSERT_THAT(iter->id(), Eq(OrderId{3}));
+}
+
+TEST_F(LimitOrdersContainer, DoesNotFindOrderWithOtherPrice) {
+  add_buy_order(OrderId{1}, OrderPrice{100});
+  add_buy_order(OrderId{2}, OrderPrice{99});
+
+  ASSERT_EQ(buy_container.find(OrderId{1}, OrderPrice{99}),
+            buy_container.end());
+  ASSERT_EQ(buy_container.find(OrderId{3}, OrderPrice{100}),
+            buy_container.end());
+}
+
 TEST_F(LimitOrdersContainer, ErasesRangeOfOrders) {
   add_buy_order(OrderId{1});
   add_buy_order(OrderId{2});
@@ -1,28 +1,54 @@
 #ifndef SIMULATOR_RUNTIME_IH_CHAINED_MUX_HPP_
 #define SIMULATOR_RUNTIME_IH_CHAINED_MUX_HPP_
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <list>
 #include <mutex>
+#include <utility>
 
 #include "ih/mux_impl.hpp"
 
 namespace simulator::trading_system::runtime {
 
+// Executes posted tasks one chain at a time. Tasks posted while a chain runs
+// wait in lanes, the next chain takes all control and client tasks and
+// at most a few synthetic ones, so that a burst of synthetic tasks delays
+// client tasks by a bounded number of tasks only, while synthetic tasks
+// still make progress with each chain. A waiting fence keeps the number
+// of client and synthetic tasks posted before it, a chain takes all of them
+// along with the fence, regardless of the synthetic tasks budget, and takes
+// tasks posted after the fence only once the fence itself has been taken.
 class ChainedMux : public Mux::Implementation {
   class TaskChain {
    public:
+    using Clock = std::chrono::steady_clock;
+
     auto empty() const noexcept -> bool;
 
+    auto size() const noexcept -> std::size_t;
+
+    // The time the first task of the chain has been pushed at.
+    auto created_at() const noexcept -> Clock::time_point;
+
     auto push(std::function<void()> task) -> void;
 
+    // Moves at most count first tasks of the other chain to the end.
+    auto take(TaskChain& other, std::size_t count) -> void;
+
     auto operator()() -> void;
 
    private:
-    std::list<std::function<void()>> tasks_;
+    std::list<std::pair<Clock::time_point, std::function<void()>>> tasks_;
   };
 
  public:
+  // The number of synthetic tasks a chain takes at most.
+  static constexpr std::size_t SyntheticTasksPerChain = 16;
+
   explicit ChainedMux(Service& executor);
 
   ChainedMux() = delete;
@@ -34,16 +60,43 @@ class ChainedMux : public Mux::Implementation {
   auto operator=(const ChainedMux&) -> ChainedMux& = delete;
   auto operator=(ChainedMux&&) noexcept -> ChainedMux& = delete;
 
-  auto post(std::function<void()> task) -> void override;
+  // Posts the task to the client lane.
+  auto post(std::function<void()> task) -> void;
+
+  auto post(Mux::Lane lane, std::function<void()> task) -> void override;
+
+  // Reports tasks waiting for the running chain to complete.
+  auto load() const -> Mux::Load override;
 
  private:
+  static constexpr std::size_t LanesCount = 4;
+
+  // Client and synthetic tasks, which have to be executed before a fence.
+  struct FenceBarrier {
+    std::size_t client_tasks{0};
+    std::size_t synthetic_tasks{0};
+  };
+
+  auto lane(Mux::Lane lane) -> TaskChain&;
+
+  // Moves at most count first tasks of the lane to the chain,
+  // the tasks are no longer awaited by waiting fences.
+  auto take_ordered(TaskChain& chain, Mux::Lane from, std::size_t count)
+      -> void;
+
+  auto pending_empty() const noexcept -> bool;
+
+  auto next_chain() -> TaskChain;
+
   auto completed() -> void;
 
   template <typename F>
   auto execute(F&& task) -> void;
 
-  std::mutex mutex_;
-  TaskChain chain_;
+  mutable std::mutex mutex_;
+  std::array<TaskChain, LanesCount> lanes_;
+  // Barriers of waiting fences in the order of the fence lane.
+  std::deque<FenceBarrier> fence_barriers_;
   bool locked_ = false;
 };
 
@@ -21,7 +21,10 @@ class Mux::Implementation {
   auto operator=(const Implementation&) -> Implementation& = delete;
   auto operator=(Implementation&&) noexcept -> Implementation& = delete;
 
-  virtual auto post(std::function<void()> task) -> void = 0;
+  virtual auto post(Mux::Lane lane, std::function<void()> task) -> void = 0;
+
+  [[nodiscard]]
+  virtual auto load() const -> Mux::Load = 0;
 
  protected:
   gsl::not_null<Service*> executor_;
@@ -1,6 +1,9 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_RUNTIME_MUX_HPP_
 #define SIMULATOR_TRADING_SYSTEM_COMPONENTS_RUNTIME_MUX_HPP_
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -12,6 +15,20 @@ class Mux : public Service {
  public:
   class Implementation;
 
+  // Tasks of a lane may be executed ahead of tasks of lower lanes posted
+  // earlier, tasks of the same lane are executed in the posting order.
+  // A fence task is executed after client and synthetic tasks posted
+  // before it, and ahead of client and synthetic tasks posted after it,
+  // only control tasks may overtake a fence.
+  enum class Lane : std::uint8_t { Control, Client, Synthetic, Fence };
+
+  // Tasks posted to the mux, which are waiting for the running ones,
+  // the oldest task is the one waiting longest across all lanes.
+  struct Load {
+    std::size_t queue_depth{0};
+    std::chrono::nanoseconds oldest_task_age{0};
+  };
+
   [[nodiscard]]
   static auto create_chained_mux(Service& executor) -> Mux;
 
@@ -25,8 +42,14 @@ class Mux : public Service {
   auto operator=(const Mux&) -> Mux& = delete;
   auto operator=(Mux&&) noexcept -> Mux&;
 
+  // Executes the task in the client lane.
   auto execute(std::function<void()> task) -> void override;
 
+  auto execute(Lane lane, std::function<void()> task) -> void;
+
+  [[nodiscard]]
+  auto load() const -> Load;
+
  private:
   std::unique_ptr<Implementation> impl_;
 };
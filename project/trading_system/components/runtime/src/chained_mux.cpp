@@ -1,6 +1,9 @@
 #include "ih/chained_mux.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
+#include <limits>
 #include <mutex>
 #include <utility>
 
@@ -12,13 +15,28 @@ auto ChainedMux::TaskChain::empty() const noexcept -> bool {
   return tasks_.empty();
 }
 
+auto ChainedMux::TaskChain::size() const noexcept -> std::size_t {
+  return tasks_.size();
+}
+
+auto ChainedMux::TaskChain::created_at() const noexcept -> Clock::time_point {
+  return tasks_.empty() ? Clock::time_point{} : tasks_.front().first;
+}
+
 void ChainedMux::TaskChain::push(std::function<void()> task) {
-  tasks_.emplace_back(std::move(task));
+  tasks_.emplace_back(Clock::now(), std::move(task));
+}
+
+auto ChainedMux::TaskChain::take(TaskChain& other, std::size_t count)
+    -> void {
+  auto last = other.tasks_.begin();
+  std::advance(last, std::min(count, other.tasks_.size()));
+  tasks_.splice(tasks_.end(), other.tasks_, other.tasks_.begin(), last);
 }
 
 auto ChainedMux::TaskChain::operator()() -> void {
   for (auto& task : tasks_) {
-    task();
+    task.second();
   }
 }
 
@@ -33,7 +51,7 @@ ChainedMux::~ChainedMux() noexcept {
     std::abort();
   }
 
-  if (!chain_.empty()) {
+  if (!pending_empty()) {
     log::err(
         "BUG: data loss detected, chained mux is being destroyed with pending "
         "tasks");
@@ -41,10 +59,20 @@ ChainedMux::~ChainedMux() noexcept {
 }
 
 auto ChainedMux::post(std::function<void()> task) -> void {
+  post(Mux::Lane::Client, std::move(task));
+}
+
+auto ChainedMux::post(Mux::Lane lane, std::function<void()> task) -> void {
   {
     std::lock_guard lock(mutex_);
     if (locked_) {
-      chain_.push(std::move(task));
+      if (lane == Mux::Lane::Fence) {
+        fence_barriers_.push_back(
+            FenceBarrier{.client_tasks = this->lane(Mux::Lane::Client).size(),
+                         .synthetic_tasks =
+                             this->lane(Mux::Lane::Synthetic).size()});
+      }
+      this->lane(lane).push(std::move(task));
       return;
     }
     locked_ = true;
@@ -53,12 +81,81 @@ auto ChainedMux::post(std::function<void()> task) -> void {
   execute(std::move(task));
 }
 
+auto ChainedMux::load() const -> Mux::Load {
+  std::lock_guard lock(mutex_);
+
+  Mux::Load load;
+  auto oldest = TaskChain::Clock::time_point::max();
+  for (const TaskChain& chain : lanes_) {
+    if (!chain.empty()) {
+      load.queue_depth += chain.size();
+      oldest = std::min(oldest, chain.created_at());
+    }
+  }
+
+  if (load.queue_depth != 0) {
+    load.oldest_task_age = TaskChain::Clock::now() - oldest;
+  }
+  return load;
+}
+
+auto ChainedMux::lane(Mux::Lane lane) -> TaskChain& {
+  return lanes_[static_cast<std::size_t>(lane)];
+}
+
+auto ChainedMux::take_ordered(TaskChain& chain,
+                              Mux::Lane from,
+                              std::size_t count) -> void {
+  TaskChain& source = lane(from);
+  const std::size_t taken = std::min(count, source.size());
+  chain.take(source, taken);
+
+  for (FenceBarrier& barrier : fence_barriers_) {
+    std::size_t& awaited = from == Mux::Lane::Client ? barrier.client_tasks
+                                                     : barrier.synthetic_tasks;
+    awaited -= std::min(awaited, taken);
+  }
+}
+
+auto ChainedMux::pending_empty() const noexcept -> bool {
+  return std::all_of(lanes_.begin(), lanes_.end(), [](const auto& chain) {
+    return chain.empty();
+  });
+}
+
+auto ChainedMux::next_chain() -> TaskChain {
+  constexpr auto all_tasks = std::numeric_limits<std::size_t>::max();
+
+  TaskChain chain;
+  chain.take(lane(Mux::Lane::Control), all_tasks);
+
+  std::size_t synthetic_budget = SyntheticTasksPerChain;
+  while (!fence_barriers_.empty()) {
+    const FenceBarrier& barrier = fence_barriers_.front();
+    take_ordered(chain, Mux::Lane::Client, barrier.client_tasks);
+
+    // Synthetic tasks awaited by the fence are taken regardless of the budget,
+    // so that client tasks posted after the fence wait for a single chain,
+    // rather than for the synthetic backlog split across chains.
+    const std::size_t synthetic = barrier.synthetic_tasks;
+    take_ordered(chain, Mux::Lane::Synthetic, synthetic);
+    synthetic_budget -= std::min(synthetic, synthetic_budget);
+
+    chain.take(lane(Mux::Lane::Fence), 1);
+    fence_barriers_.pop_front();
+  }
+
+  chain.take(lane(Mux::Lane::Client), all_tasks);
+  chain.take(lane(Mux::Lane::Synthetic), synthetic_budget);
+  return chain;
+}
+
 auto ChainedMux::completed() -> void {
   TaskChain chain;
 
   {
     std::lock_guard lock(mutex_);
-    std::swap(chain, chain_);
+    chain = next_chain();
     if (chain.empty()) {
       locked_ = false;
       return;
@@ -76,4 +173,4 @@ auto ChainedMux::execute(F&& task) -> void {
   });
 }
 
-}  // namespace simulator::trading_system::runtime
\ No newline at end of file
+}  // namespace simulator::trading_system::runtime
@@ -46,9 +46,15 @@ Mux::~Mux() noexcept = default;
 auto Mux::operator=(Mux&&) noexcept -> Mux& = default;
 
 auto Mux::execute(std::function<void()> task) -> void {
-  impl_->post(std::move(task));
+  impl_->post(Lane::Client, std::move(task));
 }
 
+auto Mux::execute(Lane lane, std::function<void()> task) -> void {
+  impl_->post(lane, std::move(task));
+}
+
+auto Mux::load() const -> Load { return impl_->load(); }
+
 auto ThreadPool::create_simple_thread_pool(std::size_t threads) -> ThreadPool {
   return ThreadPool(std::make_unique<SimpleThreadPool>(threads));
 }
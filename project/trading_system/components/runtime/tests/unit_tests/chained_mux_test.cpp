@@ -5,7 +5,10 @@
 
 #include <chrono>
 #include <csignal>
+#include <future>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "runtime/thread_pool.hpp"
 
@@ -25,6 +28,208 @@ TEST(ChainedMuxDeathTest, TerminatesWhenDestroyedWhileLocked) {
       "");
 }
 
+TEST(ChainedMuxLoad, ReportsNoLoadWhenIdle) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  ChainedMux mux(pool);
+
+  const auto load = mux.load();
+  EXPECT_EQ(load.queue_depth, 0);
+  EXPECT_EQ(load.oldest_task_age, std::chrono::nanoseconds::zero());
+}
+
+TEST(ChainedMuxLoad, ReportsTasksWaitingForRunningTask) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    mux.post([] {});
+    mux.post([] {});
+    std::this_thread::sleep_for(1ms);
+
+    const auto load = mux.load();
+    EXPECT_EQ(load.queue_depth, 2);
+    EXPECT_GE(load.oldest_task_age, 1ms);
+
+    release.set_value();
+    pool.await();
+
+    EXPECT_EQ(mux.load().queue_depth, 0);
+  }
+}
+
+TEST(ChainedMuxLanes, ExecutesWaitingTasksByLanes) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  std::vector<std::string> results;
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    mux.post(Mux::Lane::Synthetic, [&] { results.emplace_back("synthetic"); });
+    mux.post(Mux::Lane::Client, [&] { results.emplace_back("client"); });
+    mux.post(Mux::Lane::Control, [&] { results.emplace_back("control"); });
+
+    release.set_value();
+    pool.await();
+  }
+
+  EXPECT_EQ(results,
+            (std::vector<std::string>{"control", "client", "synthetic"}));
+}
+
+TEST(ChainedMuxLanes, ExecutesSyntheticTasksInPostingOrderAcrossChains) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  constexpr std::size_t synthetic_tasks =
+      ChainedMux::SyntheticTasksPerChain * 2;
+  std::vector<std::size_t> results;
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    for (std::size_t idx = 0; idx < synthetic_tasks; ++idx) {
+      mux.post(Mux::Lane::Synthetic, [&results, idx] {
+        results.push_back(idx);
+      });
+    }
+    release.set_value();
+    pool.await();
+  }
+
+  ASSERT_EQ(results.size(), synthetic_tasks);
+  for (std::size_t idx = 0; idx < synthetic_tasks; ++idx) {
+    EXPECT_EQ(results[idx], idx);
+  }
+}
+
+TEST(ChainedMuxLanes, ExecutesClientTaskBeforeSyntheticBacklog) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  constexpr std::size_t synthetic_tasks =
+      ChainedMux::SyntheticTasksPerChain * 3;
+  std::vector<std::string> results;
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    for (std::size_t idx = 0; idx < synthetic_tasks; ++idx) {
+      mux.post(Mux::Lane::Synthetic, [&mux, &results, idx] {
+        results.emplace_back("synthetic");
+        if (idx == 0) {
+          mux.post(Mux::Lane::Client,
+                   [&results] { results.emplace_back("client"); });
+        }
+      });
+    }
+
+    release.set_value();
+    pool.await();
+  }
+
+  ASSERT_EQ(results.size(), synthetic_tasks + 1);
+  // The client task waits for the running chain of synthetic tasks only
+  EXPECT_EQ(results.at(ChainedMux::SyntheticTasksPerChain), "client");
+}
+
+TEST(ChainedMuxLanes, ExecutesFenceInPostingOrderWithClientTasks) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  std::vector<std::string> results;
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    mux.post(Mux::Lane::Client, [&] { results.emplace_back("client 1"); });
+    mux.post(Mux::Lane::Synthetic, [&] { results.emplace_back("synthetic"); });
+    mux.post(Mux::Lane::Fence, [&] { results.emplace_back("fence"); });
+    mux.post(Mux::Lane::Client, [&] { results.emplace_back("client 2"); });
+    mux.post(Mux::Lane::Control, [&] { results.emplace_back("control"); });
+
+    release.set_value();
+    pool.await();
+  }
+
+  EXPECT_EQ(results,
+            (std::vector<std::string>{
+                "control", "client 1", "synthetic", "fence", "client 2"}));
+}
+
+TEST(ChainedMuxLanes, ExecutesFenceAfterSyntheticBacklogPostedBeforeIt) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  constexpr std::size_t synthetic_tasks =
+      ChainedMux::SyntheticTasksPerChain * 2 + 1;
+  std::vector<std::string> results;
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    for (std::size_t idx = 0; idx < synthetic_tasks; ++idx) {
+      mux.post(Mux::Lane::Synthetic,
+               [&results] { results.emplace_back("synthetic"); });
+    }
+    mux.post(Mux::Lane::Fence, [&] { results.emplace_back("fence"); });
+    mux.post(Mux::Lane::Client, [&] { results.emplace_back("client"); });
+
+    release.set_value();
+    pool.await();
+  }
+
+  ASSERT_EQ(results.size(), synthetic_tasks + 2);
+  EXPECT_EQ(results.at(synthetic_tasks), "fence");
+  EXPECT_EQ(results.at(synthetic_tasks + 1), "client");
+}
+
+TEST(ChainedMuxLanes, ExecutesSyntheticTasksAwaitedByFenceInSingleChain) {
+  auto pool = ThreadPool::create_simple_thread_pool(1);
+  constexpr std::size_t synthetic_tasks =
+      ChainedMux::SyntheticTasksPerChain * 2 + 1;
+  std::vector<std::string> results;
+
+  {
+    ChainedMux mux(pool);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    mux.post([released] { released.wait(); });
+    for (std::size_t idx = 0; idx < synthetic_tasks; ++idx) {
+      mux.post(Mux::Lane::Synthetic, [&mux, &results, idx] {
+        results.emplace_back("synthetic");
+        if (idx == 0) {
+          mux.post(Mux::Lane::Control,
+                   [&results] { results.emplace_back("control"); });
+        }
+      });
+    }
+    mux.post(Mux::Lane::Fence, [&] { results.emplace_back("fence"); });
+    mux.post(Mux::Lane::Client, [&] { results.emplace_back("client"); });
+
+    release.set_value();
+    pool.await();
+  }
+
+  // The control task, posted by the first synthetic task, waits for
+  // the chain, which takes the whole backlog, the fence and the client task
+  ASSERT_EQ(results.size(), synthetic_tasks + 3);
+  EXPECT_EQ(results.at(synthetic_tasks), "fence");
+  EXPECT_EQ(results.at(synthetic_tasks + 1), "client");
+  EXPECT_EQ(results.at(synthetic_tasks + 2), "control");
+}
+
 struct ChainedMuxTest : ::testing::TestWithParam<std::size_t> {
   auto SetUp() -> void override { threads_count = GetParam(); }
 
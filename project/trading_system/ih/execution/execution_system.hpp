@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_IH_EXECUTION_EXECUTION_SYSTEM_HPP_
 #define SIMULATOR_TRADING_SYSTEM_IH_EXECUTION_EXECUTION_SYSTEM_HPP_
 
+#include <cstddef>
 #include <functional>
 
 #include "common/market_state/snapshot.hpp"
@@ -8,14 +9,22 @@
 #include "ih/execution/reject_notifier.hpp"
 #include "ih/repository/repository_accessor.hpp"
 #include "ih/tools/instrument_resolver.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 #include "protocol/app/security_status_request.hpp"
 
 namespace simulator::trading_system {
 
+struct StateRecoveryResult {
+  std::size_t recovered_instruments{0};
+  std::size_t ignored_instruments{0};
+};
+
 struct Executor {
   virtual ~Executor() = default;
 
@@ -34,16 +43,34 @@ struct Executor {
   virtual auto execute_request(protocol::SecurityStatusRequest request) const
       -> void = 0;
 
+  virtual auto execute_request(protocol::OrderRequestBatch batch) const
+      -> void = 0;
+
   virtual auto execute_request(const protocol::InstrumentStateRequest& request,
                                protocol::InstrumentState& reply) const
       -> void = 0;
 
+  virtual auto execute_request(const protocol::InstrumentHandleRequest& request,
+                               protocol::InstrumentHandleReply& reply) const
+      -> void = 0;
+
+  virtual auto execute_request(protocol::ResolvedOrderRequests requests) const
+      -> void = 0;
+
+  virtual auto execute_request(protocol::ResolvedOrderRequest request) const
+      -> void = 0;
+
+  virtual auto execute_request(const protocol::EngineLoadRequest& request,
+                               protocol::EngineLoadReply& reply) const
+      -> void = 0;
+
   virtual auto store_state_request(
       std::vector<market_state::InstrumentState>& instruments) const
       -> void = 0;
 
   virtual auto recover_state_request(
-      std::vector<market_state::InstrumentState> instruments) const -> void = 0;
+      std::vector<market_state::InstrumentState> instruments) const
+      -> StateRecoveryResult = 0;
 
   virtual auto handle(const protocol::SessionTerminatedEvent& event) const
       -> void = 0;
@@ -74,16 +101,46 @@ class ExecutionSystem : public Executor {
   auto execute_request(protocol::SecurityStatusRequest request) const
       -> void override;
 
+  // Groups the requests of the batch by the resolved instrument and
+  // dispatches each group to its engine as a single operation.
+  // Requests with unresolved instruments are rejected individually.
+  auto execute_request(protocol::OrderRequestBatch batch) const
+      -> void override;
+
   auto execute_request(const protocol::InstrumentStateRequest& request,
                        protocol::InstrumentState& reply) const -> void override;
 
+  // Replies with the identifier of the resolved instrument as its handle.
+  auto execute_request(const protocol::InstrumentHandleRequest& request,
+                       protocol::InstrumentHandleReply& reply) const
+      -> void override;
+
+  // Dispatches the requests to the engine of the instrument handle
+  // as a single operation, instruments of the requests are not resolved.
+  auto execute_request(protocol::ResolvedOrderRequests requests) const
+      -> void override;
+
+  // Dispatches the request to the engine of the instrument handle
+  // as the request's own operation, no batch is made for it.
+  auto execute_request(protocol::ResolvedOrderRequest request) const
+      -> void override;
+
+  // Reads the load of the engine of the instrument handle without
+  // posting a command to the engine, so that it is not delayed by the load.
+  auto execute_request(const protocol::EngineLoadRequest& request,
+                       protocol::EngineLoadReply& reply) const
+      -> void override;
+
   auto store_state_request(
       std::vector<market_state::InstrumentState>& instruments) const
       -> void override;
 
+  // Dispatches recover commands to all resolved engines at once, so that
+  // the engines recover their states concurrently, and waits until
+  // all the dispatched commands are completed.
   auto recover_state_request(
       std::vector<market_state::InstrumentState> instruments) const
-      -> void override;
+      -> StateRecoveryResult override;
 
   auto handle(const protocol::SessionTerminatedEvent& event) const
       -> void override;
@@ -0,0 +1,112 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_JOURNAL_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_JOURNAL_HPP_
+
+#include <tl/expected.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "common/instrument.hpp"
+#include "common/market_state/journal.hpp"
+#include "common/market_state/snapshot.hpp"
+
+namespace simulator::trading_system {
+
+// Append-only journal of order book mutations made since the last stored
+// snapshot.
+//
+// The journal is split into numbered segments, each segment is a file named
+// `<base path>.<segment number>` holding one JSON document per line.
+// Engines only queue records, the records are written by a background thread
+// which commits a whole batch of pending records with a single write followed
+// by fdatasync, so committed records survive OS crashes and power loss.
+class MarketStateJournal {
+ public:
+  // Journal records of an instrument in the order they were appended.
+  struct InstrumentRecords {
+    Instrument instrument;
+    std::vector<market_state::JournalRecord> records;
+  };
+
+  // Opens a new segment following the already existing ones.
+  MarketStateJournal(std::filesystem::path base_path,
+                     const std::vector<Instrument>& instruments);
+
+  MarketStateJournal(const MarketStateJournal&) = delete;
+  MarketStateJournal(MarketStateJournal&&) = delete;
+  ~MarketStateJournal();
+
+  auto operator=(const MarketStateJournal&) -> MarketStateJournal& = delete;
+  auto operator=(MarketStateJournal&&) -> MarketStateJournal& = delete;
+
+  auto append(market_state::JournalRecord record) -> void;
+
+  // Starts a new segment, the records appended after the call are written
+  // to it. A snapshot stored after the call covers all previous segments,
+  // which can be discarded once the snapshot is written.
+  auto start_segment(const std::vector<Instrument>& instruments)
+      -> std::uint64_t;
+
+  auto discard_segments_before(std::uint64_t segment) -> void;
+
+  // Blocks until all the records appended before the call are written.
+  auto flush() -> void;
+
+  [[nodiscard]]
+  auto records_in_segment() const -> std::size_t;
+
+  [[nodiscard]]
+  auto segments() const -> std::vector<std::filesystem::path>;
+
+  // Reads the records of a segment and appends them to the records of
+  // their instruments, instruments missing from the list are appended to it.
+  // Returns the number of read records.
+  static auto read(std::istream& segment,
+                   std::vector<InstrumentRecords>& records)
+      -> tl::expected<std::size_t, std::string>;
+
+ private:
+  struct SegmentStart {
+    std::uint64_t number{0};
+    std::string header;
+  };
+
+  using Entry = std::variant<market_state::JournalRecord, SegmentStart>;
+
+  auto write_pending(std::stop_token stop) -> void;
+
+  auto write(std::vector<Entry>& batch) -> void;
+
+  auto open_segment(std::uint64_t segment) -> void;
+
+  auto close_segment() -> void;
+
+  auto segment_path(std::uint64_t segment) const -> std::filesystem::path;
+
+  auto segment_numbers() const -> std::vector<std::uint64_t>;
+
+  std::filesystem::path base_path_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable_any pending_cv_;
+  std::condition_variable written_cv_;
+  std::vector<Entry> pending_;
+  std::uint64_t appended_{0};
+  std::uint64_t written_{0};
+  std::uint64_t segment_{0};
+  std::size_t records_in_segment_{0};
+
+  int descriptor_{-1};
+  std::jthread writer_;
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_JOURNAL_HPP_
@@ -3,11 +3,14 @@
 
 #include <gsl/pointers>
 #include <memory>
+#include <mutex>
 
 #include "core/common/return_code.hpp"
 #include "ih/config/config.hpp"
 #include "ih/execution/execution_system.hpp"
+#include "ih/state_persistence/journal.hpp"
 #include "ih/state_persistence/serializer.hpp"
+#include "ih/state_persistence/shadow_market_state.hpp"
 
 namespace simulator::trading_system {
 
@@ -18,21 +21,35 @@ class MarketStatePersistenceController {
     std::string error_message;
   };
 
+  // When a journal is given, each stored snapshot is a journal checkpoint,
+  // and the journal is replayed on top of the recovered snapshot.
+  // Snapshot instruments are recovered one by one as they are parsed.
+  // When a shadow state is given, snapshots are stored from the shadow copy
+  // without asking engines for their state, the copy is reseeded from engines
+  // once they have recovered their state.
   explicit MarketStatePersistenceController(
       const Config& config,
       const Executor& executor,
       std::unique_ptr<Serializer> serializer,
       std::string venue_id,
-      std::vector<Instrument>&& instruments);
+      std::vector<Instrument>&& instruments,
+      MarketStateJournal* journal = nullptr,
+      ShadowMarketState* shadow = nullptr);
 
   auto store() -> core::code::StoreMarketState;
 
   auto recover() -> RecoverResult;
 
  private:
+  auto read_journal(std::vector<MarketStateJournal::InstrumentRecords>& records)
+      -> tl::expected<void, std::string>;
+
   const Config& config_;
   const Executor& executor_;
   gsl::not_null<std::unique_ptr<Serializer>> serializer_;
+  MarketStateJournal* journal_;
+  ShadowMarketState* shadow_;
+  std::mutex mutex_;
 
   std::string venue_id_;
   std::vector<Instrument> instruments_;
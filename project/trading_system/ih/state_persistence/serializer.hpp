@@ -1,6 +1,8 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SERIALIZER_HPP_
 #define SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SERIALIZER_HPP_
 
+#include <cstdint>
+#include <functional>
 #include <istream>
 #include <ostream>
 #include <tl/expected.hpp>
@@ -10,12 +12,22 @@
 namespace simulator::trading_system {
 
 struct Serializer {
+  using InstrumentStateConsumer =
+      std::function<void(market_state::InstrumentState)>;
+
   virtual auto serialize(const market_state::Snapshot& snapshot,
                          std::ostream& os) const -> bool = 0;
 
   virtual auto deserialize(std::istream& is) const
       -> tl::expected<market_state::Snapshot, std::string> = 0;
 
+  // Parses the snapshot from the stream, passing each instrument state to
+  // the consumer. Returns the snapshot venue id. On an error, instrument
+  // states parsed before it have already been passed to the consumer.
+  virtual auto deserialize(std::istream& is,
+                           const InstrumentStateConsumer& consumer) const
+      -> tl::expected<std::string, std::string> = 0;
+
   virtual ~Serializer() = default;
 };
 
@@ -27,6 +39,42 @@ class JsonSerializer : public Serializer {
   [[nodiscard]]
   auto deserialize(std::istream& is) const
       -> tl::expected<market_state::Snapshot, std::string> override;
+
+  // Parses the whole document before passing instrument states
+  // to the consumer.
+  [[nodiscard]]
+  auto deserialize(std::istream& is,
+                   const InstrumentStateConsumer& consumer) const
+      -> tl::expected<std::string, std::string> override;
+};
+
+// StreamingJsonSerializer produces and consumes the same JSON document as
+// JsonSerializer, but never materializes the whole document in memory.
+// Each instrument state is converted to/from a JSON value on its own, while
+// the snapshot envelope is emitted/parsed with rapidjson SAX handlers.
+// Thus, the peak memory used by the JSON representation is bounded by the
+// largest instrument state rather than by the whole venue state.
+class StreamingJsonSerializer : public Serializer {
+ public:
+  enum class Format : std::uint8_t { Pretty, Compact };
+
+  explicit StreamingJsonSerializer(Format format = Format::Pretty) noexcept;
+
+  auto serialize(const market_state::Snapshot& snapshot, std::ostream& os) const
+      -> bool override;
+
+  [[nodiscard]]
+  auto deserialize(std::istream& is) const
+      -> tl::expected<market_state::Snapshot, std::string> override;
+
+  // Passes each instrument state to the consumer as soon as it is parsed.
+  [[nodiscard]]
+  auto deserialize(std::istream& is,
+                   const InstrumentStateConsumer& consumer) const
+      -> tl::expected<std::string, std::string> override;
+
+ private:
+  Format format_;
 };
 
 }  // namespace simulator::trading_system
@@ -0,0 +1,62 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SHADOW_MARKET_STATE_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SHADOW_MARKET_STATE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/instrument.hpp"
+#include "common/market_state/journal.hpp"
+#include "common/market_state/snapshot.hpp"
+
+namespace simulator::trading_system {
+
+// Keeps a copy of the market state off the trading engine threads.
+//
+// Engines hand their order book mutations to the shadow state, which only
+// queues them. A capture swaps the queue with an empty one, which is the only
+// step made under the lock shared with engines, and applies the swapped
+// mutations to the copy on the capturing thread. Thus storing a snapshot
+// never stops engines for a copy of their state.
+//
+// Capturing and reseeding are expected to be called from a single thread
+// at a time, mutations may be appended concurrently from any thread.
+class ShadowMarketState {
+ public:
+  using Capture =
+      std::function<void(std::vector<market_state::InstrumentState>&)>;
+
+  ShadowMarketState(std::string venue_id,
+                    const std::vector<Instrument>& instruments);
+
+  auto append(market_state::JournalRecord record) -> void;
+
+  // Applies the mutations queued before the call to the copy,
+  // the returned snapshot stays unchanged until the next capture or reseed.
+  [[nodiscard]]
+  auto capture() -> const market_state::Snapshot&;
+
+  // Replaces the copy with the states the capture stores. Mutations queued
+  // before the call are dropped, as captured states already reflect them.
+  // Mutations queued while capturing are applied on top of the captured
+  // states, which is safe as mutations are idempotent.
+  auto reseed(const Capture& capture) -> void;
+
+ private:
+  auto apply(const market_state::JournalRecord& record) -> void;
+
+  std::mutex pending_mutex_;
+  std::vector<market_state::JournalRecord> pending_;
+
+  std::vector<market_state::JournalRecord> applying_;
+  market_state::Snapshot snapshot_;
+  std::unordered_map<std::uint64_t, std::size_t> indices_;
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SHADOW_MARKET_STATE_HPP_
@@ -0,0 +1,56 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SNAPSHOT_SCHEDULER_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SNAPSHOT_SCHEDULER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace simulator::trading_system {
+
+// Stores market state snapshots in background.
+//
+// The scheduler is driven by the runtime event loop, while the snapshot
+// itself (engines state capture, serialization and file writing) runs on
+// a dedicated thread, so neither the loop nor the engines wait for the I/O.
+// Requests made while a snapshot is being stored are coalesced.
+class SnapshotScheduler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // A zero interval disables periodic snapshots,
+  // explicitly requested snapshots are still stored.
+  SnapshotScheduler(std::chrono::seconds interval,
+                    std::function<void()> snapshot);
+
+  SnapshotScheduler(const SnapshotScheduler&) = delete;
+  SnapshotScheduler(SnapshotScheduler&&) = delete;
+  ~SnapshotScheduler() = default;
+
+  auto operator=(const SnapshotScheduler&) -> SnapshotScheduler& = delete;
+  auto operator=(SnapshotScheduler&&) -> SnapshotScheduler& = delete;
+
+  // Requests a snapshot if the interval has elapsed since the previous
+  // periodic one, returns whether the snapshot was requested.
+  auto tick(Clock::time_point now) -> bool;
+
+  auto request() -> void;
+
+ private:
+  auto run(std::stop_token stop) -> void;
+
+  std::chrono::seconds interval_;
+  std::function<void()> snapshot_;
+  Clock::time_point last_snapshot_;
+
+  std::mutex mutex_;
+  std::condition_variable_any requested_cv_;
+  bool requested_{false};
+
+  std::jthread worker_;
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_STATE_PERSISTENCE_SNAPSHOT_SCHEDULER_HPP_
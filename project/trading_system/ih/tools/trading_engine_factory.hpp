@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "common/instrument.hpp"
+#include "common/market_state/journal.hpp"
 #include "common/trading_engine.hpp"
 #include "ih/config/config.hpp"
 #include "runtime/service.hpp"
@@ -31,7 +32,8 @@ class TradingEngineFactory {
 
 [[nodiscard]]
 auto create_matching_engine_factory(const Config& config,
-                                    runtime::Service& executor)
+                                    runtime::Service& executor,
+                                    market_state::JournalSink journal)
     -> std::unique_ptr<TradingEngineFactory>;
 
 }  // namespace simulator::trading_system
@@ -7,15 +7,21 @@
 #include "ies/controller.hpp"
 #include "ih/config/config.hpp"
 #include "ih/execution/execution_system.hpp"
+#include "ih/state_persistence/journal.hpp"
 #include "ih/state_persistence/market_state_persistence_controller.hpp"
+#include "ih/state_persistence/shadow_market_state.hpp"
+#include "ih/state_persistence/snapshot_scheduler.hpp"
 #include "instruments/cache.hpp"
 #include "protocol/admin/market_state.hpp"
 #include "protocol/admin/trading_phase.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 #include "protocol/app/security_status_request.hpp"
 #include "protocol/app/session_terminated_event.hpp"
 #include "repository/repository_accessor.hpp"
@@ -39,9 +45,21 @@ class TradingSystemFacade {
 
   auto execute(const protocol::SecurityStatusRequest& request) -> void;
 
+  auto execute(protocol::OrderRequestBatch batch) -> void;
+
   auto execute(const protocol::InstrumentStateRequest& request,
                protocol::InstrumentState& reply) -> void;
 
+  auto execute(const protocol::InstrumentHandleRequest& request,
+               protocol::InstrumentHandleReply& reply) -> void;
+
+  auto execute(protocol::ResolvedOrderRequests requests) -> void;
+
+  auto execute(protocol::ResolvedOrderRequest request) -> void;
+
+  auto execute(const protocol::EngineLoadRequest& request,
+               protocol::EngineLoadReply& reply) -> void;
+
   auto execute(const protocol::HaltPhaseRequest& request,
                protocol::HaltPhaseReply& reply) -> void;
 
@@ -63,6 +81,8 @@ class TradingSystemFacade {
 
   auto launch_ies() -> void;
 
+  auto schedule_snapshots() -> void;
+
   auto process(const event::Tick& event) -> void;
 
   auto process(const event::PhaseTransition& event) -> void;
@@ -71,6 +91,8 @@ class TradingSystemFacade {
   runtime::Loop event_loop_;
   instrument::Cache instruments_;
   Config config_;
+  std::unique_ptr<MarketStateJournal> journal_;
+  std::unique_ptr<ShadowMarketState> shadow_state_;
 
   std::unique_ptr<InstrumentResolver> instrument_resolver_;
 
@@ -81,6 +103,7 @@ class TradingSystemFacade {
   ies::Controller event_controller_;
 
   MarketStatePersistenceController persistence_controller_;
+  std::unique_ptr<SnapshotScheduler> snapshot_scheduler_;
 };
 
 }  // namespace simulator::trading_system
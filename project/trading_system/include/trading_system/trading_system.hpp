@@ -6,11 +6,14 @@
 #include "data_layer/api/database/context.hpp"
 #include "protocol/admin/market_state.hpp"
 #include "protocol/admin/trading_phase.hpp"
+#include "protocol/app/engine_load_request.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/order_request_batch.hpp"
+#include "protocol/app/resolved_order_requests.hpp"
 #include "protocol/app/security_status_request.hpp"
 #include "protocol/app/session_terminated_event.hpp"
 
@@ -56,10 +59,27 @@ auto process(protocol::MarketDataRequest request, System& trading_system)
 auto process(protocol::SecurityStatusRequest request, System& trading_system)
     -> void;
 
+auto process(protocol::OrderRequestBatch batch, System& trading_system)
+    -> void;
+
 auto process(const protocol::InstrumentStateRequest& request,
              protocol::InstrumentState& reply,
              System& trading_system) -> void;
 
+auto process(const protocol::InstrumentHandleRequest& request,
+             protocol::InstrumentHandleReply& reply,
+             System& trading_system) -> void;
+
+auto process(protocol::ResolvedOrderRequests requests, System& trading_system)
+    -> void;
+
+auto process(protocol::ResolvedOrderRequest request, System& trading_system)
+    -> void;
+
+auto process(const protocol::EngineLoadRequest& request,
+             protocol::EngineLoadReply& reply,
+             System& trading_system) -> void;
+
 auto process(const protocol::HaltPhaseRequest& request,
              protocol::HaltPhaseReply& reply,
              System& trading_system) -> void;
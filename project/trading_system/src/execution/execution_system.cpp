@@ -1,6 +1,13 @@
 #include "ih/execution/execution_system.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
 #include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "common/trading_engine.hpp"
 #include "instruments/lookup_error.hpp"
@@ -9,6 +16,9 @@
 namespace simulator::trading_system {
 namespace {
 
+using InstrumentRequests =
+    std::pair<InstrumentId, std::vector<protocol::OrderRequest>>;
+
 auto make_operation(protocol::OrderPlacementRequest request) {
   return [request = std::move(request)](TradingEngine& engine) mutable {
     engine.execute(std::move(request));
@@ -39,6 +49,12 @@ auto make_operation(protocol::SecurityStatusRequest request) {
   };
 }
 
+auto make_operation(std::vector<protocol::OrderRequest> requests) {
+  return [requests = std::move(requests)](TradingEngine& engine) mutable {
+    engine.execute(std::move(requests));
+  };
+}
+
 auto make_operation(protocol::InstrumentState& state) {
   return [state = std::ref(state)](TradingEngine& engine) {
     engine.provide_state(state);
@@ -51,9 +67,42 @@ auto make_store_operation(market_state::InstrumentState& state) {
   };
 }
 
-auto make_recover_operation(market_state::InstrumentState state) {
-  return [state = std::move(state)](TradingEngine& engine) mutable {
-    engine.recover_state(std::move(state));
+// Tracks recover commands being executed by trading engines concurrently.
+class PendingRecoveries {
+ public:
+  auto started() -> void {
+    std::lock_guard lock{mutex_};
+    ++pending_;
+  }
+
+  auto completed() -> void {
+    std::lock_guard lock{mutex_};
+    ++completed_;
+    if (--pending_ == 0) {
+      all_completed_.notify_all();
+    }
+  }
+
+  auto await() -> std::size_t {
+    std::unique_lock lock{mutex_};
+    all_completed_.wait(lock, [this] { return pending_ == 0; });
+    return completed_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable all_completed_;
+  std::size_t pending_{0};
+  std::size_t completed_{0};
+};
+
+auto make_recover_operation(market_state::InstrumentState state,
+                            PendingRecoveries& recoveries) {
+  return [state = std::move(state),
+          &recoveries](TradingEngine& engine) mutable {
+    recoveries.started();
+    engine.recover_state(std::move(state),
+                         [&recoveries] { recoveries.completed(); });
   };
 }
 
@@ -119,6 +168,46 @@ auto ExecutionSystem::execute_request(
   }
 }
 
+auto ExecutionSystem::execute_request(
+    const protocol::InstrumentHandleRequest& request,
+    protocol::InstrumentHandleReply& reply) const -> void {
+  const auto view = instrument_resolver_.resolve_instrument(request.instrument);
+  if (view.has_value()) {
+    reply.handle =
+        protocol::InstrumentHandle{view->instrument().identifier.value()};
+  } else {
+    // This is an internal request, sent by generator, we cannot reject it
+    log::warn("failed to resolve instrument handle - {}",
+              describe(view.error()));
+  }
+}
+
+auto ExecutionSystem::execute_request(
+    protocol::ResolvedOrderRequests requests) const -> void {
+  if (requests.requests.empty()) {
+    return;
+  }
+  unicast(InstrumentId{requests.instrument.value},
+          make_operation(std::move(requests.requests)));
+}
+
+auto ExecutionSystem::execute_request(
+    protocol::ResolvedOrderRequest request) const -> void {
+  const InstrumentId instrument{request.instrument.value};
+  std::visit(
+      [&](auto& order_request) {
+        unicast(instrument, make_operation(std::move(order_request)));
+      },
+      request.request);
+}
+
+auto ExecutionSystem::execute_request(
+    const protocol::EngineLoadRequest& request,
+    protocol::EngineLoadReply& reply) const -> void {
+  unicast(InstrumentId{request.instrument.value},
+          [&reply](TradingEngine& engine) { reply.load = engine.load(); });
+}
+
 auto ExecutionSystem::execute_request(protocol::MarketDataRequest request) const
     -> void {
   if (request.instruments.empty()) {
@@ -150,6 +239,42 @@ auto ExecutionSystem::execute_request(
   }
 }
 
+auto ExecutionSystem::execute_request(protocol::OrderRequestBatch batch) const
+    -> void {
+  // Engines are resolved once per instrument, requests keep their order
+  // within each instrument group.
+  std::vector<InstrumentRequests> groups;
+
+  for (auto& request : batch) {
+    const auto& instrument = std::visit(
+        [](const auto& order_request) -> const InstrumentDescriptor& {
+          return order_request.instrument;
+        },
+        request);
+    const auto view = instrument_resolver_.resolve_instrument(instrument);
+    if (!view.has_value()) {
+      std::visit(
+          [&](const auto& order_request) {
+            reject_notifier_.reject(order_request, describe(view.error()));
+          },
+          request);
+      continue;
+    }
+
+    const auto instrument_id = view->instrument().identifier;
+    auto group =
+        std::ranges::find(groups, instrument_id, &InstrumentRequests::first);
+    if (group == groups.end()) {
+      group = groups.insert(groups.end(), {instrument_id, {}});
+    }
+    group->second.emplace_back(std::move(request));
+  }
+
+  for (auto& [instrument_id, requests] : groups) {
+    unicast(instrument_id, make_operation(std::move(requests)));
+  }
+}
+
 auto ExecutionSystem::store_state_request(
     std::vector<market_state::InstrumentState>& instruments) const -> void {
   for (auto& instrument_state : instruments) {
@@ -159,18 +284,26 @@ auto ExecutionSystem::store_state_request(
 }
 
 auto ExecutionSystem::recover_state_request(
-    std::vector<market_state::InstrumentState> instruments) const -> void {
+    std::vector<market_state::InstrumentState> instruments) const
+    -> StateRecoveryResult {
+  StateRecoveryResult result;
+  PendingRecoveries recoveries;
+
   for (auto&& instrument_state : instruments) {
     const auto view =
         instrument_resolver_.resolve_instrument(instrument_state.instrument);
     if (view.has_value()) {
       unicast(view->instrument().identifier,
-              make_recover_operation(std::move(instrument_state)));
+              make_recover_operation(std::move(instrument_state), recoveries));
     } else {
       log::warn("The instrument was not found, its recovery was ignored: {}",
                 instrument_state.instrument);
+      ++result.ignored_instruments;
     }
   }
+
+  result.recovered_instruments = recoveries.await();
+  return result;
 }
 
 auto ExecutionSystem::handle(
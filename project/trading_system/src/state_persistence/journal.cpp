@@ -0,0 +1,447 @@
+#include "ih/state_persistence/journal.hpp"
+
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include "common/json/instrument.hpp"
+#include "common/json/trade.hpp"
+#include "common/market_state/json/journal.hpp"
+#include "core/tools/overload.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system {
+
+namespace {
+
+constexpr std::string_view InstrumentsKey{"instruments"};
+constexpr std::string_view IdentifierKey{"identifier"};
+constexpr std::string_view InstrumentKey{"instrument"};
+constexpr std::string_view InstrumentIdKey{"instrument_id"};
+constexpr std::string_view OrderAddedKey{"order_added"};
+constexpr std::string_view OrderReducedKey{"order_reduced"};
+constexpr std::string_view OrderRemovedKey{"order_removed"};
+constexpr std::string_view TradeKey{"trade"};
+
+using market_state::JournalRecord;
+using InstrumentIndex = std::pair<InstrumentId, std::size_t>;
+using InstrumentRecords = MarketStateJournal::InstrumentRecords;
+
+auto append_line(const rapidjson::Document& document, std::string& buffer)
+    -> void {
+  rapidjson::StringBuffer json;
+  rapidjson::Writer<rapidjson::StringBuffer> writer{json};
+  document.Accept(writer);
+  buffer.append(json.GetString(), json.GetSize());
+  buffer.push_back('\n');
+}
+
+auto encode_header(const std::vector<Instrument>& instruments) -> std::string {
+  rapidjson::Document document{rapidjson::Type::kObjectType};
+  auto& allocator = document.GetAllocator();
+
+  rapidjson::Value json_instruments{rapidjson::Type::kArrayType};
+  json_instruments.Reserve(static_cast<rapidjson::SizeType>(instruments.size()),
+                           allocator);
+  for (const auto& instrument : instruments) {
+    rapidjson::Value item{rapidjson::Type::kObjectType};
+    core::json::write_json_value(
+        item, allocator, instrument.identifier, IdentifierKey);
+    core::json::write_json_value(item, allocator, instrument, InstrumentKey);
+    json_instruments.PushBack(item.Move(), allocator);
+  }
+  document.AddMember(
+      rapidjson::StringRef(InstrumentsKey.data(), InstrumentsKey.size()),
+      json_instruments.Move(),
+      allocator);
+
+  std::string header;
+  append_line(document, header);
+  return header;
+}
+
+auto encode(const JournalRecord& record, std::string& buffer) -> void {
+  rapidjson::Document document{rapidjson::Type::kObjectType};
+  auto& allocator = document.GetAllocator();
+
+  core::json::write_json_value(
+      document, allocator, record.instrument_id, InstrumentIdKey);
+  const auto dispatcher = core::overload(
+      [&](const JournalRecord::OrderAdded& added) {
+        core::json::write_json_value(document, allocator, added, OrderAddedKey);
+      },
+      [&](const JournalRecord::OrderReduced& reduced) {
+        core::json::write_json_value(
+            document, allocator, reduced, OrderReducedKey);
+      },
+      [&](const JournalRecord::OrderRemoved& removed) {
+        core::json::write_json_value(
+            document, allocator, removed, OrderRemovedKey);
+      },
+      [&](const Trade& trade) {
+        core::json::write_json_value(document, allocator, trade, TradeKey);
+      });
+  std::visit(dispatcher, record.mutation);
+
+  append_line(document, buffer);
+}
+
+auto decode_mutation(const rapidjson::Value& json) -> JournalRecord::Mutation {
+  if (json.HasMember(OrderAddedKey.data())) {
+    return core::json::read_json_value<JournalRecord::OrderAdded>(
+        json, OrderAddedKey);
+  }
+  if (json.HasMember(OrderReducedKey.data())) {
+    return core::json::read_json_value<JournalRecord::OrderReduced>(
+        json, OrderReducedKey);
+  }
+  if (json.HasMember(OrderRemovedKey.data())) {
+    return core::json::read_json_value<JournalRecord::OrderRemoved>(
+        json, OrderRemovedKey);
+  }
+  if (json.HasMember(TradeKey.data())) {
+    return core::json::read_json_value<Trade>(json, TradeKey);
+  }
+  throw std::runtime_error{"unknown journal record type"};
+}
+
+auto decode_header(const rapidjson::Value& json,
+                   std::vector<InstrumentRecords>& records)
+    -> std::vector<InstrumentIndex> {
+  const auto json_instruments = json.FindMember(InstrumentsKey.data());
+  if (json_instruments == json.MemberEnd() ||
+      !json_instruments->value.IsArray()) {
+    throw std::runtime_error{"journal header has no instruments list"};
+  }
+
+  std::vector<InstrumentIndex> indices;
+  for (const auto& item : json_instruments->value.GetArray()) {
+    const auto identifier =
+        core::json::read_json_value<InstrumentId>(item, IdentifierKey);
+    const auto instrument =
+        core::json::read_json_value<Instrument>(item, InstrumentKey);
+
+    const auto records_it = std::ranges::find(
+        records, instrument, &InstrumentRecords::instrument);
+    const auto index =
+        static_cast<std::size_t>(std::distance(records.begin(), records_it));
+    if (records_it == records.end()) {
+      records.push_back({.instrument = instrument, .records = {}});
+    }
+    indices.emplace_back(identifier, index);
+  }
+  return indices;
+}
+
+auto parse_line(const std::string& line, rapidjson::Document& document)
+    -> std::optional<std::string> {
+  document.Parse(line.data(), line.size());
+  if (document.HasParseError()) {
+    return fmt::format("Error parsing JSON on offset {}: {}",
+                       document.GetErrorOffset(),
+                       rapidjson::GetParseError_En(document.GetParseError()));
+  }
+  if (!document.IsObject()) {
+    return std::string{"JSON object is expected"};
+  }
+  return std::nullopt;
+}
+
+auto last_error() -> std::string {
+  return std::error_code{errno, std::generic_category()}.message();
+}
+
+auto write_fully(int descriptor, std::string_view data) -> bool {
+  while (!data.empty()) {
+    const auto written = ::write(descriptor, data.data(), data.size());
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data.remove_prefix(static_cast<std::size_t>(written));
+  }
+  return true;
+}
+
+// Makes a newly created segment file entry durable.
+auto sync_directory(const std::filesystem::path& directory) -> void {
+  const int descriptor =
+      ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (descriptor < 0 || ::fsync(descriptor) != 0) {
+    log::warn("failed to sync market state journal directory {}: {}",
+              directory.string(),
+              last_error());
+  }
+  if (descriptor >= 0) {
+    ::close(descriptor);
+  }
+}
+
+}  // namespace
+
+MarketStateJournal::MarketStateJournal(
+    std::filesystem::path base_path, const std::vector<Instrument>& instruments)
+    : base_path_{std::move(base_path)} {
+  const auto numbers = segment_numbers();
+  segment_ = numbers.empty() ? 0 : numbers.back();
+  start_segment(instruments);
+
+  writer_ = std::jthread{
+      [this](std::stop_token stop) { write_pending(std::move(stop)); }};
+}
+
+MarketStateJournal::~MarketStateJournal() {
+  writer_.request_stop();
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  close_segment();
+}
+
+auto MarketStateJournal::append(JournalRecord record) -> void {
+  {
+    const std::lock_guard lock{mutex_};
+    pending_.emplace_back(std::move(record));
+    ++appended_;
+    ++records_in_segment_;
+  }
+  pending_cv_.notify_one();
+}
+
+auto MarketStateJournal::start_segment(
+    const std::vector<Instrument>& instruments) -> std::uint64_t {
+  SegmentStart start{.number = 0, .header = encode_header(instruments)};
+  {
+    const std::lock_guard lock{mutex_};
+    start.number = ++segment_;
+    pending_.emplace_back(start);
+    ++appended_;
+    records_in_segment_ = 0;
+  }
+  pending_cv_.notify_one();
+
+  log::debug("market state journal segment {} started", start.number);
+  return start.number;
+}
+
+auto MarketStateJournal::discard_segments_before(std::uint64_t segment)
+    -> void {
+  for (const auto number : segment_numbers()) {
+    if (number >= segment) {
+      break;
+    }
+    std::error_code error;
+    std::filesystem::remove(segment_path(number), error);
+    if (error) {
+      log::warn("failed to remove market state journal segment {}: {}",
+                segment_path(number).string(),
+                error.message());
+    }
+  }
+}
+
+auto MarketStateJournal::flush() -> void {
+  std::unique_lock lock{mutex_};
+  const auto target = appended_;
+  written_cv_.wait(lock, [this, target] { return written_ >= target; });
+}
+
+auto MarketStateJournal::records_in_segment() const -> std::size_t {
+  const std::lock_guard lock{mutex_};
+  return records_in_segment_;
+}
+
+auto MarketStateJournal::segments() const
+    -> std::vector<std::filesystem::path> {
+  std::vector<std::filesystem::path> paths;
+  for (const auto number : segment_numbers()) {
+    paths.push_back(segment_path(number));
+  }
+  return paths;
+}
+
+auto MarketStateJournal::read(std::istream& segment,
+                              std::vector<InstrumentRecords>& records)
+    -> tl::expected<std::size_t, std::string> {
+  std::vector<InstrumentIndex> indices;
+  std::size_t records_read = 0;
+  std::size_t line_number = 0;
+  std::string line;
+  rapidjson::Document document;
+
+  while (std::getline(segment, line)) {
+    ++line_number;
+    if (auto error = parse_line(line, document)) {
+      if (segment.eof()) {
+        // The last record may be torn if the process has been terminated
+        // while the writer was appending it.
+        log::warn("ignoring incomplete market state journal record: {}",
+                  *error);
+        break;
+      }
+      return tl::unexpected{fmt::format("line {}: {}", line_number, *error)};
+    }
+
+    try {
+      if (line_number == 1) {
+        indices = decode_header(document, records);
+        continue;
+      }
+
+      const auto instrument_id =
+          core::json::read_json_value<InstrumentId>(document, InstrumentIdKey);
+      const auto index_it =
+          std::ranges::find(indices, instrument_id, &InstrumentIndex::first);
+      if (index_it == indices.end()) {
+        log::warn(
+            "ignoring market state journal record of an unknown instrument {}",
+            instrument_id);
+        continue;
+      }
+
+      records[index_it->second].records.push_back(
+          JournalRecord{.instrument_id = instrument_id,
+                        .mutation = decode_mutation(document)});
+      ++records_read;
+    } catch (const std::runtime_error& error) {
+      return tl::unexpected{fmt::format(
+          "line {}: Error deserializing JSON: {}", line_number, error.what())};
+    }
+  }
+
+  return records_read;
+}
+
+auto MarketStateJournal::write_pending(std::stop_token stop) -> void {
+  log::debug("market state journal writer started");
+
+  std::vector<Entry> batch;
+  while (true) {
+    {
+      std::unique_lock lock{mutex_};
+      pending_cv_.wait(lock, stop, [this] { return !pending_.empty(); });
+      if (pending_.empty()) {
+        break;
+      }
+      batch.swap(pending_);
+    }
+
+    write(batch);
+
+    {
+      const std::lock_guard lock{mutex_};
+      written_ += batch.size();
+    }
+    written_cv_.notify_all();
+    batch.clear();
+  }
+
+  log::debug("market state journal writer stopped");
+}
+
+auto MarketStateJournal::write(std::vector<Entry>& batch) -> void {
+  std::string buffer;
+
+  // All records of a batch are committed with a single write and sync.
+  const auto commit = [this, &buffer] {
+    if (buffer.empty()) {
+      return;
+    }
+    if (descriptor_ < 0 || !write_fully(descriptor_, buffer) ||
+        ::fdatasync(descriptor_) != 0) {
+      log::err("failed to commit {} bytes to the market state journal: {}",
+               buffer.size(),
+               last_error());
+    }
+    buffer.clear();
+  };
+
+  const auto dispatcher = core::overload(
+      [&](const JournalRecord& record) { encode(record, buffer); },
+      [&](const SegmentStart& start) {
+        commit();
+        open_segment(start.number);
+        buffer = start.header;
+      });
+
+  for (const auto& entry : batch) {
+    std::visit(dispatcher, entry);
+  }
+  commit();
+}
+
+auto MarketStateJournal::open_segment(std::uint64_t segment) -> void {
+  close_segment();
+
+  const auto path = segment_path(segment);
+  descriptor_ = ::open(
+      path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (descriptor_ < 0) {
+    log::err("failed to open market state journal segment {}: {}",
+             path.string(),
+             last_error());
+    return;
+  }
+  sync_directory(path.has_parent_path() ? path.parent_path()
+                                        : std::filesystem::current_path());
+}
+
+auto MarketStateJournal::close_segment() -> void {
+  if (descriptor_ >= 0) {
+    ::close(descriptor_);
+    descriptor_ = -1;
+  }
+}
+
+auto MarketStateJournal::segment_path(std::uint64_t segment) const
+    -> std::filesystem::path {
+  auto path = base_path_;
+  path += fmt::format(".{}", segment);
+  return path;
+}
+
+auto MarketStateJournal::segment_numbers() const -> std::vector<std::uint64_t> {
+  const auto directory = base_path_.has_parent_path()
+                             ? base_path_.parent_path()
+                             : std::filesystem::current_path();
+  const auto prefix = base_path_.filename().string() + ".";
+
+  std::vector<std::uint64_t> numbers;
+  std::error_code error;
+  for (const auto& entry :
+       std::filesystem::directory_iterator{directory, error}) {
+    const auto filename = entry.path().filename().string();
+    if (!entry.is_regular_file() || !filename.starts_with(prefix)) {
+      continue;
+    }
+
+    const std::string_view suffix{filename.data() + prefix.size(),
+                                  filename.size() - prefix.size()};
+    std::uint64_t number = 0;
+    const auto [end, code] =
+        std::from_chars(suffix.data(), suffix.data() + suffix.size(), number);
+    if (code == std::errc{} && end == suffix.data() + suffix.size()) {
+      numbers.push_back(number);
+    }
+  }
+
+  std::ranges::sort(numbers);
+  return numbers;
+}
+
+}  // namespace simulator::trading_system
@@ -1,7 +1,14 @@
 #include "ih/state_persistence/market_state_persistence_controller.hpp"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
+#include <optional>
+#include <system_error>
+#include <utility>
 
 #include "log/logging.hpp"
 
@@ -30,14 +37,20 @@ MarketStatePersistenceController::MarketStatePersistenceController(
     const Executor& executor,
     std::unique_ptr<Serializer> serializer,
     std::string venue_id,
-    std::vector<Instrument>&& instruments)
+    std::vector<Instrument>&& instruments,
+    MarketStateJournal* journal,
+    ShadowMarketState* shadow)
     : config_{config},
       executor_{executor},
       serializer_{std::move(serializer)},
+      journal_{journal},
+      shadow_{shadow},
       venue_id_{std::move(venue_id)},
       instruments_{instruments} {}
 
 auto MarketStatePersistenceController::store() -> core::code::StoreMarketState {
+  const std::lock_guard lock{mutex_};
+
   if (!config_.persistence_enabled()) {
     log::info("The market state was not stored: the persistence is disabled.");
     return core::code::StoreMarketState::PersistenceDisabled;
@@ -59,22 +72,55 @@ auto MarketStatePersistenceController::store() -> core::code::StoreMarketState {
     return core::code::StoreMarketState::PersistenceFilePathIsUnreachable;
   }
 
-  std::ofstream ofs{file_path};
+  // The snapshot is written aside and renamed once complete, so a previous
+  // snapshot (and the journal segments following it) stays usable if the
+  // process is terminated while storing.
+  auto temporary_file_path = file_path;
+  temporary_file_path += ".tmp";
+
+  std::ofstream ofs{temporary_file_path};
   if (!ofs.is_open()) {
     log::err(
         "The market state was not stored: an error when unable to open file.");
     return core::code::StoreMarketState::ErrorWhenOpeningPersistenceFile;
   }
 
-  market_state::Snapshot snapshot = make_snapshot(venue_id_, instruments_);
-  executor_.store_state_request(snapshot.instruments);
+  // The segment is started before the state is captured: records queued
+  // earlier are reflected in the snapshot, and records racing with the capture
+  // land in the new segment, which is safe as journal records are idempotent.
+  const auto journal_segment =
+      journal_ != nullptr
+          ? std::make_optional(journal_->start_segment(instruments_))
+          : std::nullopt;
+
+  bool serialized = false;
+  if (shadow_ != nullptr) {
+    serialized = serializer_->serialize(shadow_->capture(), ofs);
+  } else {
+    market_state::Snapshot snapshot = make_snapshot(venue_id_, instruments_);
+    executor_.store_state_request(snapshot.instruments);
+    serialized = serializer_->serialize(snapshot, ofs);
+  }
+  ofs.close();
 
-  return serializer_->serialize(snapshot, ofs)
-             ? core::code::StoreMarketState::Stored
-             : core::code::StoreMarketState::ErrorWhenWritingToPersistenceFile;
+  std::error_code error;
+  if (serialized && ofs) {
+    std::filesystem::rename(temporary_file_path, file_path, error);
+  }
+  if (!serialized || !ofs || error) {
+    std::filesystem::remove(temporary_file_path, error);
+    return core::code::StoreMarketState::ErrorWhenWritingToPersistenceFile;
+  }
+
+  if (journal_segment.has_value()) {
+    journal_->discard_segments_before(*journal_segment);
+  }
+  return core::code::StoreMarketState::Stored;
 }
 
 auto MarketStatePersistenceController::recover() -> RecoverResult {
+  const std::lock_guard lock{mutex_};
+
   if (!config_.persistence_enabled()) {
     log::info(
         "The market state was not recovered: the persistence is disabled.");
@@ -106,8 +152,47 @@ auto MarketStatePersistenceController::recover() -> RecoverResult {
             {}};
   }
 
-  auto result = serializer_->deserialize(ifs);
-  if (!result.has_value()) {
+  std::vector<MarketStateJournal::InstrumentRecords> journal_records;
+  if (auto read = read_journal(journal_records); !read) {
+    log::err(
+        "The market state was not recovered: the journal is malformed: {}",
+        read.error());
+    return {core::code::RecoverMarketState::PersistenceFileIsMalformed,
+            std::move(read.error())};
+  }
+
+  // Instrument states are recovered one by one while the snapshot is parsed,
+  // so the whole snapshot is never held in memory. Journal records are applied
+  // to each state on top of the snapshot before the state is recovered.
+  std::size_t recovered = 0;
+  std::size_t ignored = 0;
+  const auto recover_instrument =
+      [&](market_state::InstrumentState instrument_state) {
+        using InstrumentRecords = MarketStateJournal::InstrumentRecords;
+        const auto records_it =
+            std::ranges::find(journal_records,
+                              instrument_state.instrument,
+                              &InstrumentRecords::instrument);
+        if (records_it != journal_records.end()) {
+          for (const auto& record : records_it->records) {
+            market_state::apply(record, instrument_state);
+          }
+          // The order of instruments left in the journal does not matter.
+          std::swap(*records_it, journal_records.back());
+          journal_records.pop_back();
+        }
+
+        std::vector<market_state::InstrumentState> states;
+        states.push_back(std::move(instrument_state));
+        const auto [instrument_recovered, instrument_ignored] =
+            executor_.recover_state_request(std::move(states));
+        recovered += instrument_recovered;
+        ignored += instrument_ignored;
+      };
+
+  // Instruments parsed before a malformed part of the file stay recovered.
+  if (auto result = serializer_->deserialize(ifs, recover_instrument);
+      !result.has_value()) {
     log::err(
         "The market state was not recovered: the persistence file is "
         "malformed: {}",
@@ -116,9 +201,47 @@ auto MarketStatePersistenceController::recover() -> RecoverResult {
             std::move(result.error())};
   }
 
-  executor_.recover_state_request(result->instruments);
+  // Instruments missing from the snapshot are recovered from their journal
+  // records alone, recovering an instrument drops its records from the list.
+  while (!journal_records.empty()) {
+    recover_instrument(market_state::InstrumentState{
+        .instrument = journal_records.back().instrument});
+  }
+
+  if (shadow_ != nullptr) {
+    shadow_->reseed([this](std::vector<market_state::InstrumentState>& states) {
+      executor_.store_state_request(states);
+    });
+  }
+  log::info(
+      "The market state was recovered: {} instrument(s) recovered, {} "
+      "instrument(s) ignored.",
+      recovered,
+      ignored);
 
   return {core::code::RecoverMarketState::Recovered, {}};
 }
 
+auto MarketStatePersistenceController::read_journal(
+    std::vector<MarketStateJournal::InstrumentRecords>& records)
+    -> tl::expected<void, std::string> {
+  if (journal_ == nullptr) {
+    return {};
+  }
+
+  journal_->flush();
+  for (const auto& segment_path : journal_->segments()) {
+    std::ifstream segment{segment_path};
+    auto read = MarketStateJournal::read(segment, records);
+    if (!read.has_value()) {
+      return tl::unexpected{
+          fmt::format("{}: {}", segment_path.string(), read.error())};
+    }
+    log::info("{} market state journal record(s) read from {}",
+              *read,
+              segment_path.string());
+  }
+  return {};
+}
+
 }  // namespace simulator::trading_system
@@ -6,10 +6,325 @@
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <utility>
 
 #include "common/market_state/json/snapshot.hpp"
 
 namespace simulator::trading_system {
+namespace {
+
+constexpr std::string_view VenueIdKey{"venue_id"};
+constexpr std::string_view InstrumentsKey{"instruments"};
+
+constexpr unsigned StreamParseFlags = rapidjson::kParseDefaultFlags;
+
+auto format_parse_error(rapidjson::ParseErrorCode code, std::size_t offset)
+    -> std::string {
+  if (offset > 0) {
+    return fmt::format("Error parsing JSON on offset {}: {}",
+                       offset,
+                       rapidjson::GetParseError_En(code));
+  }
+  return fmt::format("Error parsing JSON: {}",
+                     rapidjson::GetParseError_En(code));
+}
+
+// Tracks the snapshot envelope (the root object, the venue id and
+// the instruments array) while parsing a snapshot as a stream of SAX events.
+// When an instrument state object begins, the handler marks it as pending,
+// so that the caller reads the object with the same reader separately.
+class SnapshotEnvelopeHandler
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>,
+                                          SnapshotEnvelopeHandler> {
+  enum class Field : std::uint8_t { Unknown, VenueId, Instruments };
+
+ public:
+  auto Null() -> bool { return on_value(rapidjson::kNullType); }
+
+  auto Bool(bool value) -> bool {
+    return on_value(value ? rapidjson::kTrueType : rapidjson::kFalseType);
+  }
+
+  auto Int(int /*value*/) -> bool { return on_value(rapidjson::kNumberType); }
+
+  auto Uint(unsigned /*value*/) -> bool {
+    return on_value(rapidjson::kNumberType);
+  }
+
+  auto Int64(std::int64_t /*value*/) -> bool {
+    return on_value(rapidjson::kNumberType);
+  }
+
+  auto Uint64(std::uint64_t /*value*/) -> bool {
+    return on_value(rapidjson::kNumberType);
+  }
+
+  auto Double(double /*value*/) -> bool {
+    return on_value(rapidjson::kNumberType);
+  }
+
+  auto String(const char* str, rapidjson::SizeType length, bool /*copy*/)
+      -> bool {
+    if (!on_value(rapidjson::kStringType)) {
+      return false;
+    }
+    if (depth_ == 1 && field_ == Field::VenueId) {
+      venue_id_.emplace(str, length);
+    }
+    return true;
+  }
+
+  auto Key(const char* str, rapidjson::SizeType length, bool /*copy*/)
+      -> bool {
+    if (depth_ == 1) {
+      const std::string_view key{str, length};
+      if (key == VenueIdKey) {
+        field_ = Field::VenueId;
+      } else if (key == InstrumentsKey) {
+        field_ = Field::Instruments;
+      } else {
+        field_ = Field::Unknown;
+      }
+    }
+    return true;
+  }
+
+  auto StartObject() -> bool {
+    if (!on_value(rapidjson::kObjectType)) {
+      return false;
+    }
+    if (inside_instruments()) {
+      pending_instrument_ = true;
+      return true;
+    }
+    ++depth_;
+    return true;
+  }
+
+  auto EndObject(rapidjson::SizeType /*members*/) -> bool {
+    --depth_;
+    return true;
+  }
+
+  auto StartArray() -> bool {
+    if (!on_value(rapidjson::kArrayType)) {
+      return false;
+    }
+    if (depth_ == 1 && field_ == Field::Instruments) {
+      instruments_found_ = true;
+    }
+    ++depth_;
+    return true;
+  }
+
+  auto EndArray(rapidjson::SizeType /*elements*/) -> bool {
+    --depth_;
+    return true;
+  }
+
+  // Returns the index of the instrument state object which has begun,
+  // if any, and resets the pending state.
+  auto take_pending_instrument() -> std::optional<std::size_t> {
+    if (!pending_instrument_) {
+      return std::nullopt;
+    }
+    pending_instrument_ = false;
+    return instruments_count_++;
+  }
+
+  [[nodiscard]]
+  auto error() const -> const std::optional<std::string>& {
+    return error_;
+  }
+
+  [[nodiscard]]
+  auto venue_id() -> std::optional<std::string>& {
+    return venue_id_;
+  }
+
+  [[nodiscard]]
+  auto instruments_found() const -> bool {
+    return instruments_found_;
+  }
+
+ private:
+  [[nodiscard]]
+  auto inside_instruments() const -> bool {
+    return depth_ == 2 && field_ == Field::Instruments;
+  }
+
+  auto on_value(rapidjson::Type type) -> bool {
+    if (depth_ == 0 && type != rapidjson::kObjectType) {
+      return fail(fmt::format(
+          "unexpected data Type `{}`, `object` is expected", type));
+    }
+
+    if (depth_ == 1) {
+      if (field_ == Field::VenueId && type != rapidjson::kStringType) {
+        return fail(fmt::format(
+            "failed to parse field `{}`: unexpected data Type `{}`, `string` "
+            "is expected",
+            VenueIdKey,
+            type));
+      }
+      if (field_ == Field::Instruments && type != rapidjson::kArrayType) {
+        return fail(
+            fmt::format("failed to parse field `{}`: expected JSON array, "
+                        "got `{}`",
+                        InstrumentsKey,
+                        type));
+      }
+    }
+
+    if (inside_instruments() && type != rapidjson::kObjectType) {
+      return fail(fmt::format(
+          "failed to parse field `{}`: failed to parse JSON array item #{}: "
+          "unexpected data Type `{}`, `object` is expected",
+          InstrumentsKey,
+          instruments_count_,
+          type));
+    }
+
+    return true;
+  }
+
+  auto fail(std::string error) -> bool {
+    error_ = std::move(error);
+    return false;
+  }
+
+  std::optional<std::string> venue_id_;
+  std::optional<std::string> error_;
+  std::size_t depth_{0};
+  std::size_t instruments_count_{0};
+  Field field_{Field::Unknown};
+  bool instruments_found_{false};
+  bool pending_instrument_{false};
+};
+
+// Forwards SAX events of a single JSON object to the destination handler.
+// The object's opening event is expected to be already consumed.
+template <typename Handler>
+class ObjectEventsForwarder {
+ public:
+  explicit ObjectEventsForwarder(Handler& handler) : handler_(handler) {}
+
+  [[nodiscard]]
+  auto completed() const -> bool {
+    return depth_ == 0;
+  }
+
+  auto Null() -> bool { return handler_.Null(); }
+
+  auto Bool(bool value) -> bool { return handler_.Bool(value); }
+
+  auto Int(int value) -> bool { return handler_.Int(value); }
+
+  auto Uint(unsigned value) -> bool { return handler_.Uint(value); }
+
+  auto Int64(std::int64_t value) -> bool { return handler_.Int64(value); }
+
+  auto Uint64(std::uint64_t value) -> bool { return handler_.Uint64(value); }
+
+  auto Double(double value) -> bool { return handler_.Double(value); }
+
+  auto RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+      -> bool {
+    return handler_.RawNumber(str, length, copy);
+  }
+
+  auto String(const char* str, rapidjson::SizeType length, bool copy)
+      -> bool {
+    return handler_.String(str, length, copy);
+  }
+
+  auto Key(const char* str, rapidjson::SizeType length, bool copy) -> bool {
+    return handler_.Key(str, length, copy);
+  }
+
+  auto StartObject() -> bool {
+    ++depth_;
+    return handler_.StartObject();
+  }
+
+  auto EndObject(rapidjson::SizeType members) -> bool {
+    --depth_;
+    return handler_.EndObject(members);
+  }
+
+  auto StartArray() -> bool {
+    ++depth_;
+    return handler_.StartArray();
+  }
+
+  auto EndArray(rapidjson::SizeType elements) -> bool {
+    --depth_;
+    return handler_.EndArray(elements);
+  }
+
+ private:
+  Handler& handler_;
+  std::size_t depth_{1};
+};
+
+// Reads the rest of an object, which opening event has been consumed by
+// the reader, into the document.
+template <typename InputStream>
+auto read_object(rapidjson::Reader& reader,
+                 InputStream& stream,
+                 rapidjson::Document& document) -> bool {
+  auto generator = [&reader, &stream](auto& handler) -> bool {
+    ObjectEventsForwarder forwarder{handler};
+    if (!handler.StartObject()) {
+      return false;
+    }
+    while (!forwarder.completed() && !reader.IterativeParseComplete()) {
+      reader.IterativeParseNext<StreamParseFlags>(stream, forwarder);
+    }
+    return forwarder.completed() && !reader.HasParseError();
+  };
+  document.Populate(generator);
+  return !reader.HasParseError();
+}
+
+template <typename Writer>
+auto write_key(Writer& writer, std::string_view key) -> bool {
+  return writer.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()));
+}
+
+template <typename Writer>
+auto write_snapshot(Writer& writer, const market_state::Snapshot& snapshot)
+    -> bool {
+  bool written =
+      writer.StartObject() && write_key(writer, VenueIdKey) &&
+      writer.String(snapshot.venue_id.data(),
+                    static_cast<rapidjson::SizeType>(snapshot.venue_id.size()),
+                    true) &&
+      write_key(writer, InstrumentsKey) && writer.StartArray();
+
+  for (const auto& instrument_state : snapshot.instruments) {
+    if (!written) {
+      break;
+    }
+    rapidjson::Document document;
+    core::json::Type<market_state::InstrumentState>::write_json_value(
+        document, document.GetAllocator(), instrument_state);
+    written = document.Accept(writer);
+  }
+
+  return written &&
+         writer.EndArray(
+             static_cast<rapidjson::SizeType>(snapshot.instruments.size())) &&
+         writer.EndObject(2);
+}
+
+}  // namespace
 
 auto JsonSerializer::serialize(const market_state::Snapshot& snapshot,
                                std::ostream& os) const -> bool {
@@ -29,17 +344,8 @@ auto JsonSerializer::deserialize(std::istream& is) const
   d.ParseStream(isw);
 
   if (d.HasParseError()) {
-    if (const std::size_t offset = d.GetErrorOffset(); offset > 0) {
-      return tl::unexpected{
-          fmt::format("Error parsing JSON on offset {}: {}",
-                      offset,
-                      rapidjson::GetParseError_En(d.GetParseError()))};
-    }
-
     return tl::unexpected{
-        fmt::format("Error parsing JSON: {}",
-                    rapidjson::GetParseError_En(d.GetParseError()),
-                    d.GetErrorOffset())};
+        format_parse_error(d.GetParseError(), d.GetErrorOffset())};
   }
 
   try {
@@ -50,4 +356,108 @@ auto JsonSerializer::deserialize(std::istream& is) const
   }
 }
 
+auto JsonSerializer::deserialize(std::istream& is,
+                                 const InstrumentStateConsumer& consumer) const
+    -> tl::expected<std::string, std::string> {
+  auto snapshot = deserialize(is);
+  if (!snapshot.has_value()) {
+    return tl::unexpected{std::move(snapshot.error())};
+  }
+
+  for (auto& instrument_state : snapshot->instruments) {
+    consumer(std::move(instrument_state));
+  }
+  return std::move(snapshot->venue_id);
+}
+
+StreamingJsonSerializer::StreamingJsonSerializer(Format format) noexcept
+    : format_{format} {}
+
+auto StreamingJsonSerializer::serialize(
+    const market_state::Snapshot& snapshot, std::ostream& os) const -> bool {
+  rapidjson::OStreamWrapper osw{os};
+  if (format_ == Format::Compact) {
+    rapidjson::Writer<rapidjson::OStreamWrapper> writer{osw};
+    return write_snapshot(writer, snapshot);
+  }
+  rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer{osw};
+  return write_snapshot(writer, snapshot);
+}
+
+auto StreamingJsonSerializer::deserialize(std::istream& is) const
+    -> tl::expected<market_state::Snapshot, std::string> {
+  market_state::Snapshot snapshot;
+  auto venue_id =
+      deserialize(is, [&snapshot](market_state::InstrumentState state) {
+        snapshot.instruments.push_back(std::move(state));
+      });
+  if (!venue_id.has_value()) {
+    return tl::unexpected{std::move(venue_id.error())};
+  }
+
+  snapshot.venue_id = std::move(venue_id.value());
+  return snapshot;
+}
+
+auto StreamingJsonSerializer::deserialize(
+    std::istream& is, const InstrumentStateConsumer& consumer) const
+    -> tl::expected<std::string, std::string> {
+  rapidjson::IStreamWrapper isw{is};
+  rapidjson::Reader reader;
+  SnapshotEnvelopeHandler envelope;
+
+  reader.IterativeParseInit();
+  while (!reader.IterativeParseComplete()) {
+    reader.IterativeParseNext<StreamParseFlags>(isw, envelope);
+
+    const auto item = envelope.take_pending_instrument();
+    if (!item.has_value()) {
+      continue;
+    }
+
+    rapidjson::Document document;
+    if (!read_object(reader, isw, document)) {
+      break;
+    }
+
+    // The consumer is called outside of the try block, so that its own
+    // exceptions are not reported as malformed JSON.
+    std::optional<market_state::InstrumentState> state;
+    try {
+      state = core::json::Type<market_state::InstrumentState>::read_json_value(
+          document);
+    } catch (const std::exception& e) {
+      return tl::unexpected{fmt::format(
+          "Error deserializing JSON: failed to parse field `{}`: failed to "
+          "parse JSON array item #{}: {}",
+          InstrumentsKey,
+          *item,
+          e.what())};
+    }
+    consumer(std::move(*state));
+  }
+
+  if (reader.HasParseError()) {
+    if (const auto& error = envelope.error()) {
+      return tl::unexpected{
+          fmt::format("Error deserializing JSON: {}", *error)};
+    }
+    return tl::unexpected{format_parse_error(reader.GetParseErrorCode(),
+                                             reader.GetErrorOffset())};
+  }
+
+  if (!envelope.venue_id().has_value()) {
+    return tl::unexpected{fmt::format(
+        "Error deserializing JSON: missing field `{}` in JSON object",
+        VenueIdKey)};
+  }
+  if (!envelope.instruments_found()) {
+    return tl::unexpected{fmt::format(
+        "Error deserializing JSON: missing field `{}` in JSON object",
+        InstrumentsKey)};
+  }
+
+  return std::move(*envelope.venue_id());
+}
+
 }  // namespace simulator::trading_system
@@ -0,0 +1,71 @@
+#include "ih/state_persistence/shadow_market_state.hpp"
+
+#include <utility>
+
+#include "log/logging.hpp"
+
+namespace simulator::trading_system {
+
+ShadowMarketState::ShadowMarketState(
+    std::string venue_id, const std::vector<Instrument>& instruments) {
+  snapshot_.venue_id = std::move(venue_id);
+  snapshot_.instruments.reserve(instruments.size());
+  for (const auto& instrument : instruments) {
+    indices_.emplace(instrument.identifier.value(),
+                     snapshot_.instruments.size());
+    market_state::InstrumentState instrument_state;
+    instrument_state.instrument = instrument;
+    snapshot_.instruments.push_back(std::move(instrument_state));
+  }
+}
+
+auto ShadowMarketState::append(market_state::JournalRecord record) -> void {
+  const std::lock_guard lock{pending_mutex_};
+  pending_.push_back(std::move(record));
+}
+
+auto ShadowMarketState::capture() -> const market_state::Snapshot& {
+  {
+    const std::lock_guard lock{pending_mutex_};
+    applying_.swap(pending_);
+  }
+
+  for (const auto& record : applying_) {
+    apply(record);
+  }
+  log::debug("{} order book mutation(s) applied to the shadow market state",
+             applying_.size());
+
+  // The buffer keeps its capacity, so the next swap hands engines
+  // a queue which does not grow from scratch.
+  applying_.clear();
+  return snapshot_;
+}
+
+auto ShadowMarketState::reseed(const Capture& capture) -> void {
+  {
+    const std::lock_guard lock{pending_mutex_};
+    pending_.clear();
+  }
+
+  for (auto& instrument_state : snapshot_.instruments) {
+    instrument_state = market_state::InstrumentState{
+        .instrument = std::move(instrument_state.instrument)};
+  }
+  capture(snapshot_.instruments);
+}
+
+auto ShadowMarketState::apply(const market_state::JournalRecord& record)
+    -> void {
+  const auto index_it = indices_.find(record.instrument_id.value());
+  if (index_it == indices_.end()) {
+    log::warn(
+        "ignoring order book mutation of an unknown instrument {} in the "
+        "shadow market state",
+        record.instrument_id);
+    return;
+  }
+  market_state::apply(record, snapshot_.instruments[index_it->second]);
+}
+
+}  // namespace simulator::trading_system
@@ -0,0 +1,55 @@
+#include "ih/state_persistence/snapshot_scheduler.hpp"
+
+#include <utility>
+
+#include "log/logging.hpp"
+
+namespace simulator::trading_system {
+
+SnapshotScheduler::SnapshotScheduler(std::chrono::seconds interval,
+                                     std::function<void()> snapshot)
+    : interval_{interval},
+      snapshot_{std::move(snapshot)},
+      last_snapshot_{Clock::now()},
+      worker_{[this](std::stop_token stop) { run(std::move(stop)); }} {}
+
+auto SnapshotScheduler::tick(Clock::time_point now) -> bool {
+  if (interval_ <= std::chrono::seconds::zero() ||
+      now - last_snapshot_ < interval_) {
+    return false;
+  }
+
+  last_snapshot_ = now;
+  request();
+  return true;
+}
+
+auto SnapshotScheduler::request() -> void {
+  {
+    const std::lock_guard lock{mutex_};
+    requested_ = true;
+  }
+  requested_cv_.notify_one();
+}
+
+auto SnapshotScheduler::run(std::stop_token stop) -> void {
+  log::debug("snapshot scheduler thread started");
+
+  while (true) {
+    {
+      std::unique_lock lock{mutex_};
+      requested_cv_.wait(lock, stop, [this] { return requested_; });
+      if (!requested_) {
+        break;
+      }
+      requested_ = false;
+    }
+
+    log::debug("storing scheduled market state snapshot");
+    snapshot_();
+  }
+
+  log::debug("snapshot scheduler thread stopped");
+}
+
+}  // namespace simulator::trading_system
@@ -15,8 +15,9 @@ namespace {
 class MatchingEngineFactory final : public TradingEngineFactory {
  public:
   explicit MatchingEngineFactory(const Config& config,
-                                 runtime::Service& executor)
-      : config_(&config), executor_(&executor) {}
+                                 runtime::Service& executor,
+                                 market_state::JournalSink journal)
+      : config_(&config), executor_(&executor), journal_(std::move(journal)) {}
 
  private:
   auto create_trading_engine(const Instrument& instrument) const
@@ -25,7 +26,10 @@ class MatchingEngineFactory final : public TradingEngineFactory {
                instrument.identifier);
 
     return std::make_unique<matching_engine::MatchingEngine>(
-        instrument, make_matching_engine_configuration(instrument), *executor_);
+        instrument,
+        make_matching_engine_configuration(instrument),
+        *executor_,
+        journal_);
   }
 
   auto make_matching_engine_configuration(const Instrument& instrument) const
@@ -48,15 +52,18 @@ class MatchingEngineFactory final : public TradingEngineFactory {
 
   gsl::not_null<const Config*> config_;
   gsl::not_null<runtime::Service*> executor_;
+  market_state::JournalSink journal_;
 };
 
 }  // namespace
 
 auto create_matching_engine_factory(const Config& config,
-                                    runtime::Service& executor)
+                                    runtime::Service& executor,
+                                    market_state::JournalSink journal)
     -> std::unique_ptr<TradingEngineFactory> {
   log::debug("creating matching engine factory");
-  return std::make_unique<MatchingEngineFactory>(config, executor);
+  return std::make_unique<MatchingEngineFactory>(
+      config, executor, std::move(journal));
 }
 
 }  // namespace simulator::trading_system
\ No newline at end of file
@@ -159,6 +159,12 @@ auto process(protocol::SecurityStatusRequest request, System& trading_system)
   trading_system.implementation().execute(std::move(request));
 }
 
+auto process(protocol::OrderRequestBatch batch, System& trading_system)
+    -> void {
+  log::debug("called the procedure to process OrderRequestBatch");
+  trading_system.implementation().execute(std::move(batch));
+}
+
 auto process(const protocol::InstrumentStateRequest& request,
              protocol::InstrumentState& reply,
              System& trading_system) -> void {
@@ -166,6 +172,32 @@ auto process(const protocol::InstrumentStateRequest& request,
   trading_system.implementation().execute(request, reply);
 }
 
+auto process(const protocol::InstrumentHandleRequest& request,
+             protocol::InstrumentHandleReply& reply,
+             System& trading_system) -> void {
+  log::debug("called the procedure to process InstrumentHandleRequest");
+  trading_system.implementation().execute(request, reply);
+}
+
+auto process(protocol::ResolvedOrderRequests requests, System& trading_system)
+    -> void {
+  log::debug("called the procedure to process ResolvedOrderRequests");
+  trading_system.implementation().execute(std::move(requests));
+}
+
+auto process(protocol::ResolvedOrderRequest request, System& trading_system)
+    -> void {
+  log::debug("called the procedure to process ResolvedOrderRequest");
+  trading_system.implementation().execute(std::move(request));
+}
+
+auto process(const protocol::EngineLoadRequest& request,
+             protocol::EngineLoadReply& reply,
+             System& trading_system) -> void {
+  log::trace("called the procedure to process EngineLoadRequest");
+  trading_system.implementation().execute(request, reply);
+}
+
 auto process(const protocol::HaltPhaseRequest& request,
              protocol::HaltPhaseReply& reply,
              System& trading_system) -> void {
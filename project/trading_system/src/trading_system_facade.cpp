@@ -1,5 +1,9 @@
 #include "ih/trading_system_facade.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
 #include "cfg/api/cfg.hpp"
 #include "ih/state_persistence/serializer.hpp"
 #include "ih/tools/instrument_resolver.hpp"
@@ -10,6 +14,47 @@
 namespace database = Simulator::DataLayer::Database;
 
 namespace simulator::trading_system {
+namespace {
+
+auto create_market_state_serializer() -> std::unique_ptr<Serializer> {
+  const auto format = Simulator::Cfg::persistence().compact_snapshot
+                          ? StreamingJsonSerializer::Format::Compact
+                          : StreamingJsonSerializer::Format::Pretty;
+  return std::make_unique<StreamingJsonSerializer>(format);
+}
+
+auto create_market_state_journal(const Config& config,
+                                 const std::vector<Instrument>& instruments)
+    -> std::unique_ptr<MarketStateJournal> {
+  if (!Simulator::Cfg::persistence().journal ||
+      !config.persistence_enabled() || config.persistence_file_path().empty()) {
+    return nullptr;
+  }
+
+  std::filesystem::path journal_path{config.persistence_file_path()};
+  journal_path += ".journal";
+  log::info("market state journal is written to {}.<segment>",
+            journal_path.string());
+  return std::make_unique<MarketStateJournal>(std::move(journal_path),
+                                              instruments);
+}
+
+// The shadow state is kept only when snapshots are stored in background,
+// as it makes engines report every order book mutation.
+auto create_shadow_market_state(const Config& config,
+                                const std::vector<Instrument>& instruments)
+    -> std::unique_ptr<ShadowMarketState> {
+  const auto& persistence = Simulator::Cfg::persistence();
+  if (!config.persistence_enabled() || config.persistence_file_path().empty() ||
+      (persistence.snapshot_interval <= 0 && !persistence.journal)) {
+    return nullptr;
+  }
+
+  return std::make_unique<ShadowMarketState>(Simulator::Cfg::venue().name,
+                                             instruments);
+}
+
+}  // namespace
 
 TradingSystemFacade::TradingSystemFacade(Config config,
                                          instrument::Cache instruments)
@@ -17,20 +62,36 @@ TradingSystemFacade::TradingSystemFacade(Config config,
       event_loop_(runtime::Loop::create_one_second_rate_loop()),
       instruments_(std::move(instruments)),
       config_(std::move(config)),
+      journal_(create_market_state_journal(
+          config_, instruments_.retrieve_instruments())),
+      shadow_state_(create_shadow_market_state(
+          config_, instruments_.retrieve_instruments())),
       instrument_resolver_(create_cached_instrument_resolver(instruments_)),
       repository_accessor_(RepositoryAccessor::create(engines_repository_)),
       execution_system_(*instrument_resolver_, *repository_accessor_),
       event_controller_(ies::Controller(event_loop_)),
       persistence_controller_{config_,
                               execution_system_,
-                              std::make_unique<JsonSerializer>(),
+                              create_market_state_serializer(),
                               Simulator::Cfg::venue().name,
-                              instruments_.retrieve_instruments()} {
+                              instruments_.retrieve_instruments(),
+                              journal_.get(),
+                              shadow_state_.get()} {
   log::debug("creating trading system facade");
 
   init_trading_engines();
+  schedule_snapshots();
   launch_ies();
-  persistence_controller_.recover();
+
+  using core::code::RecoverMarketState;
+  const auto recovery = persistence_controller_.recover();
+  if (journal_ != nullptr &&
+      (recovery.code == RecoverMarketState::Recovered ||
+       recovery.code == RecoverMarketState::PersistenceFilePathIsUnreachable)) {
+    // The journal is only meaningful on top of a snapshot, so the recovered
+    // (or initial) state is stored as the first checkpoint.
+    persistence_controller_.store();
+  }
 
   log::info("trading system facade created");
 }
@@ -64,6 +125,12 @@ auto TradingSystemFacade::execute(
   execution_system_.execute_request(request);
 }
 
+auto TradingSystemFacade::execute(protocol::OrderRequestBatch batch) -> void {
+  log::debug("trading system received a batch of {} order requests",
+             batch.size());
+  execution_system_.execute_request(std::move(batch));
+}
+
 auto TradingSystemFacade::execute(
     const protocol::InstrumentStateRequest& request,
     [[maybe_unused]] protocol::InstrumentState& reply) -> void {
@@ -71,6 +138,37 @@ auto TradingSystemFacade::execute(
   execution_system_.execute_request(request, reply);
 }
 
+auto TradingSystemFacade::execute(
+    const protocol::InstrumentHandleRequest& request,
+    protocol::InstrumentHandleReply& reply) -> void {
+  log::debug("trading system received an instrument handle request for {}",
+             request.instrument);
+  execution_system_.execute_request(request, reply);
+}
+
+auto TradingSystemFacade::execute(protocol::ResolvedOrderRequests requests)
+    -> void {
+  log::debug(
+      "trading system received {} order requests to the resolved "
+      "instrument {}",
+      requests.requests.size(),
+      requests.instrument.value);
+  execution_system_.execute_request(std::move(requests));
+}
+
+auto TradingSystemFacade::execute(protocol::ResolvedOrderRequest request)
+    -> void {
+  log::debug(
+      "trading system received an order request to the resolved instrument {}",
+      request.instrument.value);
+  execution_system_.execute_request(std::move(request));
+}
+
+auto TradingSystemFacade::execute(const protocol::EngineLoadRequest& request,
+                                  protocol::EngineLoadReply& reply) -> void {
+  execution_system_.execute_request(request, reply);
+}
+
 auto TradingSystemFacade::execute(const protocol::HaltPhaseRequest& request,
                                   protocol::HaltPhaseReply& reply) -> void {
   event_controller_.process(request, reply);
@@ -104,8 +202,10 @@ auto TradingSystemFacade::react_on(
 }
 
 auto TradingSystemFacade::terminate() -> void {
-  persistence_controller_.store();
   event_loop_.terminate();
+  // Stops the scheduled snapshots before the final one is stored.
+  snapshot_scheduler_.reset();
+  persistence_controller_.store();
   thread_pool_.await();
 }
 
@@ -113,9 +213,28 @@ auto TradingSystemFacade::init_trading_engines() -> void {
   // Load all cached instruments
   std::vector<Instrument> instruments = instruments_.retrieve_instruments();
 
+  // A mutation is handed to the shadow state before the journal: once
+  // the journal has started a new segment for a snapshot, any mutation
+  // written to the previous segment is already queued for the snapshot.
+  market_state::JournalSink journal_sink;
+  if (journal_ != nullptr || shadow_state_ != nullptr) {
+    journal_sink = [journal = journal_.get(), shadow = shadow_state_.get()](
+                       market_state::JournalRecord record) {
+      if (journal == nullptr) {
+        shadow->append(std::move(record));
+        return;
+      }
+      if (shadow != nullptr) {
+        shadow->append(record);
+      }
+      journal->append(std::move(record));
+    };
+  }
+
   // Create a matching engine factory
   std::unique_ptr<TradingEngineFactory> engine_factory =
-      create_matching_engine_factory(config_, thread_pool_);
+      create_matching_engine_factory(
+          config_, thread_pool_, std::move(journal_sink));
 
   for (auto& instrument : instruments) {
     // Add a trading engine for each instrument to the repository
@@ -140,6 +259,33 @@ auto TradingSystemFacade::launch_ies() -> void {
   log::debug("started internal event system");
 }
 
+auto TradingSystemFacade::schedule_snapshots() -> void {
+  const auto& persistence = Simulator::Cfg::persistence();
+  const std::chrono::seconds interval{
+      std::max(persistence.snapshot_interval, 0)};
+  if (interval == std::chrono::seconds::zero() && journal_ == nullptr) {
+    return;
+  }
+
+  snapshot_scheduler_ = std::make_unique<SnapshotScheduler>(
+      interval, [this] { persistence_controller_.store(); });
+  if (interval > std::chrono::seconds::zero()) {
+    log::info("market state snapshots are scheduled every {} second(s)",
+              interval.count());
+  }
+
+  const auto checkpoint_records = static_cast<std::size_t>(
+      std::max(persistence.journal_checkpoint_records, 1));
+  event_loop_.add([this, checkpoint_records] {
+    if (journal_ != nullptr &&
+        journal_->records_in_segment() >= checkpoint_records) {
+      log::debug("requesting market state snapshot to checkpoint the journal");
+      snapshot_scheduler_->request();
+    }
+    snapshot_scheduler_->tick(SnapshotScheduler::Clock::now());
+  });
+}
+
 auto TradingSystemFacade::process(const event::Tick& event) -> void {
   engines_repository_.for_each_engine(
       [&event](TradingEngine& engine) { engine.handle(event); });
@@ -28,16 +28,37 @@ struct ExecutorMock : public Executor {
               execute_request,
               (protocol::SecurityStatusRequest),
               (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (protocol::OrderRequestBatch),
+              (const, override));
   MOCK_METHOD(void,
               execute_request,
               (const protocol::InstrumentStateRequest&,
                protocol::InstrumentState&),
               (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (const protocol::InstrumentHandleRequest&,
+               protocol::InstrumentHandleReply&),
+              (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (protocol::ResolvedOrderRequests),
+              (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (protocol::ResolvedOrderRequest),
+              (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (const protocol::EngineLoadRequest&, protocol::EngineLoadReply&),
+              (const, override));
   MOCK_METHOD(void,
               store_state_request,
               (std::vector<market_state::InstrumentState>&),
               (const, override));
-  MOCK_METHOD(void,
+  MOCK_METHOD(StateRecoveryResult,
               recover_state_request,
               (std::vector<market_state::InstrumentState>),
               (const, override));
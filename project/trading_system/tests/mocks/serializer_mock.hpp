@@ -19,6 +19,12 @@ struct SerializerMock : public simulator::trading_system::Serializer {
               deserialize,
               (std::istream & is),
               (const, override));
+  MOCK_METHOD((tl::expected<std::string, std::string>),
+              deserialize,
+              (std::istream & is,
+               const simulator::trading_system::Serializer::
+                   InstrumentStateConsumer& consumer),
+              (const, override));
 };
 
 }  // namespace simulator::trading_system::test
@@ -17,9 +17,11 @@ struct TradingEngineMock : TradingEngine {
   MOCK_METHOD(void, execute, (protocol::OrderCancellationRequest request), (override));
   MOCK_METHOD(void, execute, (protocol::MarketDataRequest), (override));
   MOCK_METHOD(void, execute, (protocol::SecurityStatusRequest), (override));
+  MOCK_METHOD(void, execute, (std::vector<protocol::OrderRequest>), (override));
   MOCK_METHOD(void, provide_state, (protocol::InstrumentState & reply), (override));
+  MOCK_METHOD(protocol::EngineLoad, load, (), (const, override));
   MOCK_METHOD(void, store_state, (market_state::InstrumentState& state), (override));
-  MOCK_METHOD(void, recover_state, (market_state::InstrumentState event), (override));
+  MOCK_METHOD(void, recover_state, (market_state::InstrumentState state, std::function<void()> on_recovered), (override));
   MOCK_METHOD(void, handle, (event::Tick event), (override));
   MOCK_METHOD(void, handle, (event::PhaseTransition event), (override));
   MOCK_METHOD(void, handle, (const protocol::SessionTerminatedEvent& event), (override));
@@ -21,6 +21,8 @@ struct TradingReplyReceiverMock : public middleware::TradingReplyReceiver {
   MOCK_METHOD(void, process, (protocol::OrderCancellationReject), (override));
   MOCK_METHOD(void, process, (protocol::OrderCancellationConfirmation), (override));
 
+  MOCK_METHOD(void, process, (protocol::OrderReplyBatch), (override));
+
   MOCK_METHOD(void, process, (protocol::MarketDataReject), (override));
   MOCK_METHOD(void, process, (protocol::MarketDataSnapshot), (override));
   MOCK_METHOD(void, process, (protocol::MarketDataUpdate), (override));
@@ -1,5 +1,8 @@
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <thread>
+#include <variant>
 #include <tl/expected.hpp>
 
 #include "common/market_state/snapshot.hpp"
@@ -9,6 +12,7 @@
 #include "middleware/channels/trading_reply_channel.hpp"
 #include "mocks/instrument_resolver_mock.hpp"
 #include "mocks/repository_accessor_mock.hpp"
+#include "mocks/trading_engine_mock.hpp"
 #include "mocks/trading_reply_receiver_mock.hpp"
 #include "protocol/types/session.hpp"
 
@@ -158,6 +162,146 @@ TEST_F(TradingSystemExecutionSystem,
   execution_system.execute_request(request);
 }
 
+TEST_F(TradingSystemExecutionSystem,
+       DispatchesOrderRequestBatchAsSingleOperationPerInstrument) {
+  protocol::OrderRequestBatch batch{
+      make_external_request<protocol::OrderPlacementRequest>(),
+      make_external_request<protocol::OrderModificationRequest>(),
+      make_external_request<protocol::OrderCancellationRequest>()};
+  TradingEngineMock engine;
+
+  EXPECT_CALL(repository_accessor, unicast_impl(Eq(instrument.identifier), _))
+      .WillOnce([&](auto, auto operation) { operation(engine); });
+  EXPECT_CALL(engine, execute(A<std::vector<protocol::OrderRequest>>()))
+      .WillOnce([](const std::vector<protocol::OrderRequest>& requests) {
+        ASSERT_THAT(requests, SizeIs(3));
+        EXPECT_TRUE(
+            std::holds_alternative<protocol::OrderPlacementRequest>(requests[0]));
+        EXPECT_TRUE(std::holds_alternative<protocol::OrderModificationRequest>(
+            requests[1]));
+        EXPECT_TRUE(std::holds_alternative<protocol::OrderCancellationRequest>(
+            requests[2]));
+      });
+
+  execution_system.execute_request(std::move(batch));
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       RejectsBatchedOrderRequestWithUnresolvedInstrument) {
+  protocol::OrderRequestBatch batch{
+      make_external_request<protocol::OrderPlacementRequest>()};
+
+  ON_CALL(instrument_resolver,
+          resolve_instrument(A<const InstrumentDescriptor&>()))
+      .WillByDefault(Return(
+          tl::make_unexpected(instrument::LookupError::InstrumentNotFound)));
+
+  EXPECT_CALL(repository_accessor, unicast_impl(_, _)).Times(0);
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::OrderPlacementReject>()));
+
+  execution_system.execute_request(std::move(batch));
+}
+
+TEST_F(TradingSystemExecutionSystem, RepliesWithHandleOfResolvedInstrument) {
+  const protocol::InstrumentHandleRequest request{.instrument = {}};
+  protocol::InstrumentHandleReply reply;
+
+  execution_system.execute_request(request, reply);
+
+  ASSERT_TRUE(reply.handle.has_value());
+  EXPECT_EQ(reply.handle->value, instrument.identifier.value());
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       RepliesWithoutHandleOfUnresolvedInstrument) {
+  const protocol::InstrumentHandleRequest request{.instrument = {}};
+  protocol::InstrumentHandleReply reply;
+
+  ON_CALL(instrument_resolver,
+          resolve_instrument(A<const InstrumentDescriptor&>()))
+      .WillByDefault(Return(
+          tl::make_unexpected(instrument::LookupError::InstrumentNotFound)));
+
+  execution_system.execute_request(request, reply);
+
+  EXPECT_FALSE(reply.handle.has_value());
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       DispatchesResolvedOrderRequestsWithoutResolvingInstrument) {
+  protocol::ResolvedOrderRequests requests{
+      .instrument = protocol::InstrumentHandle{instrument.identifier.value()},
+      .requests = {make_external_request<protocol::OrderPlacementRequest>(),
+                   make_external_request<protocol::OrderCancellationRequest>()}};
+  TradingEngineMock engine;
+
+  EXPECT_CALL(instrument_resolver,
+              resolve_instrument(A<const InstrumentDescriptor&>()))
+      .Times(0);
+  EXPECT_CALL(repository_accessor, unicast_impl(Eq(instrument.identifier), _))
+      .WillOnce([&](auto, auto operation) { operation(engine); });
+  EXPECT_CALL(engine, execute(A<std::vector<protocol::OrderRequest>>()))
+      .WillOnce([](const std::vector<protocol::OrderRequest>& requests) {
+        EXPECT_THAT(requests, SizeIs(2));
+      });
+
+  execution_system.execute_request(std::move(requests));
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       DispatchesResolvedOrderRequestWithoutBatchingIt) {
+  protocol::ResolvedOrderRequest request{
+      .instrument = protocol::InstrumentHandle{instrument.identifier.value()},
+      .request = make_external_request<protocol::OrderModificationRequest>()};
+  TradingEngineMock engine;
+
+  EXPECT_CALL(instrument_resolver,
+              resolve_instrument(A<const InstrumentDescriptor&>()))
+      .Times(0);
+  EXPECT_CALL(repository_accessor, unicast_impl(Eq(instrument.identifier), _))
+      .WillOnce([&](auto, auto operation) { operation(engine); });
+  EXPECT_CALL(engine, execute(A<protocol::OrderModificationRequest>()))
+      .Times(1);
+  EXPECT_CALL(engine, execute(A<std::vector<protocol::OrderRequest>>()))
+      .Times(0);
+
+  execution_system.execute_request(std::move(request));
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       RepliesWithLoadOfResolvedInstrumentEngine) {
+  const protocol::EngineLoadRequest request{
+      protocol::InstrumentHandle{instrument.identifier.value()}};
+  protocol::EngineLoadReply reply;
+  TradingEngineMock engine;
+
+  EXPECT_CALL(repository_accessor, unicast_impl(Eq(instrument.identifier), _))
+      .WillOnce([&](auto, auto operation) { operation(engine); });
+  EXPECT_CALL(engine, load)
+      .WillOnce(Return(protocol::EngineLoad{
+          .queue_depth = 3,
+          .oldest_request_age = std::chrono::microseconds{7}}));
+
+  execution_system.execute_request(request, reply);
+
+  ASSERT_TRUE(reply.load.has_value());
+  EXPECT_EQ(reply.load->queue_depth, 3);
+  EXPECT_EQ(reply.load->oldest_request_age, std::chrono::microseconds{7});
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       RepliesWithoutLoadOfUnknownInstrumentEngine) {
+  const protocol::EngineLoadRequest request{protocol::InstrumentHandle{7}};
+  protocol::EngineLoadReply reply;
+
+  EXPECT_CALL(repository_accessor, unicast_impl(Eq(InstrumentId{7}), _));
+
+  execution_system.execute_request(request, reply);
+
+  EXPECT_FALSE(reply.load.has_value());
+}
+
 TEST_F(TradingSystemExecutionSystem, StoresStateForTwoInstruments) {
   std::vector<market_state::InstrumentState> instruments(
       2, market_state::InstrumentState{});
@@ -214,6 +358,44 @@ TEST_F(TradingSystemExecutionSystem,
   execution_system.recover_state_request(instruments_state);
 }
 
+TEST_F(TradingSystemExecutionSystem,
+       RecoverStateWaitsForAllEnginesAndReportsAggregateResult) {
+  market_state::InstrumentState state1;
+  state1.instrument.symbol = Symbol{"AAPL"};
+  market_state::InstrumentState state2;
+  state2.instrument.symbol = Symbol{"TSLA"};
+  market_state::InstrumentState state3;
+  state3.instrument.symbol = Symbol{"MSFT"};
+
+  ON_CALL(instrument_resolver, resolve_instrument(A<const Instrument&>()))
+      .WillByDefault(Return(instrument::View{instrument}));
+  ON_CALL(instrument_resolver, resolve_instrument(state3.instrument))
+      .WillByDefault(Return(
+          tl::make_unexpected(instrument::LookupError::InstrumentNotFound)));
+
+  NiceMock<TradingEngineMock> engine;
+  std::vector<std::thread> engine_threads;
+  ON_CALL(engine, recover_state(_, _))
+      .WillByDefault([&](const auto& /*state*/, auto on_recovered) {
+        engine_threads.emplace_back(std::move(on_recovered));
+      });
+  ON_CALL(repository_accessor, unicast_impl(_, _))
+      .WillByDefault([&](auto /*instrument_id*/, auto action) {
+        action(engine);
+      });
+
+  EXPECT_CALL(engine, recover_state(_, _)).Times(2);
+
+  const auto result =
+      execution_system.recover_state_request({state1, state2, state3});
+
+  for (auto& thread : engine_threads) {
+    thread.join();
+  }
+  ASSERT_EQ(result.recovered_instruments, 2U);
+  ASSERT_EQ(result.ignored_instruments, 1U);
+}
+
 TEST_F(TradingSystemExecutionSystem, BroadcastSessionTerminatedEvent) {
   EXPECT_CALL(repository_accessor, broadcast_impl(_));
   execution_system.handle(protocol::SessionTerminatedEvent{make_session()});
@@ -0,0 +1,197 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "ih/state_persistence/journal.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+struct TradingSystemStatePersistenceJournal : public Test {
+  auto SetUp() -> void override {
+    std::filesystem::create_directories(directory);
+
+    instrument.symbol = Symbol{"AAPL"};
+    instrument.identifier = InstrumentId{42};
+  }
+
+  auto TearDown() -> void override { std::filesystem::remove_all(directory); }
+
+  static auto make_order(OrderId order_id) -> market_state::LimitOrder {
+    market_state::LimitOrder order;
+    order.order_id = order_id;
+    order.side = Side::Option::Buy;
+    order.order_price = OrderPrice{10.};
+    order.total_quantity = OrderQuantity{100.};
+    return order;
+  }
+
+  auto record(market_state::JournalRecord::Mutation mutation) const
+      -> market_state::JournalRecord {
+    return {.instrument_id = instrument.identifier,
+            .mutation = std::move(mutation)};
+  }
+
+  // The instrument identifier is not persisted, states are matched by the
+  // instrument attributes.
+  auto recovered_instrument() const -> Instrument {
+    auto recovered = instrument;
+    recovered.identifier = InstrumentId{0};
+    return recovered;
+  }
+
+  static auto apply(const MarketStateJournal::InstrumentRecords& records)
+      -> market_state::InstrumentState {
+    market_state::InstrumentState state;
+    state.instrument = records.instrument;
+    for (const auto& record : records.records) {
+      market_state::apply(record, state);
+    }
+    return state;
+  }
+
+  static auto read(const std::filesystem::path& path) -> std::string {
+    std::ifstream ifs{path};
+    std::stringstream content;
+    content << ifs.rdbuf();
+    return content.str();
+  }
+
+  const std::filesystem::path directory{
+      std::filesystem::temp_directory_path() /
+      UnitTest::GetInstance()->current_test_info()->name()};
+  const std::filesystem::path base_path{directory / "market_state.journal"};
+  Instrument instrument;
+};
+
+TEST_F(TradingSystemStatePersistenceJournal, StartsSegmentAfterExistingOnes) {
+  std::ofstream{directory / "market_state.journal.7"};
+  std::ofstream{directory / "market_state.journal.backup"};
+
+  MarketStateJournal journal{base_path, {instrument}};
+  journal.flush();
+
+  ASSERT_THAT(journal.segments(),
+              ElementsAre(directory / "market_state.journal.7",
+                          directory / "market_state.journal.8"));
+}
+
+TEST_F(TradingSystemStatePersistenceJournal, ReadsWrittenRecords) {
+  MarketStateJournal journal{base_path, {instrument}};
+  journal.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  journal.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{2})}));
+  journal.append(record(market_state::JournalRecord::OrderReduced{
+      .order_id = OrderId{1},
+      .side = Side::Option::Buy,
+      .leaves_quantity = LeavesQuantity{40.}}));
+  journal.append(record(market_state::JournalRecord::OrderRemoved{
+      .order_id = OrderId{2}, .side = Side::Option::Buy}));
+  journal.flush();
+
+  ASSERT_EQ(journal.records_in_segment(), 4U);
+  ASSERT_THAT(journal.segments(), SizeIs(1));
+
+  std::vector<MarketStateJournal::InstrumentRecords> records;
+  std::ifstream segment{journal.segments().front()};
+  const auto records_read = MarketStateJournal::read(segment, records);
+
+  ASSERT_TRUE(records_read.has_value()) << records_read.error();
+  ASSERT_EQ(*records_read, 4U);
+  ASSERT_THAT(records, SizeIs(1));
+  ASSERT_EQ(records.front().instrument, recovered_instrument());
+  ASSERT_THAT(records.front().records, SizeIs(4));
+
+  auto expected_order = make_order(OrderId{1});
+  expected_order.cum_executed_quantity = CumExecutedQuantity{60.};
+  expected_order.order_status = OrderStatus::Option::PartiallyFilled;
+  ASSERT_THAT(apply(records.front()).order_book.buy_orders,
+              ElementsAre(expected_order));
+}
+
+TEST_F(TradingSystemStatePersistenceJournal,
+       AppendsRecordsOfSegmentsToSameInstrument) {
+  MarketStateJournal journal{base_path, {instrument}};
+  journal.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  static_cast<void>(journal.start_segment({instrument}));
+  journal.append(record(market_state::JournalRecord::OrderRemoved{
+      .order_id = OrderId{1}, .side = Side::Option::Buy}));
+  journal.flush();
+
+  std::vector<MarketStateJournal::InstrumentRecords> records;
+  for (const auto& segment_path : journal.segments()) {
+    std::ifstream segment{segment_path};
+    ASSERT_TRUE(MarketStateJournal::read(segment, records).has_value());
+  }
+
+  ASSERT_THAT(records, SizeIs(1));
+  ASSERT_THAT(
+      records.front().records,
+      ElementsAre(record(market_state::JournalRecord::OrderAdded{
+                      make_order(OrderId{1})}),
+                  record(market_state::JournalRecord::OrderRemoved{
+                      .order_id = OrderId{1}, .side = Side::Option::Buy})));
+}
+
+TEST_F(TradingSystemStatePersistenceJournal, WritesRecordsToLatestSegment) {
+  MarketStateJournal journal{base_path, {instrument}};
+  journal.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  const auto segment = journal.start_segment({instrument});
+  journal.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{2})}));
+  journal.flush();
+
+  ASSERT_EQ(journal.records_in_segment(), 1U);
+  ASSERT_THAT(journal.segments(), SizeIs(2));
+
+  journal.discard_segments_before(segment);
+
+  const auto segments = journal.segments();
+  ASSERT_THAT(segments, SizeIs(1));
+  std::vector<MarketStateJournal::InstrumentRecords> records;
+  std::ifstream segment_stream{segments.front()};
+  ASSERT_TRUE(MarketStateJournal::read(segment_stream, records).has_value());
+  ASSERT_THAT(records, SizeIs(1));
+  ASSERT_THAT(apply(records.front()).order_book.buy_orders,
+              ElementsAre(make_order(OrderId{2})));
+}
+
+TEST_F(TradingSystemStatePersistenceJournal, IgnoresTornLastRecord) {
+  MarketStateJournal journal{base_path, {instrument}};
+  journal.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  journal.flush();
+
+  std::stringstream segment{read(journal.segments().front()) +
+                            R"({"instrument_id": 42, "order_rem)"};
+  std::vector<MarketStateJournal::InstrumentRecords> records;
+  const auto records_read = MarketStateJournal::read(segment, records);
+
+  ASSERT_TRUE(records_read.has_value());
+  ASSERT_EQ(*records_read, 1U);
+}
+
+TEST_F(TradingSystemStatePersistenceJournal, ReturnsErrorOnMalformedRecord) {
+  MarketStateJournal journal{base_path, {instrument}};
+  journal.flush();
+
+  std::stringstream segment{read(journal.segments().front()) +
+                            "{\"instrument_id\": 42}\n"};
+  std::vector<MarketStateJournal::InstrumentRecords> records;
+  const auto records_read = MarketStateJournal::read(segment, records);
+
+  ASSERT_FALSE(records_read.has_value());
+  ASSERT_EQ(records_read.error(),
+            "line 2: Error deserializing JSON: unknown journal record type");
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test
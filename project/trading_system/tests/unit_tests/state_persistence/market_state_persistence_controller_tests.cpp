@@ -121,6 +121,41 @@ TEST_F(TradingSystemMarketStatePersistenceController,
   ASSERT_EQ(controller.store(), core::code::StoreMarketState::Stored);
 }
 
+TEST_F(TradingSystemMarketStatePersistenceController,
+       StoreSerializesShadowStateWithoutCapturingEngineStates) {
+  config.set_persistence(true);
+  config.set_persistence_file_path("file_name");
+
+  Instrument instrument;
+  instrument.identifier = InstrumentId{42};
+  ShadowMarketState shadow{"Venue", {instrument}};
+  market_state::LimitOrder order;
+  order.order_id = OrderId{1};
+  order.side = Side::Option::Sell;
+  shadow.append({.instrument_id = instrument.identifier,
+                 .mutation = market_state::JournalRecord::OrderAdded{order}});
+
+  EXPECT_CALL(executor, store_state_request).Times(0);
+  EXPECT_CALL(*serializer,
+              serialize(Field(&market_state::Snapshot::instruments,
+                              ElementsAre(Field(
+                                  &market_state::InstrumentState::order_book,
+                                  Field(&market_state::OrderBook::sell_orders,
+                                        ElementsAre(order))))),
+                        _))
+      .WillOnce(Return(true));
+
+  MarketStatePersistenceController controller{config,
+                                              executor,
+                                              std::move(serializer),
+                                              "Venue",
+                                              {instrument},
+                                              nullptr,
+                                              &shadow};
+
+  ASSERT_EQ(controller.store(), core::code::StoreMarketState::Stored);
+}
+
 TEST_F(TradingSystemMarketStatePersistenceController,
        RecoverReturnsPersistenceDisabledIfPersistenceIsDisabled) {
   config.set_persistence(false);
@@ -188,7 +223,7 @@ struct TradingSystemMarketStatePersistenceControllerRealFile
 
 TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
        RecoverReturnsPersistenceFileIsMalformed) {
-  EXPECT_CALL(*serializer, deserialize(_))
+  EXPECT_CALL(*serializer, deserialize(_, _))
       .WillOnce(Return(tl::unexpected<std::string>{""}));
 
   MarketStatePersistenceController controller{
@@ -200,7 +235,7 @@ TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
 
 TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
        RecoverSetsErrorMessageOnPersistenceFileIsMalformed) {
-  EXPECT_CALL(*serializer, deserialize(_))
+  EXPECT_CALL(*serializer, deserialize(_, _))
       .WillOnce(Return(tl::unexpected<std::string>{"Malformed file"}));
 
   MarketStatePersistenceController controller{
@@ -218,19 +253,94 @@ TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
   market_state::Snapshot snapshot;
   snapshot.instruments = {state1, state2};
 
-  ON_CALL(*serializer, deserialize(_)).WillByDefault(Return(snapshot));
+  ON_CALL(*serializer, deserialize(_, _))
+      .WillByDefault([&](std::istream&,
+                         const Serializer::InstrumentStateConsumer& consumer) {
+        for (const auto& state : snapshot.instruments) {
+          consumer(state);
+        }
+        return tl::expected<std::string, std::string>{"Venue"};
+      });
+
+  // Instruments are recovered one by one as they are parsed.
+  const InSequence sequence;
+  EXPECT_CALL(executor, recover_state_request(ElementsAre(state1)));
+  EXPECT_CALL(executor, recover_state_request(ElementsAre(state2)));
+
+  MarketStatePersistenceController controller{
+      config, executor, std::move(serializer), {}, {}};
+  controller.recover();
+}
+
+TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
+       RecoverKeepsInstrumentsParsedBeforeMalformedPart) {
+  market_state::InstrumentState state;
+  state.instrument.symbol = Symbol{"Symbol1"};
+
+  ON_CALL(*serializer, deserialize(_, _))
+      .WillByDefault([&](std::istream&,
+                         const Serializer::InstrumentStateConsumer& consumer) {
+        consumer(state);
+        return tl::expected<std::string, std::string>{
+            tl::unexpect, "Malformed file"};
+      });
 
-  EXPECT_CALL(executor, recover_state_request(ElementsAre(state1, state2)));
+  EXPECT_CALL(executor, recover_state_request(ElementsAre(state)));
 
   MarketStatePersistenceController controller{
       config, executor, std::move(serializer), {}, {}};
+  const auto result = controller.recover();
+
+  ASSERT_EQ(result.code,
+            core::code::RecoverMarketState::PersistenceFileIsMalformed);
+}
+
+TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
+       RecoverAppliesJournalRecordsToParsedInstruments) {
+  auto journal_path = output_file_path;
+  journal_path += ".journal";
+  Instrument instrument;
+  instrument.symbol = Symbol{"Symbol1"};
+  instrument.identifier = InstrumentId{42};
+  market_state::LimitOrder order;
+  order.order_id = OrderId{1};
+  order.side = Side::Option::Buy;
+  order.order_price = OrderPrice{10.};
+  order.total_quantity = OrderQuantity{100.};
+
+  MarketStateJournal journal{journal_path, {instrument}};
+  journal.append({.instrument_id = instrument.identifier,
+                  .mutation = market_state::JournalRecord::OrderAdded{order}});
+
+  // The instrument identifier is not persisted, states are matched by the
+  // instrument attributes.
+  market_state::InstrumentState state;
+  state.instrument = instrument;
+  state.instrument.identifier = InstrumentId{0};
+  ON_CALL(*serializer, deserialize(_, _))
+      .WillByDefault([&](std::istream&,
+                         const Serializer::InstrumentStateConsumer& consumer) {
+        consumer(state);
+        return tl::expected<std::string, std::string>{"Venue"};
+      });
+
+  auto expected_state = state;
+  expected_state.order_book.buy_orders = {order};
+  EXPECT_CALL(executor, recover_state_request(ElementsAre(expected_state)));
+
+  MarketStatePersistenceController controller{
+      config, executor, std::move(serializer), {}, {}, &journal};
   controller.recover();
+
+  for (const auto& segment : journal.segments()) {
+    std::filesystem::remove(segment);
+  }
 }
 
 TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
        RecoverReturnsRecoveredCodeWhenDeserializationIsSuccessful) {
-  EXPECT_CALL(*serializer, deserialize(_))
-      .WillOnce(Return(market_state::Snapshot{}));
+  EXPECT_CALL(*serializer, deserialize(_, _))
+      .WillOnce(Return(tl::expected<std::string, std::string>{"Venue"}));
 
   MarketStatePersistenceController controller{
       config, executor, std::move(serializer), {}, {}};
@@ -239,5 +349,33 @@ TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
   ASSERT_EQ(result.code, core::code::RecoverMarketState::Recovered);
 }
 
+TEST_F(TradingSystemMarketStatePersistenceControllerRealFile,
+       RecoverReseedsShadowStateFromEngines) {
+  Instrument instrument;
+  instrument.identifier = InstrumentId{42};
+  ShadowMarketState shadow{"Venue", {instrument}};
+  market_state::LimitOrder order;
+  order.order_id = OrderId{1};
+
+  ON_CALL(*serializer, deserialize(_, _))
+      .WillByDefault(Return(tl::expected<std::string, std::string>{"Venue"}));
+  EXPECT_CALL(executor, store_state_request)
+      .WillOnce([&](std::vector<market_state::InstrumentState>& states) {
+        states.front().order_book.buy_orders.push_back(order);
+      });
+
+  MarketStatePersistenceController controller{config,
+                                              executor,
+                                              std::move(serializer),
+                                              "Venue",
+                                              {instrument},
+                                              nullptr,
+                                              &shadow};
+  controller.recover();
+
+  EXPECT_THAT(shadow.capture().instruments.front().order_book.buy_orders,
+              ElementsAre(order));
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::test
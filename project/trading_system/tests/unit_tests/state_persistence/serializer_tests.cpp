@@ -1,3 +1,4 @@
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <sstream>
@@ -7,6 +8,8 @@
 namespace simulator::trading_system::test {
 namespace {
 
+using namespace ::testing;  // NOLINT
+
 TEST(TradingSystemStatePersistenceJsonSerializer,
      SerializesEmptySnapshotToFormattedJson) {
   const market_state::Snapshot snapshot;
@@ -83,5 +86,175 @@ R"({
   ASSERT_TRUE(snapshot.instruments.empty());
 }
 
+struct TradingSystemStatePersistenceStreamingJsonSerializer : public Test {
+  static auto make_instrument_state(std::string symbol)
+      -> market_state::InstrumentState {
+    market_state::InstrumentState state;
+    state.instrument.symbol = Symbol{std::move(symbol)};
+    state.info = market_state::InstrumentInfo{.low_price = Price{1.25},
+                                              .high_price = Price{2.5}};
+    return state;
+  }
+
+  static auto make_snapshot() -> market_state::Snapshot {
+    market_state::Snapshot snapshot;
+    snapshot.venue_id = "Venue";
+    snapshot.instruments.push_back(make_instrument_state("AAPL"));
+    snapshot.instruments.push_back(make_instrument_state("MSFT"));
+    return snapshot;
+  }
+};
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       SerializesEmptySnapshotToFormattedJson) {
+  const market_state::Snapshot snapshot;
+  std::stringstream ss;
+  const StreamingJsonSerializer serializer;
+
+  ASSERT_TRUE(serializer.serialize(snapshot, ss));
+
+  // clang-format off
+  const std::string expected =
+R"({
+    "venue_id": "",
+    "instruments": []
+})";
+  // clang-format on
+  ASSERT_EQ(ss.str(), expected);
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       SerializesEmptySnapshotToCompactJson) {
+  const market_state::Snapshot snapshot;
+  std::stringstream ss;
+  const StreamingJsonSerializer serializer{
+      StreamingJsonSerializer::Format::Compact};
+
+  ASSERT_TRUE(serializer.serialize(snapshot, ss));
+  ASSERT_EQ(ss.str(), R"({"venue_id":"","instruments":[]})");
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ProducesSameFormattedJsonAsDocumentSerializer) {
+  const auto snapshot = make_snapshot();
+  std::stringstream streamed;
+  std::stringstream materialized;
+
+  ASSERT_TRUE(StreamingJsonSerializer{}.serialize(snapshot, streamed));
+  ASSERT_TRUE(JsonSerializer{}.serialize(snapshot, materialized));
+
+  ASSERT_EQ(streamed.str(), materialized.str());
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ReadsSnapshotWrittenInCompactFormat) {
+  const auto snapshot = make_snapshot();
+  const StreamingJsonSerializer serializer{
+      StreamingJsonSerializer::Format::Compact};
+  std::stringstream ss;
+  ASSERT_TRUE(serializer.serialize(snapshot, ss));
+
+  auto result = serializer.deserialize(ss);
+
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->venue_id, "Venue");
+  ASSERT_THAT(result->instruments, ElementsAreArray(snapshot.instruments));
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       PassesInstrumentStatesToConsumerOneByOne) {
+  const auto snapshot = make_snapshot();
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss;
+  ASSERT_TRUE(serializer.serialize(snapshot, ss));
+
+  std::vector<market_state::InstrumentState> consumed;
+  auto result =
+      serializer.deserialize(ss, [&](market_state::InstrumentState state) {
+        consumed.push_back(std::move(state));
+      });
+
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result.value(), "Venue");
+  ASSERT_THAT(consumed, ElementsAreArray(snapshot.instruments));
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       IgnoresUnknownFields) {
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss{
+      R"({"unknown": {"nested": [1, 2]}, "venue_id": "Venue", )"
+      R"("instruments": []})"};
+
+  auto result = serializer.deserialize(ss);
+
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->venue_id, "Venue");
+  ASSERT_TRUE(result->instruments.empty());
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ReturnsErrorOnEmptyJson) {
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss;
+
+  auto result = serializer.deserialize(ss);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error(), "Error parsing JSON: The document is empty.");
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ReturnsErrorOnMalformedJson) {
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss{"{ not quoted key"};
+
+  auto result = serializer.deserialize(ss);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(
+      result.error(),
+      "Error parsing JSON on offset 2: Missing a name for object member.");
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ReturnsErrorIncorrectVenueIdValueType) {
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss{R"({"venue_id": 123, "instruments": []})"};
+
+  auto result = serializer.deserialize(ss);
+
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(
+      result.error(),
+      "Error deserializing JSON: failed to parse field `venue_id`: unexpected "
+      "data Type `rapidjson::Type::kNumberType`, `string` is expected");
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ReturnsErrorOnMissingInstruments) {
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss{R"({"venue_id": "Venue"})"};
+
+  auto result = serializer.deserialize(ss);
+
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error(),
+            "Error deserializing JSON: missing field `instruments` in JSON "
+            "object");
+}
+
+TEST_F(TradingSystemStatePersistenceStreamingJsonSerializer,
+       ReturnsErrorOnNonObjectInstrumentState) {
+  const StreamingJsonSerializer serializer;
+  std::stringstream ss{R"({"venue_id": "Venue", "instruments": [42]})"};
+
+  auto result = serializer.deserialize(ss);
+
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error(),
+            "Error deserializing JSON: failed to parse field `instruments`: "
+            "failed to parse JSON array item #0: unexpected data Type "
+            "`rapidjson::Type::kNumberType`, `object` is expected");
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::test
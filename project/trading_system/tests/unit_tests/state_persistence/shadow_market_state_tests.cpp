@@ -0,0 +1,136 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ih/state_persistence/shadow_market_state.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+struct TradingSystemStatePersistenceShadowMarketState : public Test {
+  auto SetUp() -> void override {
+    instrument.symbol = Symbol{"AAPL"};
+    instrument.identifier = InstrumentId{42};
+  }
+
+  static auto make_order(OrderId order_id) -> market_state::LimitOrder {
+    market_state::LimitOrder order;
+    order.order_id = order_id;
+    order.side = Side::Option::Buy;
+    order.order_price = OrderPrice{10.};
+    order.total_quantity = OrderQuantity{100.};
+    return order;
+  }
+
+  auto record(market_state::JournalRecord::Mutation mutation) const
+      -> market_state::JournalRecord {
+    return {.instrument_id = instrument.identifier,
+            .mutation = std::move(mutation)};
+  }
+
+  static auto buy_order_ids(const market_state::Snapshot& snapshot)
+      -> std::vector<OrderId> {
+    std::vector<OrderId> order_ids;
+    const auto& book = snapshot.instruments.front().order_book;
+    for (const auto& order : book.buy_orders) {
+      order_ids.push_back(order.order_id);
+    }
+    return order_ids;
+  }
+
+  Instrument instrument;
+};
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       HoldsInstrumentsWithEmptyStates) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+
+  const auto& snapshot = shadow.capture();
+
+  EXPECT_EQ(snapshot.venue_id, "XETRA");
+  ASSERT_THAT(snapshot.instruments, SizeIs(1));
+  EXPECT_EQ(snapshot.instruments.front(),
+            market_state::InstrumentState{.instrument = instrument});
+}
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       AppliesMutationsQueuedBeforeCapture) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+  shadow.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  shadow.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{2})}));
+  shadow.append(record(market_state::JournalRecord::OrderRemoved{
+      .order_id = OrderId{1}, .side = Side::Option::Buy}));
+
+  EXPECT_THAT(buy_order_ids(shadow.capture()), ElementsAre(OrderId{2}));
+}
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       KeepsCapturedStateBetweenCaptures) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+  shadow.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  static_cast<void>(shadow.capture());
+
+  shadow.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{2})}));
+
+  EXPECT_THAT(buy_order_ids(shadow.capture()),
+              ElementsAre(OrderId{1}, OrderId{2}));
+}
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       IgnoresMutationsOfUnknownInstruments) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+  shadow.append({.instrument_id = InstrumentId{7},
+                 .mutation = market_state::JournalRecord::OrderAdded{
+                     make_order(OrderId{1})}});
+
+  EXPECT_THAT(buy_order_ids(shadow.capture()), IsEmpty());
+}
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       ReseedDropsMutationsQueuedBeforeIt) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+  shadow.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+
+  shadow.reseed([&](std::vector<market_state::InstrumentState>& states) {
+    ASSERT_THAT(states, SizeIs(1));
+    EXPECT_EQ(states.front().instrument, instrument);
+    states.front().order_book.buy_orders.push_back(make_order(OrderId{2}));
+  });
+
+  EXPECT_THAT(buy_order_ids(shadow.capture()), ElementsAre(OrderId{2}));
+}
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       ReseedClearsPreviouslyCapturedState) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+  shadow.append(
+      record(market_state::JournalRecord::OrderAdded{make_order(OrderId{1})}));
+  static_cast<void>(shadow.capture());
+
+  shadow.reseed([](std::vector<market_state::InstrumentState>&) {});
+
+  EXPECT_THAT(buy_order_ids(shadow.capture()), IsEmpty());
+}
+
+TEST_F(TradingSystemStatePersistenceShadowMarketState,
+       AppliesMutationsQueuedWhileReseeding) {
+  ShadowMarketState shadow{"XETRA", {instrument}};
+
+  shadow.reseed([&](std::vector<market_state::InstrumentState>&) {
+    shadow.append(record(
+        market_state::JournalRecord::OrderAdded{make_order(OrderId{3})}));
+  });
+
+  EXPECT_THAT(buy_order_ids(shadow.capture()), ElementsAre(OrderId{3}));
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+#include "ih/state_persistence/snapshot_scheduler.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+using namespace std::chrono_literals;
+
+struct TradingSystemStatePersistenceSnapshotScheduler : public Test {
+  auto snapshot_callback() {
+    return [this] {
+      if (++snapshots == 1) {
+        stored.set_value();
+      }
+    };
+  }
+
+  std::atomic<int> snapshots{0};
+  std::promise<void> stored;
+};
+
+TEST_F(TradingSystemStatePersistenceSnapshotScheduler,
+       DoesNotRequestSnapshotBeforeIntervalElapses) {
+  SnapshotScheduler scheduler{10s, snapshot_callback()};
+
+  ASSERT_FALSE(scheduler.tick(SnapshotScheduler::Clock::now() + 5s));
+}
+
+TEST_F(TradingSystemStatePersistenceSnapshotScheduler,
+       StoresSnapshotOnceIntervalElapses) {
+  SnapshotScheduler scheduler{10s, snapshot_callback()};
+  const auto now = SnapshotScheduler::Clock::now();
+
+  ASSERT_TRUE(scheduler.tick(now + 10s));
+  ASSERT_EQ(stored.get_future().wait_for(5s), std::future_status::ready);
+
+  ASSERT_FALSE(scheduler.tick(now + 15s));
+  ASSERT_TRUE(scheduler.tick(now + 20s));
+}
+
+TEST_F(TradingSystemStatePersistenceSnapshotScheduler,
+       DoesNotRequestPeriodicSnapshotsWithZeroInterval) {
+  SnapshotScheduler scheduler{0s, snapshot_callback()};
+
+  ASSERT_FALSE(scheduler.tick(SnapshotScheduler::Clock::now() + 24h));
+}
+
+TEST_F(TradingSystemStatePersistenceSnapshotScheduler,
+       StoresExplicitlyRequestedSnapshot) {
+  SnapshotScheduler scheduler{0s, snapshot_callback()};
+
+  scheduler.request();
+
+  ASSERT_EQ(stored.get_future().wait_for(5s), std::future_status::ready);
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test